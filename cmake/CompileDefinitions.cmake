@@ -20,6 +20,7 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_CAMERA_SYSTEM)
     define_if("raylib" SUPPORT_GESTURES_SYSTEM)
     define_if("raylib" SUPPORT_MOUSE_GESTURES)
+    define_if("raylib" SUPPORT_PARTICLE_SYSTEM)
     define_if("raylib" SUPPORT_SSH_KEYBOARD_RPI)
     define_if("raylib" SUPPORT_DEFAULT_FONT)
     define_if("raylib" SUPPORT_SCREEN_CAPTURE)
@@ -28,6 +29,9 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_EVENTS_WAITING)
     define_if("raylib" SUPPORT_WINMM_HIGHRES_TIMER)
     define_if("raylib" SUPPORT_COMPRESSION_API)
+    define_if("raylib" SUPPORT_JOB_SYSTEM)
+    define_if("raylib" SUPPORT_PROFILER)
+    define_if("raylib" RAYMATH_SIMD)
     define_if("raylib" SUPPORT_QUADS_DRAW_MODE)
     define_if("raylib" SUPPORT_IMAGE_EXPORT)
     define_if("raylib" SUPPORT_IMAGE_GENERATION)
@@ -62,6 +66,8 @@ if (${CUSTOMIZE_BUILD})
     define_if("raylib" SUPPORT_FILEFORMAT_MP3)
     define_if("raylib" SUPPORT_FILEFORMAT_FLAC)
     define_if("raylib" SUPPORT_STANDARD_FILEIO)
+    define_if("raylib" SUPPORT_FILE_MAPPING)
+    define_if("raylib" SUPPORT_PACK_FILES)
     define_if("raylib" SUPPORT_TRACELOG)
 
     if (UNIX AND NOT APPLE)
@@ -0,0 +1,125 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - compression levels
+*
+*   NOTE: CompressDataEx() compresses data bigger than one chunk in parallel with job workers,
+*   this example measures compression ratio and throughput for every level (0..8) and the
+*   decompression throughput of generated data, checking decompressed data matches original
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>                 // Required for: malloc(), free()
+#include <string.h>                 // Required for: memcmp()
+
+#define DATA_SIZE       (32*1024*1024)  // Generated data size (bytes)
+#define LEVELS_COUNT    9               // Compression levels: 0 (fastest) to 8 (best)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - compression levels");
+
+    // Generate text-like data, words picked randomly with some random binary runs
+    static const char *words[] = { "raylib ", "simple ", "and ", "easy-to-use ", "library ", "to ", "enjoy ", "videogames ", "programming\n" };
+    unsigned char *data = (unsigned char *)malloc(DATA_SIZE);
+
+    for (int i = 0; i < DATA_SIZE;)
+    {
+        if (GetRandomValue(0, 99) == 0)
+        {
+            for (int j = 0; (j < 64) && (i < DATA_SIZE); j++, i++) data[i] = (unsigned char)GetRandomValue(0, 255);
+        }
+        else
+        {
+            const char *word = words[GetRandomValue(0, 8)];
+            for (int j = 0; (word[j] != '\0') && (i < DATA_SIZE); j++, i++) data[i] = (unsigned char)word[j];
+        }
+    }
+
+    // Measure every compression level, decompressed data is checked against original data
+    float ratio[LEVELS_COUNT] = { 0 };
+    float compressSpeed[LEVELS_COUNT] = { 0 };     // Compression throughput (MB/s)
+    float decompressSpeed[LEVELS_COUNT] = { 0 };   // Decompression throughput (MB/s)
+    bool equal[LEVELS_COUNT] = { 0 };
+
+    for (int level = 0; level < LEVELS_COUNT; level++)
+    {
+        int compDataSize = 0;
+        double time = GetTime();
+        unsigned char *compData = CompressDataEx(data, DATA_SIZE, &compDataSize, level);
+        double compressTime = GetTime() - time;
+
+        int dataSize = 0;
+        time = GetTime();
+        unsigned char *decompData = DecompressData(compData, compDataSize, &dataSize);
+        double decompressTime = GetTime() - time;
+
+        ratio[level] = (float)compDataSize/DATA_SIZE;
+        compressSpeed[level] = (float)(DATA_SIZE/(1024.0*1024.0)/compressTime);
+        decompressSpeed[level] = (float)(DATA_SIZE/(1024.0*1024.0)/decompressTime);
+        equal[level] = (decompData != NULL) && (dataSize == DATA_SIZE) && (memcmp(decompData, data, DATA_SIZE) == 0);
+
+        MemFree(compData);
+        MemFree(decompData);
+    }
+
+    free(data);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("Compressing %i MB of generated data per level", DATA_SIZE/(1024*1024)), 40, 30, 20, DARKGRAY);
+
+            DrawText("LEVEL", 40, 80, 20, GRAY);
+            DrawText("RATIO", 140, 80, 20, GRAY);
+            DrawText("COMPRESS", 260, 80, 20, GRAY);
+            DrawText("DECOMPRESS", 440, 80, 20, GRAY);
+            DrawText("RESULT", 640, 80, 20, GRAY);
+
+            for (int level = 0; level < LEVELS_COUNT; level++)
+            {
+                int posY = 115 + level*32;
+
+                DrawText(TextFormat("%i", level), 40, posY, 20, DARKGRAY);
+                DrawText(TextFormat("%.1f%%", ratio[level]*100.0f), 140, posY, 20, DARKGRAY);
+                DrawText(TextFormat("%.0f MB/s", compressSpeed[level]), 260, posY, 20, MAROON);
+                DrawText(TextFormat("%.0f MB/s", decompressSpeed[level]), 440, posY, 20, DARKBLUE);
+                DrawText(equal[level]? "EQUAL" : "DIFFERENT", 640, posY, 20, equal[level]? LIME : RED);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - directory files
+*
+*   NOTE: LoadDirectoryFilesEx() stores scanned paths in a single growable memory block,
+*   this example generates a directory tree with 100k files and measures the time to scan it,
+*   recursively with and without extension filter and one directory without recursion
+*
+*   NOTE: Scanning times depend on OS file system cache, first scan after generating
+*   the files is usually served from cache
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>                  // Required for: fopen(), fclose()
+
+#if defined(_WIN32)
+    #include <direct.h>             // Required for: _mkdir()
+    #define MAKE_DIRECTORY(path)    _mkdir(path)
+#else
+    #include <sys/stat.h>           // Required for: mkdir()
+    #define MAKE_DIRECTORY(path)    mkdir(path, 0777)
+#endif
+
+#define BASE_PATH           "directory_files"   // Generated directory tree base path
+#define DIRECTORY_COUNT     100                 // Generated directories
+#define FILES_PER_DIRECTORY 1000                // Generated files per directory, 100*1000 = 100k files
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - directory files");
+
+    int generatedCount = 0;         // Directories generated, files are generated one directory per frame
+    bool generating = false;
+
+    double scanTime[3] = { 0 };     // Scan times: recursive, recursive filtered, one directory
+    int scanCount[3] = { 0 };       // Scanned paths count
+    bool scanned = false;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_G) && !generating && (generatedCount == 0))
+        {
+            MAKE_DIRECTORY(BASE_PATH);
+            generating = true;
+        }
+
+        if (generating)
+        {
+            // Generate one directory with empty files, half of them with .png extension
+            const char *dirPath = TextFormat("%s/dir%03i", BASE_PATH, generatedCount);
+            MAKE_DIRECTORY(dirPath);
+
+            for (int i = 0; i < FILES_PER_DIRECTORY; i++)
+            {
+                FILE *file = fopen(TextFormat("%s/dir%03i/file%04i.%s", BASE_PATH, generatedCount, i, (i%2 == 0)? "png" : "txt"), "wb");
+                if (file != NULL) fclose(file);
+            }
+
+            generatedCount++;
+            if (generatedCount == DIRECTORY_COUNT) generating = false;
+        }
+
+        if (IsKeyPressed(KEY_S) && DirectoryExists(BASE_PATH) && !generating)
+        {
+            FilePathList files = { 0 };
+
+            double time = GetTime();
+            files = LoadDirectoryFilesEx(BASE_PATH, NULL, true);
+            scanTime[0] = GetTime() - time;
+            scanCount[0] = files.count;
+            UnloadDirectoryFiles(files);
+
+            time = GetTime();
+            files = LoadDirectoryFilesEx(BASE_PATH, ".png", true);
+            scanTime[1] = GetTime() - time;
+            scanCount[1] = files.count;
+            UnloadDirectoryFiles(files);
+
+            time = GetTime();
+            files = LoadDirectoryFiles(BASE_PATH "/dir000");
+            scanTime[2] = GetTime() - time;
+            scanCount[2] = files.count;
+            UnloadDirectoryFiles(files);
+
+            scanned = true;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("Press [G] to generate %i files into %s/", DIRECTORY_COUNT*FILES_PER_DIRECTORY, BASE_PATH), 40, 40, 20, MAROON);
+
+            DrawRectangle(40, 80, 720, 20, LIGHTGRAY);
+            DrawRectangle(40, 80, 720*generatedCount/DIRECTORY_COUNT, 20, SKYBLUE);
+            DrawText(TextFormat("DIRECTORIES GENERATED: %i/%i", generatedCount, DIRECTORY_COUNT), 40, 110, 20, DARKGRAY);
+
+            DrawText("Press [S] to scan generated files", 40, 170, 20, MAROON);
+
+            if (scanned)
+            {
+                DrawText(TextFormat("Recursive scan: %i paths in %.2f ms", scanCount[0], scanTime[0]*1000.0), 60, 210, 20, DARKGRAY);
+                DrawText(TextFormat("Recursive scan (.png filter): %i paths in %.2f ms", scanCount[1], scanTime[1]*1000.0), 60, 240, 20, DARKGRAY);
+                DrawText(TextFormat("One directory scan: %i paths in %.2f ms", scanCount[2], scanTime[2]*1000.0), 60, 270, 20, DARKGRAY);
+            }
+
+            DrawText("Generated files are not deleted on exit", 40, 400, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - loading jobs
+*
+*   NOTE: Job work steps run on worker threads, finish steps run on main thread inside EndDrawing(),
+*   so GPU uploads (textures loading) are done in finish steps, limited by a time budget per frame
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_TILES       48          // Number of textures generated by jobs
+#define TILE_SIZE       256         // Generated images size (pixels)
+
+// Job data, image generated on worker thread and uploaded to GPU on main thread
+typedef struct TileJob {
+    int index;                      // Tile index, used as noise offset
+    Image image;                    // Generated image (worker thread)
+    Texture2D texture;              // Loaded texture (main thread)
+} TileJob;
+
+static void GenerateTile(void *data);       // Job work: generate tile image (worker thread)
+static void UploadTile(void *data);         // Job finish: load tile texture (main thread)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - loading jobs");
+
+    TileJob tiles[MAX_TILES] = { 0 };
+    unsigned int jobIds[MAX_TILES] = { 0 };
+
+    SetJobFinishBudget(0.002f);     // Max 2 ms per frame uploading textures
+
+    for (int i = 0; i < MAX_TILES; i++)
+    {
+        tiles[i].index = i;
+        jobIds[i] = QueueJob(GenerateTile, UploadTile, &tiles[i]);
+    }
+
+    float rotation = 0.0f;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        int doneCount = 0;
+        for (int i = 0; i < MAX_TILES; i++) if (IsJobDone(jobIds[i])) doneCount++;
+
+        rotation += 180.0f*GetFrameTime();  // Main thread keeps running while jobs are working
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < MAX_TILES; i++)
+            {
+                Rectangle dest = { 16.0f + (i%12)*64.0f, 60.0f + (i/12)*64.0f, 60.0f, 60.0f };
+
+                if (IsJobDone(jobIds[i])) DrawTexturePro(tiles[i].texture, (Rectangle){ 0, 0, TILE_SIZE, TILE_SIZE }, dest, (Vector2){ 0, 0 }, 0.0f, WHITE);
+                else DrawRectangleLinesEx(dest, 1.0f, LIGHTGRAY);
+            }
+
+            DrawRectanglePro((Rectangle){ 720, 380, 60, 60 }, (Vector2){ 30, 30 }, rotation, MAROON);
+
+            DrawRectangle(16, 340, 600, 20, LIGHTGRAY);
+            DrawRectangle(16, 340, 600*doneCount/MAX_TILES, 20, SKYBLUE);
+            DrawText(TextFormat("TILES LOADED: %i/%i", doneCount, MAX_TILES), 16, 370, 20, DARKGRAY);
+
+            DrawText("Tiles are generated by jobs, window keeps responsive", 16, 20, 20, DARKGRAY);
+
+            DrawFPS(700, 20);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_TILES; i++)
+    {
+        WaitJob(jobIds[i]);         // Job data must stay valid until job is done
+        UnloadTexture(tiles[i].texture);
+    }
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Job work: generate tile image (worker thread), CPU work only
+static void GenerateTile(void *data)
+{
+    TileJob *tile = (TileJob *)data;
+
+    tile->image = GenImagePerlinNoise(TILE_SIZE, TILE_SIZE, tile->index*TILE_SIZE, 0, 4.0f);
+    ImageColorTint(&tile->image, ColorFromHSV(tile->index*360.0f/MAX_TILES, 0.6f, 1.0f));
+}
+
+// Job finish: load tile texture (main thread), GPU access allowed
+static void UploadTile(void *data)
+{
+    TileJob *tile = (TileJob *)data;
+
+    tile->texture = LoadTextureFromImage(tile->image);
+    UnloadImage(tile->image);
+}
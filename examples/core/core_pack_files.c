@@ -0,0 +1,169 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - pack files
+*
+*   NOTE: ExportPackFile() packs a directory into a single file, MountPackFile() maps it into memory
+*   and file loading functions read pack entries first; this example packs a directory and measures
+*   the time to load all its files from disk and from the mounted pack
+*
+*   NOTE: For cold start measurements, run the example right after flushing OS file cache
+*   (i.e. "sync; echo 3 > /proc/sys/vm/drop_caches" on Linux) and load first, otherwise
+*   files are read from OS file cache; exporting the pack also leaves it in the file cache
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <string.h>                 // Required for: strncpy()
+
+#define PACK_FILE_NAME      "resources.rpak"
+
+// Files loading measure
+typedef struct LoadMeasure {
+    bool done;                      // Measure done
+    double mountTime;               // Pack mounting time (seconds)
+    double loadTime;                // All files loading time (seconds)
+    long long bytesLoaded;          // Loaded bytes
+} LoadMeasure;
+
+static LoadMeasure MeasureFilesLoading(FilePathList files, const char *packFileName, const char *mountPath);    // Load all files, from disk or from mounted pack
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - pack files");
+
+    char dirPath[512] = "resources";    // Directory to pack, a directory can be dropped into window
+    FilePathList files = LoadDirectoryFilesEx(dirPath, NULL, true);
+
+    double exportTime = 0.0;
+    LoadMeasure diskMeasure = { 0 };
+    LoadMeasure packMeasure = { 0 };
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsFileDropped())
+        {
+            FilePathList droppedFiles = LoadDroppedFiles();
+
+            if ((droppedFiles.count > 0) && DirectoryExists(droppedFiles.paths[0]))
+            {
+                strncpy(dirPath, droppedFiles.paths[0], 511);
+
+                UnloadDirectoryFiles(files);
+                files = LoadDirectoryFilesEx(dirPath, NULL, true);
+
+                exportTime = 0.0;
+                diskMeasure = (LoadMeasure){ 0 };
+                packMeasure = (LoadMeasure){ 0 };
+            }
+
+            UnloadDroppedFiles(droppedFiles);
+        }
+
+        if (IsKeyPressed(KEY_E))
+        {
+            double time = GetTime();
+            if (ExportPackFile(PACK_FILE_NAME, dirPath)) exportTime = GetTime() - time;
+        }
+
+        if (IsKeyPressed(KEY_D)) diskMeasure = MeasureFilesLoading(files, NULL, NULL);
+        if (IsKeyPressed(KEY_P) && FileExists(PACK_FILE_NAME)) packMeasure = MeasureFilesLoading(files, PACK_FILE_NAME, dirPath);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("DIRECTORY: %s (%i files)", GetFileName(dirPath), files.count), 40, 40, 20, DARKGRAY);
+            DrawText("Drop a directory into the window to pack it", 40, 70, 10, GRAY);
+
+            DrawText("Press [E] to export directory into pack file", 40, 110, 20, MAROON);
+            if (exportTime > 0.0) DrawText(TextFormat("%s exported in %.1f ms (%i bytes)", PACK_FILE_NAME, exportTime*1000.0, GetFileLength(PACK_FILE_NAME)), 80, 140, 20, DARKGRAY);
+
+            DrawText("Press [D] to load all files from disk", 40, 190, 20, MAROON);
+            if (diskMeasure.done) DrawText(TextFormat("%lli bytes loaded in %.2f ms", diskMeasure.bytesLoaded, diskMeasure.loadTime*1000.0), 80, 220, 20, DARKGRAY);
+
+            DrawText("Press [P] to mount pack file and load all files from pack", 40, 270, 20, MAROON);
+            if (packMeasure.done) DrawText(TextFormat("%lli bytes loaded in %.2f ms (mount: %.2f ms)", packMeasure.bytesLoaded, packMeasure.loadTime*1000.0, packMeasure.mountTime*1000.0), 80, 300, 20, DARKGRAY);
+
+            DrawText("First load after flushing OS file cache measures cold start", 40, 400, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadDirectoryFiles(files);
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Load all files, from disk or from mounted pack if pack file name is provided
+// NOTE: Files are loaded with LoadFileData(), mounted pack resolves directory files relative to mount path
+static LoadMeasure MeasureFilesLoading(FilePathList files, const char *packFileName, const char *mountPath)
+{
+    LoadMeasure measure = { 0 };
+
+    SetTraceLogLevel(LOG_WARNING);  // Avoid logging every file loaded, it would be measured
+
+    double time = GetTime();
+
+    if (packFileName != NULL)
+    {
+        if (!MountPackFile(packFileName, mountPath))
+        {
+            SetTraceLogLevel(LOG_INFO);
+            return measure;
+        }
+
+        measure.mountTime = GetTime() - time;
+    }
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        unsigned int dataSize = 0;
+        unsigned char *data = LoadFileData(files.paths[i], &dataSize);
+
+        measure.bytesLoaded += dataSize;
+        UnloadFileData(data);
+    }
+
+    measure.loadTime = GetTime() - time - measure.mountTime;
+    measure.done = true;
+
+    if (packFileName != NULL) UnmountPackFile();
+
+    SetTraceLogLevel(LOG_INFO);
+
+    return measure;
+}
@@ -0,0 +1,195 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - raymath simd
+*
+*   NOTE: raymath uses SSE/NEON code paths when RAYMATH_SIMD is defined, this example measures
+*   the time per call of hot matrix and vector functions, build it with and without -DRAYMATH_SIMD
+*   to compare both implementations
+*
+*   SIMD paths: MatrixMultiply(), Vector3BoundsArray(), other measured functions are scalar only
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#define ITERATIONS      1000000     // Calls per function measure
+#define ARRAY_SIZE      1024        // Elements per batch function call
+#define BENCHMARK_COUNT 11          // Functions measured
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static void RunBenchmarks(double *nsPerCall, float *checksum);     // Measure raymath functions, time per call (nanoseconds)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - raymath simd");
+
+    static const char *names[BENCHMARK_COUNT] = {
+        "MatrixMultiply()", "MatrixAdd()", "MatrixSubtract()", "QuaternionMultiply()", "Vector3Transform()",
+        "Vector3TransformArray()", "Vector3RotateByQuaternionArray()", "MatrixMultiplyArray()", "Vector3BoundsArray()",
+        "MatrixInvert()", "Vector3RotateByQuaternion()"
+    };
+
+    double nsPerCall[BENCHMARK_COUNT] = { 0 };
+    float checksum = 0.0f;          // Results checksum, so compiler can not skip unused results
+
+    RunBenchmarks(nsPerCall, &checksum);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) RunBenchmarks(nsPerCall, &checksum);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+#if defined(RAYMATH_SIMD_SSE)
+            DrawText("RAYMATH_SIMD: SSE", 40, 30, 20, LIME);
+#elif defined(RAYMATH_SIMD_NEON)
+            DrawText("RAYMATH_SIMD: NEON", 40, 30, 20, LIME);
+#else
+            DrawText("RAYMATH_SIMD: disabled (scalar)", 40, 30, 20, MAROON);
+#endif
+            DrawText("Press [SPACE] to measure again", 600, 420, 10, GRAY);
+
+            for (int i = 0; i < BENCHMARK_COUNT; i++)
+            {
+                int posY = 80 + i*30;
+
+                bool simd = (i == 0) || (i == 8);   // Functions with SIMD paths: MatrixMultiply(), Vector3BoundsArray()
+                bool batch = (i >= 5) && (i < 9);   // Batch functions measure time per element
+
+                DrawText(names[i], 40, posY, 20, simd? DARKGRAY : GRAY);
+                DrawText(TextFormat(batch? "%.2f ns/element" : "%.2f ns/call", nsPerCall[i]), 520, posY, 20, simd? DARKBLUE : GRAY);
+            }
+
+            DrawText(TextFormat("checksum: %f", checksum), 40, 420, 10, LIGHTGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Measure raymath functions, time per call (nanoseconds), batch functions time per element
+// NOTE: Every call result is used as next call input, so calls can not be skipped or run in parallel
+static void RunBenchmarks(double *nsPerCall, float *checksum)
+{
+    static Vector3 points[ARRAY_SIZE] = { 0 };
+    static Matrix matrices[ARRAY_SIZE] = { 0 };
+    static Matrix products[ARRAY_SIZE] = { 0 };
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        points[i] = (Vector3){ (float)GetRandomValue(-100, 100), (float)GetRandomValue(-100, 100), (float)GetRandomValue(-100, 100) };
+        matrices[i] = MatrixRotateXYZ(points[i]);
+    }
+
+    Matrix mat = MatrixRotateXYZ((Vector3){ 0.1f, 0.2f, 0.3f });
+    Matrix acc = MatrixIdentity();
+    Quaternion q = QuaternionFromEuler(0.1f, 0.2f, 0.3f);
+    Quaternion qacc = QuaternionIdentity();
+    Vector3 v = { 1.0f, 2.0f, 3.0f };
+    Vector3 min = { 0 }, max = { 0 };
+    float sum = 0.0f;
+
+    double time = GetTime();
+    for (int i = 0; i < ITERATIONS; i++) acc = MatrixMultiply(acc, mat);
+    nsPerCall[0] = (GetTime() - time)*1e9/ITERATIONS;
+    sum += acc.m0;
+
+    acc = MatrixIdentity();
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS; i++) acc = MatrixAdd(acc, mat);
+    nsPerCall[1] = (GetTime() - time)*1e9/ITERATIONS;
+    sum += acc.m0;
+
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS; i++) acc = MatrixSubtract(acc, mat);
+    nsPerCall[2] = (GetTime() - time)*1e9/ITERATIONS;
+    sum += acc.m0;
+
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS; i++) qacc = QuaternionMultiply(qacc, q);
+    nsPerCall[3] = (GetTime() - time)*1e9/ITERATIONS;
+    sum += qacc.x;
+
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS; i++) v = Vector3Transform(v, mat);
+    nsPerCall[4] = (GetTime() - time)*1e9/ITERATIONS;
+    sum += v.x;
+
+    // Batch functions, points are processed in-place (rotations keep them bounded)
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS/ARRAY_SIZE; i++) Vector3TransformArray(points, points, ARRAY_SIZE, mat);
+    nsPerCall[5] = (GetTime() - time)*1e9/((ITERATIONS/ARRAY_SIZE)*ARRAY_SIZE);
+    sum += points[0].x;
+
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS/ARRAY_SIZE; i++) Vector3RotateByQuaternionArray(points, points, ARRAY_SIZE, q);
+    nsPerCall[6] = (GetTime() - time)*1e9/((ITERATIONS/ARRAY_SIZE)*ARRAY_SIZE);
+    sum += points[0].x;
+
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS/ARRAY_SIZE; i++) MatrixMultiplyArray(products, matrices, matrices, ARRAY_SIZE);
+    nsPerCall[7] = (GetTime() - time)*1e9/((ITERATIONS/ARRAY_SIZE)*ARRAY_SIZE);
+    sum += products[0].m0;
+
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS/ARRAY_SIZE; i++)
+    {
+        Vector3BoundsArray(points, ARRAY_SIZE, &min, &max);
+        sum += max.x - min.x;
+    }
+    nsPerCall[8] = (GetTime() - time)*1e9/((ITERATIONS/ARRAY_SIZE)*ARRAY_SIZE);
+    sum += min.x + max.x;
+
+    // Functions with no batch version, for reference
+    acc = mat;
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS; i++) acc = MatrixInvert(acc);
+    nsPerCall[9] = (GetTime() - time)*1e9/ITERATIONS;
+    sum += acc.m0;
+
+    time = GetTime();
+    for (int i = 0; i < ITERATIONS; i++) v = Vector3RotateByQuaternion(v, q);
+    nsPerCall[10] = (GetTime() - time)*1e9/ITERATIONS;
+    sum += v.x;
+
+    *checksum = sum;
+}
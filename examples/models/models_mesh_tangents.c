@@ -0,0 +1,283 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - mesh tangents
+*
+*   NOTE: GenMeshTangents() computes big meshes in parallel with job workers, this example
+*   times it against a serial implementation with same math and checks both results are bitwise
+*   equal (vertex tangents are accumulated in same triangles order), on 1M triangles unindexed
+*   mesh and on 1M triangles split in indexed meshes (16bit indices address up to 65536 vertices)
+*
+*   NOTE: Serial implementation matches default tangents generation, raylib built with
+*   COMPUTE_TANGENTS_MIKKTSPACE weights triangles tangents differently and results will not match
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include <stdlib.h>                 // Required for: malloc(), calloc(), free()
+#include <string.h>                 // Required for: memcmp()
+
+#define HEIGHTMAP_SIZE      708     // Unindexed heightmap pixels per side, (708 - 1)*(708 - 1)*2 = 999698 triangles
+#define TILE_SIZE           256     // Indexed heightmap tiles pixels per side, welded to 65536 vertices
+#define TILE_COUNT            8     // Indexed heightmap tiles, 8*(256 - 1)*(256 - 1)*2 = 1040400 triangles
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static void GenMeshTangentsSerial(Mesh mesh, float *tangents);  // Compute mesh tangents on calling thread
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - mesh tangents");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 50.0f, 40.0f, 50.0f };        // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };              // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };                  // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                        // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;                     // Camera projection type
+
+    // Generate unindexed heightmap mesh (1M triangles), mesh includes normals and texcoords
+    Image heightmap = GenImagePerlinNoise(HEIGHTMAP_SIZE, HEIGHTMAP_SIZE, 0, 0, 4.0f);
+    Image checked = GenImageChecked(256, 256, 32, 32, ORANGE, DARKBLUE);
+
+    Mesh mesh = GenMeshHeightmap(heightmap, (Vector3){ 32.0f, 6.0f, 32.0f });
+    Model model = LoadModelFromMesh(mesh);
+    Texture2D texture = LoadTextureFromImage(checked);
+    model.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = texture;
+
+    UnloadImage(heightmap);
+    UnloadImage(checked);
+
+    int triangleCount = (mesh.indices != NULL)? mesh.triangleCount : mesh.vertexCount/3;
+    float *tangents = (float *)malloc(mesh.vertexCount*4*sizeof(float));   // Serial tangents results
+
+    // Generate indexed heightmap tiles meshes (1M triangles), drawn with model material
+    Mesh tiles[TILE_COUNT] = { 0 };
+    float *tilesTangents[TILE_COUNT] = { 0 };
+    int tilesTriangleCount = 0;
+
+    for (int i = 0; i < TILE_COUNT; i++)
+    {
+        heightmap = GenImagePerlinNoise(TILE_SIZE, TILE_SIZE, i*TILE_SIZE, 0, 1.0f);
+        tiles[i] = GenMeshHeightmap(heightmap, (Vector3){ 16.0f, 3.0f, 16.0f });
+        UnloadImage(heightmap);
+
+        tilesTangents[i] = (float *)malloc(tiles[i].vertexCount*4*sizeof(float));
+        tilesTriangleCount += (tiles[i].indices != NULL)? tiles[i].triangleCount : tiles[i].vertexCount/3;
+    }
+
+    double serialTime[2] = { 0 };   // Serial tangents generation time, unindexed and indexed meshes (seconds)
+    double jobsTime[2] = { 0 };     // GenMeshTangents() time, unindexed and indexed meshes (seconds)
+    bool equal[2] = { 0 };          // Serial and GenMeshTangents() results bitwise equal
+    bool runBenchmark = true;
+
+    Vector3 position = { -40.0f, 0.0f, -16.0f };    // Unindexed mesh position, indexed tiles drawn at its right side
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera, CAMERA_ORBITAL);
+
+        if (IsKeyPressed(KEY_SPACE)) runBenchmark = true;
+
+        if (runBenchmark)
+        {
+            // Unindexed mesh, every vertex belongs to one triangle
+            double startTime = GetTime();
+            GenMeshTangentsSerial(model.meshes[0], tangents);
+            serialTime[0] = GetTime() - startTime;
+
+            // NOTE: Tangents are also uploaded to GPU, upload is included in measured time
+            startTime = GetTime();
+            GenMeshTangents(&model.meshes[0]);
+            jobsTime[0] = GetTime() - startTime;
+
+            equal[0] = (memcmp(tangents, model.meshes[0].tangents, model.meshes[0].vertexCount*4*sizeof(float)) == 0);
+
+            // Indexed meshes, vertices accumulate tangents of all triangles sharing them
+            startTime = GetTime();
+            for (int i = 0; i < TILE_COUNT; i++) GenMeshTangentsSerial(tiles[i], tilesTangents[i]);
+            serialTime[1] = GetTime() - startTime;
+
+            startTime = GetTime();
+            for (int i = 0; i < TILE_COUNT; i++) GenMeshTangents(&tiles[i]);
+            jobsTime[1] = GetTime() - startTime;
+
+            equal[1] = true;
+            for (int i = 0; i < TILE_COUNT; i++)
+            {
+                if (memcmp(tilesTangents[i], tiles[i].tangents, tiles[i].vertexCount*4*sizeof(float)) != 0) equal[1] = false;
+            }
+
+            runBenchmark = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                DrawModel(model, position, 1.0f, WHITE);
+
+                for (int i = 0; i < TILE_COUNT; i++)
+                {
+                    DrawMesh(tiles[i], model.materials[0], MatrixTranslate(8.0f + (i%2)*16.0f, 0.0f, -32.0f + (i/2)*16.0f));
+                }
+
+            EndMode3D();
+
+            DrawRectangle(10, 40, 420, 190, Fade(RAYWHITE, 0.8f));
+            DrawText(TextFormat("UNINDEXED: %i triangles", triangleCount), 20, 50, 20, DARKGRAY);
+            DrawText(TextFormat("SERIAL: %.2f ms - JOBS: %.2f ms", serialTime[0]*1000.0, jobsTime[0]*1000.0), 20, 75, 20, DARKGRAY);
+            DrawText(equal[0]? "RESULTS: BITWISE EQUAL" : "RESULTS: DIFFERENT", 20, 100, 20, equal[0]? DARKGREEN : MAROON);
+            DrawText(TextFormat("INDEXED: %i meshes, %i triangles", TILE_COUNT, tilesTriangleCount), 20, 140, 20, DARKGRAY);
+            DrawText(TextFormat("SERIAL: %.2f ms - JOBS: %.2f ms", serialTime[1]*1000.0, jobsTime[1]*1000.0), 20, 165, 20, DARKGRAY);
+            DrawText(equal[1]? "RESULTS: BITWISE EQUAL" : "RESULTS: DIFFERENT", 20, 190, 20, equal[1]? DARKGREEN : MAROON);
+
+            DrawText("Press SPACE to run benchmark again", 10, screenHeight - 30, 20, GRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < TILE_COUNT; i++)
+    {
+        free(tilesTangents[i]);     // Free tile serial tangents
+        UnloadMesh(tiles[i]);       // Unload tile mesh (RAM and VRAM)
+    }
+
+    free(tangents);             // Free serial tangents
+    UnloadTexture(texture);     // Unload texture
+    UnloadModel(model);         // Unload model (including mesh)
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Compute mesh tangents on calling thread, same math and triangles order than GenMeshTangents()
+static void GenMeshTangentsSerial(Mesh mesh, float *tangents)
+{
+    int triangleCount = (mesh.indices != NULL)? mesh.triangleCount : mesh.vertexCount/3;
+
+    Vector3 *faceTangents = (Vector3 *)malloc(triangleCount*2*sizeof(Vector3));
+    int *vertexFaceOffsets = NULL;
+    int *vertexFaces = NULL;
+
+    if (mesh.indices != NULL)
+    {
+        // Get vertices triangles lists, triangles are sorted in every list
+        vertexFaceOffsets = (int *)calloc(mesh.vertexCount + 1, sizeof(int));
+        vertexFaces = (int *)malloc(triangleCount*3*sizeof(int));
+
+        for (int i = 0; i < triangleCount*3; i++) vertexFaceOffsets[mesh.indices[i] + 1]++;
+        for (int i = 0; i < mesh.vertexCount; i++) vertexFaceOffsets[i + 1] += vertexFaceOffsets[i];
+
+        for (int i = 0; i < triangleCount*3; i++) vertexFaces[vertexFaceOffsets[mesh.indices[i]]++] = i/3;
+        for (int i = mesh.vertexCount; i > 0; i--) vertexFaceOffsets[i] = vertexFaceOffsets[i - 1];
+        vertexFaceOffsets[0] = 0;
+    }
+
+    // Compute triangles tangent and bitangent directions from positions and texcoords
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int i1 = (mesh.indices != NULL)? mesh.indices[t*3 + 0] : t*3 + 0;
+        int i2 = (mesh.indices != NULL)? mesh.indices[t*3 + 1] : t*3 + 1;
+        int i3 = (mesh.indices != NULL)? mesh.indices[t*3 + 2] : t*3 + 2;
+
+        Vector3 v1 = { mesh.vertices[i1*3 + 0], mesh.vertices[i1*3 + 1], mesh.vertices[i1*3 + 2] };
+        Vector3 v2 = { mesh.vertices[i2*3 + 0], mesh.vertices[i2*3 + 1], mesh.vertices[i2*3 + 2] };
+        Vector3 v3 = { mesh.vertices[i3*3 + 0], mesh.vertices[i3*3 + 1], mesh.vertices[i3*3 + 2] };
+
+        Vector2 uv1 = { mesh.texcoords[i1*2 + 0], mesh.texcoords[i1*2 + 1] };
+        Vector2 uv2 = { mesh.texcoords[i2*2 + 0], mesh.texcoords[i2*2 + 1] };
+        Vector2 uv3 = { mesh.texcoords[i3*2 + 0], mesh.texcoords[i3*2 + 1] };
+
+        float x1 = v2.x - v1.x;
+        float y1 = v2.y - v1.y;
+        float z1 = v2.z - v1.z;
+        float x2 = v3.x - v1.x;
+        float y2 = v3.y - v1.y;
+        float z2 = v3.z - v1.z;
+
+        float s1 = uv2.x - uv1.x;
+        float t1 = uv2.y - uv1.y;
+        float s2 = uv3.x - uv1.x;
+        float t2 = uv3.y - uv1.y;
+
+        float div = s1*t2 - s2*t1;
+        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+
+        faceTangents[t*2 + 0] = (Vector3){ (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
+        faceTangents[t*2 + 1] = (Vector3){ (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+    }
+
+    // Accumulate vertices tangents from their triangles and orthonormalize them with normals
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        Vector3 normal = { mesh.normals[i*3 + 0], mesh.normals[i*3 + 1], mesh.normals[i*3 + 2] };
+        Vector3 tangent = { 0 };
+        Vector3 bitangent = { 0 };
+
+        // Unindexed meshes vertices only belong to their own triangle
+        int first = (vertexFaceOffsets != NULL)? vertexFaceOffsets[i] : i;
+        int last = (vertexFaceOffsets != NULL)? vertexFaceOffsets[i + 1] : ((i/3 < triangleCount)? i + 1 : i);
+
+        for (int f = first; f < last; f++)
+        {
+            int t = (vertexFaces != NULL)? vertexFaces[f] : i/3;
+
+            tangent = Vector3Add(tangent, faceTangents[t*2 + 0]);
+            bitangent = Vector3Add(bitangent, faceTangents[t*2 + 1]);
+        }
+
+        Vector3OrthoNormalize(&normal, &tangent);
+
+        // Tangent can not be computed (degenerated texcoords), any direction perpendicular to normal is used
+        if (Vector3Length(tangent) < EPSILON) tangent = Vector3Normalize(Vector3Perpendicular(normal));
+
+        tangents[i*4 + 0] = tangent.x;
+        tangents[i*4 + 1] = tangent.y;
+        tangents[i*4 + 2] = tangent.z;
+        tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), bitangent) < 0.0f)? -1.0f : 1.0f;
+    }
+
+    free(faceTangents);
+    free(vertexFaceOffsets);
+    free(vertexFaces);
+}
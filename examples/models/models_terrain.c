@@ -0,0 +1,131 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - terrain
+*
+*   NOTE: Terrain is drawn with chunked LOD, vertex heights are sampled from height texture in
+*   vertex shader, so draw cost depends on view and LOD, not on heightmap size (requires OpenGL 3.3)
+*
+*   NOTE: Frame rate is not limited, so frame time measures terrain cost at every heightmap size
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"                   // Required for: rlEnableGpuZones(), rlBeginGpuZone(), rlEndGpuZone(), rlGetGpuZoneResults()
+
+#define MAX_GPU_ZONES       16      // GPU zones results read per frame
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - terrain");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 600.0f, 250.0f, 600.0f };     // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };              // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };                  // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                        // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;                     // Camera projection type
+
+    // Heightmap sizes benchmarked, same terrain world size for all of them
+    const int heightmapSizes[3] = { 512, 2048, 4096 };
+    const Vector3 terrainSize = { 1024.0f, 160.0f, 1024.0f };
+    const Vector3 position = { -terrainSize.x/2.0f, 0.0f, -terrainSize.z/2.0f };   // Terrain drawn centered
+
+    int current = 0;
+    Image heightmap = GenImagePerlinNoise(heightmapSizes[current], heightmapSizes[current], 0, 0, 8.0f);
+    Terrain terrain = LoadTerrain(heightmap, terrainSize);
+    UnloadImage(heightmap);
+
+    rlEnableGpuZones();             // GPU draw time measured with timer queries (OpenGL 3.3)
+
+    rlGpuZone zones[MAX_GPU_ZONES] = { 0 };
+    double drawTime = 0.0;          // Terrain draw CPU time (seconds)
+    double drawTimeGpu = 0.0;       // Terrain draw GPU time (seconds)
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera, CAMERA_ORBITAL);
+
+        // Select heightmap size, terrain is loaded again and frame statistics reset
+        int selected = current;
+        if (IsKeyPressed(KEY_ONE)) selected = 0;
+        else if (IsKeyPressed(KEY_TWO)) selected = 1;
+        else if (IsKeyPressed(KEY_THREE)) selected = 2;
+
+        if (selected != current)
+        {
+            current = selected;
+
+            UnloadTerrain(terrain);
+            heightmap = GenImagePerlinNoise(heightmapSizes[current], heightmapSizes[current], 0, 0, 8.0f);
+            terrain = LoadTerrain(heightmap, terrainSize);
+            UnloadImage(heightmap);
+
+            ResetFrameStats();
+        }
+
+        // GPU zones results are available some frames later
+        int zoneCount = rlGetGpuZoneResults(zones, MAX_GPU_ZONES);
+        if (zoneCount > 0) drawTimeGpu = zones[zoneCount - 1].duration;
+
+        FrameStats stats = GetFrameStats();
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(SKYBLUE);
+
+            BeginMode3D(camera);
+
+                double startTime = GetTime();
+
+                rlBeginGpuZone("Terrain");
+                    DrawTerrain(terrain, camera, position, WHITE);
+                rlEndGpuZone();
+
+                drawTime = GetTime() - startTime;
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 330, 130, Fade(RAYWHITE, 0.8f));
+            DrawText(TextFormat("HEIGHTMAP [1,2,3]: %ix%i", heightmapSizes[current], heightmapSizes[current]), 20, 20, 20, DARKGRAY);
+            DrawText(TextFormat("FRAME: %.2f ms (p99: %.2f ms)", stats.p50*1000.0f, stats.p99*1000.0f), 20, 50, 20, DARKGRAY);
+            DrawText(TextFormat("DRAW CPU: %.3f ms", drawTime*1000.0), 20, 80, 20, DARKGRAY);
+            DrawText(TextFormat("DRAW GPU: %.3f ms", drawTimeGpu*1000.0), 20, 110, 20, DARKGRAY);
+
+            DrawFPS(screenWidth - 90, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTerrain(terrain);     // Unload terrain tiles (RAM and VRAM)
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
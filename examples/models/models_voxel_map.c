@@ -0,0 +1,137 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - voxel map
+*
+*   NOTE: Voxel map is drawn in chunks meshes with merged faces (greedy meshing),
+*   changed chunks are remeshed on worker threads while previous meshes keep drawing
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>                   // Required for: sinf(), cosf()
+
+#define MAP_WIDTH       128         // Voxel map width (X, voxels)
+#define MAP_HEIGHT       48         // Voxel map height (Y, voxels)
+#define MAP_LENGTH      128         // Voxel map length (Z, voxels)
+#define BRUSH_RADIUS      5         // Brush radius (voxels)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - voxel map");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 100.0f, 80.0f, 100.0f };      // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };              // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };                  // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                        // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;                     // Camera projection type
+
+    VoxelMap map = LoadVoxelMap(MAP_WIDTH, MAP_HEIGHT, MAP_LENGTH, 1.0f);
+
+    // Palette colors by height: sand, grass, rock and snow
+    map.palette[1] = BEIGE;
+    map.palette[2] = DARKGREEN;
+    map.palette[3] = GRAY;
+    map.palette[4] = RAYWHITE;
+
+    // Fill voxel map with hills
+    for (int z = 0; z < MAP_LENGTH; z++)
+    {
+        for (int x = 0; x < MAP_WIDTH; x++)
+        {
+            int height = (int)(16.0f + 10.0f*sinf(x*0.08f) + 12.0f*cosf(z*0.06f) + 4.0f*sinf((x + z)*0.2f));
+
+            for (int y = 0; (y < height) && (y < MAP_HEIGHT); y++)
+            {
+                unsigned char voxel = (y < 8)? 1 : (y < 24)? 2 : (y < 32)? 3 : 4;
+                SetVoxelMapVoxel(map, x, y, z, voxel);
+            }
+        }
+    }
+
+    Vector3 position = { -MAP_WIDTH/2.0f, 0.0f, -MAP_LENGTH/2.0f };   // Voxel map drawn centered
+    float brushAngle = 0.0f;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera, CAMERA_ORBITAL);
+
+        // Brush moving around map center digs (SPACE down) or builds (B down) voxels,
+        // only chunks touched by brush are remeshed
+        brushAngle += GetFrameTime();
+        int brushX = MAP_WIDTH/2 + (int)(40.0f*cosf(brushAngle));
+        int brushZ = MAP_LENGTH/2 + (int)(40.0f*sinf(brushAngle));
+        int brushY = 20;
+
+        if (IsKeyDown(KEY_SPACE) || IsKeyDown(KEY_B))
+        {
+            unsigned char voxel = IsKeyDown(KEY_SPACE)? 0 : 3;
+
+            for (int z = -BRUSH_RADIUS; z <= BRUSH_RADIUS; z++)
+            {
+                for (int y = -BRUSH_RADIUS; y <= BRUSH_RADIUS; y++)
+                {
+                    for (int x = -BRUSH_RADIUS; x <= BRUSH_RADIUS; x++)
+                    {
+                        if ((x*x + y*y + z*z) <= BRUSH_RADIUS*BRUSH_RADIUS) SetVoxelMapVoxel(map, brushX + x, brushY + y, brushZ + z, voxel);
+                    }
+                }
+            }
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(SKYBLUE);
+
+            BeginMode3D(camera);
+
+                DrawVoxelMap(map, position, WHITE);
+
+                DrawSphereWires((Vector3){ position.x + brushX + 0.5f, position.y + brushY + 0.5f, position.z + brushZ + 0.5f }, (float)BRUSH_RADIUS, 8, 8, MAROON);
+
+            EndMode3D();
+
+            DrawText("SPACE: dig - B: build", 10, 40, 20, DARKGRAY);
+            DrawText(TextFormat("%ix%ix%i voxels", MAP_WIDTH, MAP_HEIGHT, MAP_LENGTH), 10, 70, 20, DARKGRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadVoxelMap(map);        // Unload voxel map voxels and chunks meshes
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
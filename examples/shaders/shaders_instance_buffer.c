@@ -0,0 +1,146 @@
+/*******************************************************************************************
+*
+*   raylib [shaders] example - instance buffer
+*
+*   NOTE: Instance buffer is loaded once and kept on GPU, only animated instances are uploaded
+*   every frame; DrawMeshInstanced() uploads all instances on every call
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#define RLIGHTS_IMPLEMENTATION
+#include "rlights.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_RPI, PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#define MAX_INSTANCES       100000      // Instances drawn
+#define ANIMATED_INSTANCES    2000      // Instances updated every frame (first ones)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shaders] example - instance buffer");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ -125.0f, 125.0f, -125.0f };    // Camera position
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };              // Camera looking at point
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };                  // Camera up vector (rotation towards target)
+    camera.fovy = 45.0f;                                        // Camera field-of-view Y
+    camera.projection = CAMERA_PERSPECTIVE;                     // Camera projection type
+
+    Mesh cube = GenMeshCube(1.0f, 1.0f, 1.0f);
+
+    // Instances placed randomly, animated instances orbit around center
+    Matrix *transforms = (Matrix *)malloc(MAX_INSTANCES*sizeof(Matrix));
+
+    for (int i = 0; i < MAX_INSTANCES; i++)
+    {
+        transforms[i] = MatrixTranslate((float)GetRandomValue(-50, 50), (float)GetRandomValue(-50, 50), (float)GetRandomValue(-50, 50));
+    }
+
+    // Load instance buffer once, all instances uploaded
+    InstanceBuffer instances = LoadInstanceBuffer(MAX_INSTANCES, INSTANCE_FORMAT_MATRIX);
+    UpdateInstanceBuffer(instances, transforms, 0, MAX_INSTANCES);
+
+    // Load lighting shader, instance data is read from instanceTransform attribute (mat4)
+    Shader shader = LoadShader(TextFormat("resources/shaders/glsl%i/lighting_instancing.vs", GLSL_VERSION),
+                               TextFormat("resources/shaders/glsl%i/lighting.fs", GLSL_VERSION));
+    shader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(shader, "mvp");
+    shader.locs[SHADER_LOC_VECTOR_VIEW] = GetShaderLocation(shader, "viewPos");
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+
+    int ambientLoc = GetShaderLocation(shader, "ambient");
+    SetShaderValue(shader, ambientLoc, (float[4]){ 0.2f, 0.2f, 0.2f, 1.0f }, SHADER_UNIFORM_VEC4);
+
+    CreateLight(LIGHT_DIRECTIONAL, (Vector3){ 50.0f, 50.0f, 0.0f }, Vector3Zero(), WHITE, shader);
+
+    Material material = LoadMaterialDefault();
+    material.shader = shader;
+    material.maps[MATERIAL_MAP_DIFFUSE].color = RED;
+
+    bool useInstanceBuffer = true;
+    double drawTime = 0.0;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera, CAMERA_ORBITAL);
+
+        float cameraPos[3] = { camera.position.x, camera.position.y, camera.position.z };
+        SetShaderValue(shader, shader.locs[SHADER_LOC_VECTOR_VIEW], cameraPos, SHADER_UNIFORM_VEC3);
+
+        if (IsKeyPressed(KEY_SPACE)) useInstanceBuffer = !useInstanceBuffer;
+
+        // Animate first instances, only those are uploaded to instance buffer
+        Matrix rotation = MatrixRotateY(GetFrameTime());
+        for (int i = 0; i < ANIMATED_INSTANCES; i++) transforms[i] = MatrixMultiply(transforms[i], rotation);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            double startTime = GetTime();
+
+            BeginMode3D(camera);
+
+                if (useInstanceBuffer)
+                {
+                    UpdateInstanceBuffer(instances, transforms, 0, ANIMATED_INSTANCES);
+                    DrawMeshInstancedBuffer(cube, material, instances, 0, MAX_INSTANCES);
+                }
+                else DrawMeshInstanced(cube, material, transforms, MAX_INSTANCES);
+
+            EndMode3D();
+
+            drawTime = GetTime() - startTime;
+
+            DrawText(TextFormat("%s [SPACE]: %.2f ms (CPU)", useInstanceBuffer? "DrawMeshInstancedBuffer()" : "DrawMeshInstanced()", drawTime*1000.0), 10, 40, 20, MAROON);
+            DrawText(TextFormat("%i instances, %i animated", MAX_INSTANCES, ANIMATED_INSTANCES), 10, 70, 20, DARKGRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadInstanceBuffer(instances);    // Unload instance buffer (VRAM)
+    free(transforms);                   // Free transforms
+
+    CloseWindow();          // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
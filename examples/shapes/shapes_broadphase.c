@@ -0,0 +1,150 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - broadphase
+*
+*   NOTE: Broadphase reports overlapping boxes pairs, only those pairs are checked
+*   with narrow-phase collision functions (CheckCollisionCircles())
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>                 // Required for: malloc(), free()
+
+#define MAX_BALLS       10000       // Moving balls count
+
+typedef struct Ball {
+    Vector2 position;
+    Vector2 speed;
+    float radius;
+    int boxId;                      // Broadphase box id
+    bool colliding;
+} Ball;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - broadphase");
+
+    Ball *balls = (Ball *)malloc(MAX_BALLS*sizeof(Ball));
+
+    int type = BROADPHASE_GRID;
+    Broadphase2D broadphase = LoadBroadphase2D(type, 8.0f);
+
+    for (int i = 0; i < MAX_BALLS; i++)
+    {
+        balls[i].radius = (float)GetRandomValue(1, 3);
+        balls[i].position = (Vector2){ (float)GetRandomValue(10, screenWidth - 10), (float)GetRandomValue(50, screenHeight - 10) };
+        balls[i].speed = (Vector2){ (float)GetRandomValue(-60, 60), (float)GetRandomValue(-60, 60) };
+
+        Rectangle box = { balls[i].position.x - balls[i].radius, balls[i].position.y - balls[i].radius, balls[i].radius*2, balls[i].radius*2 };
+        balls[i].boxId = AddBroadphaseBox(broadphase, box, i);     // Ball index used as user id
+    }
+
+    int pairCount = 0;
+    int collisionCount = 0;
+    double updateTime = 0.0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Switch broadphase type, boxes are added again to new broadphase
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            UnloadBroadphase2D(broadphase);
+
+            type = (type == BROADPHASE_GRID)? BROADPHASE_TREE : BROADPHASE_GRID;
+            broadphase = LoadBroadphase2D(type, (type == BROADPHASE_GRID)? 8.0f : 2.0f);
+
+            for (int i = 0; i < MAX_BALLS; i++)
+            {
+                Rectangle box = { balls[i].position.x - balls[i].radius, balls[i].position.y - balls[i].radius, balls[i].radius*2, balls[i].radius*2 };
+                balls[i].boxId = AddBroadphaseBox(broadphase, box, i);
+            }
+        }
+
+        double startTime = GetTime();
+
+        // Move balls and update their boxes
+        for (int i = 0; i < MAX_BALLS; i++)
+        {
+            balls[i].position.x += balls[i].speed.x*GetFrameTime();
+            balls[i].position.y += balls[i].speed.y*GetFrameTime();
+
+            if ((balls[i].position.x < balls[i].radius) || (balls[i].position.x > (screenWidth - balls[i].radius))) balls[i].speed.x *= -1;
+            if ((balls[i].position.y < (40 + balls[i].radius)) || (balls[i].position.y > (screenHeight - balls[i].radius))) balls[i].speed.y *= -1;
+
+            balls[i].colliding = false;
+
+            Rectangle box = { balls[i].position.x - balls[i].radius, balls[i].position.y - balls[i].radius, balls[i].radius*2, balls[i].radius*2 };
+            UpdateBroadphaseBox(broadphase, balls[i].boxId, box);
+        }
+
+        // Check narrow-phase collision only for overlapping boxes pairs
+        BroadphasePair *pairs = GetBroadphasePairs(broadphase, &pairCount);
+        collisionCount = 0;
+
+        for (int i = 0; i < pairCount; i++)
+        {
+            Ball *a = &balls[pairs[i].a];
+            Ball *b = &balls[pairs[i].b];
+
+            if (CheckCollisionCircles(a->position, a->radius, b->position, b->radius))
+            {
+                a->colliding = true;
+                b->colliding = true;
+                collisionCount++;
+            }
+        }
+
+        updateTime = GetTime() - startTime;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            for (int i = 0; i < MAX_BALLS; i++) DrawCircleV(balls[i].position, balls[i].radius, balls[i].colliding? RED : DARKGRAY);
+
+            DrawRectangle(0, 0, screenWidth, 40, BLACK);
+            DrawText(TextFormat("%s: %i pairs, %i collisions, %.2f ms", (type == BROADPHASE_GRID)? "GRID" : "TREE", pairCount, collisionCount, updateTime*1000.0), 100, 10, 20, GREEN);
+            DrawText("SPACE: switch", 650, 10, 20, LIGHTGRAY);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadBroadphase2D(broadphase);     // Unload broadphase boxes
+
+    free(balls);                // Unload balls data array
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - rounded rectangles
+*
+*   NOTE: Circular shapes (rounded rectangles, rings, sectors, polygons) use cached unit arcs,
+*   so no sinf()/cosf() are computed per draw, this example draws 10k rounded rectangles per frame
+*   and measures the CPU time spent on the draw calls (tessellation into render batch)
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_RECTANGLES      10000       // Rounded rectangles drawn per frame
+#define TIME_SAMPLES        60          // Frames averaged for draw time measure
+
+// Rounded rectangle data
+typedef struct RoundedRec {
+    Rectangle rec;
+    float roundness;
+    Color color;
+} RoundedRec;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - rounded rectangles");
+
+    static RoundedRec recs[MAX_RECTANGLES] = { 0 };
+
+    for (int i = 0; i < MAX_RECTANGLES; i++)
+    {
+        float width = (float)GetRandomValue(10, 40);
+        float height = (float)GetRandomValue(10, 40);
+
+        recs[i].rec = (Rectangle){ (float)GetRandomValue(0, screenWidth - (int)width), (float)GetRandomValue(40, screenHeight - (int)height), width, height };
+        recs[i].roundness = (float)GetRandomValue(2, 10)/10.0f;
+        recs[i].color = (Color){ (unsigned char)GetRandomValue(100, 250), (unsigned char)GetRandomValue(60, 200), (unsigned char)GetRandomValue(80, 220), 255 };
+    }
+
+    int segments = 0;               // Corner segments, 0 computes them from corner radius
+    bool outlines = false;          // Draw outlines instead of filled rectangles
+
+    double timeSamples[TIME_SAMPLES] = { 0 };
+    int timeSampleIndex = 0;
+    double drawTime = 0.0;          // Average draw calls time (seconds)
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) outlines = !outlines;
+        if (IsKeyPressed(KEY_UP) && (segments < 32)) segments += 4;
+        if (IsKeyPressed(KEY_DOWN) && (segments > 0)) segments -= 4;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            // Measure draw calls only, render batch is flushed when full (included in measure)
+            double time = GetTime();
+
+            for (int i = 0; i < MAX_RECTANGLES; i++)
+            {
+                if (outlines) DrawRectangleRoundedLines(recs[i].rec, recs[i].roundness, segments, 1.0f, recs[i].color);
+                else DrawRectangleRounded(recs[i].rec, recs[i].roundness, segments, recs[i].color);
+            }
+
+            timeSamples[timeSampleIndex] = GetTime() - time;
+            timeSampleIndex = (timeSampleIndex + 1)%TIME_SAMPLES;
+
+            drawTime = 0.0;
+            for (int i = 0; i < TIME_SAMPLES; i++) drawTime += timeSamples[i];
+            drawTime /= TIME_SAMPLES;
+
+            DrawRectangle(0, 0, screenWidth, 40, Fade(BLACK, 0.8f));
+            DrawFPS(10, 10);
+            DrawText(TextFormat("%i %s: %.2f ms", MAX_RECTANGLES, outlines? "DrawRectangleRoundedLines()" : "DrawRectangleRounded()", drawTime*1000.0), 100, 10, 20, LIME);
+            DrawText(TextFormat("SPACE: outlines - UP/DOWN: segments (%s)", (segments == 0)? "auto" : TextFormat("%i", segments)), 560, 15, 10, RAYWHITE);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - vector paths
+*
+*   NOTE: Path stroke is tessellated once into a GPU vertex buffer (StrokePath2D()) and drawn
+*   anti-aliased in a single draw call (DrawPath2D()), it is only tessellated again on changes
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>                   // Required for: sinf()
+
+#define CHART_POINTS    20000       // Chart polyline points
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - vector paths");
+
+    const char *joinNames[3] = { "MITER", "BEVEL", "ROUND" };
+    const char *capNames[3] = { "BUTT", "SQUARE", "ROUND" };
+
+    int join = PATH_JOIN_MITER;
+    int cap = PATH_CAP_BUTT;
+    float thick = 24.0f;
+
+    // Shape path: lines and curves, stroked with selected join and cap
+    Path2D shape = LoadPath2D();
+    Vector2 end = { 700, 200 };
+    bool shapeChanged = true;
+
+    // Chart path: long polyline, stroked once
+    static Vector2 chartPoints[CHART_POINTS] = { 0 };
+
+    for (int i = 0; i < CHART_POINTS; i++)
+    {
+        float x = (float)i/(CHART_POINTS - 1);
+        chartPoints[i] = (Vector2){ 20.0f + x*760.0f, 380.0f + 30.0f*sinf(x*40.0f)*sinf(x*3.0f) + (float)GetRandomValue(-5, 5) };
+    }
+
+    Path2D chart = LoadPath2D();
+    PathMoveTo(chart, chartPoints[0]);
+    PathLineStrip(chart, &chartPoints[1], CHART_POINTS - 1);
+    StrokePath2D(chart, 1.5f, PATH_JOIN_BEVEL, PATH_CAP_BUTT);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_J)) { join = (join + 1)%3; shapeChanged = true; }
+        if (IsKeyPressed(KEY_C)) { cap = (cap + 1)%3; shapeChanged = true; }
+        if (IsKeyDown(KEY_UP) && (thick < 60.0f)) { thick += 0.5f; shapeChanged = true; }
+        if (IsKeyDown(KEY_DOWN) && (thick > 1.0f)) { thick -= 0.5f; shapeChanged = true; }
+
+        // Path end point follows mouse, path is rebuilt and stroked again when moved
+        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
+        {
+            end = GetMousePosition();
+            shapeChanged = true;
+        }
+
+        if (shapeChanged)
+        {
+            ClearPath2D(shape);
+            PathMoveTo(shape, (Vector2){ 80, 280 });
+            PathLineTo(shape, (Vector2){ 160, 100 });
+            PathLineTo(shape, (Vector2){ 240, 260 });
+            PathQuadraticTo(shape, (Vector2){ 320, 60 }, (Vector2){ 400, 240 });
+            PathCubicTo(shape, (Vector2){ 460, 320 }, (Vector2){ 560, 40 }, (Vector2){ 600, 180 });
+            PathLineTo(shape, end);
+            StrokePath2D(shape, thick, join, cap);
+
+            shapeChanged = false;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawPath2D(shape, Fade(MAROON, 0.6f));     // Translucent stroke, every pixel blended once
+            DrawPath2D(chart, DARKBLUE);
+
+            DrawText(TextFormat("JOIN [J]: %s - CAP [C]: %s - THICK [UP/DOWN]: %.1f", joinNames[join], capNames[cap], thick), 20, 20, 20, DARKGRAY);
+            DrawText(TextFormat("Chart: %i points, single draw call", CHART_POINTS), 20, 420, 10, GRAY);
+            DrawText("Drag mouse to move path end point", 520, 420, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadPath2D(shape);        // Unload path (points and stroke vertex buffer)
+    UnloadPath2D(chart);
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - particle system
+*
+*   NOTE: Particles are updated on CPU (SIMD) or on GPU with a compute shader (OpenGL 4.3),
+*   and all of them are drawn instanced in a single draw call; pool can be filled with 1M particles
+*   to measure update and drawing times (GPU update time only measures commands submission)
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_PARTICLES    1000000    // Particles pool capacity
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - particle system");
+
+    Texture2D spark = LoadTexture("resources/spark_flame.png");
+
+    int updateMode = PARTICLE_UPDATE_CPU;
+    ParticleSystem particles = LoadParticleSystem(MAX_PARTICLES, updateMode);
+
+    // Particles properties can be changed at any time, applied on update
+    particles.gravity = (Vector2){ 0.0f, 200.0f };
+    particles.startSize = 24.0f;
+    particles.endSize = 4.0f;
+    particles.startColor = ORANGE;
+    particles.endColor = Fade(RED, 0.0f);
+
+    int emitRate = 4000;            // Particles emitted per second
+    double updateTime = 0.0;        // Particles update time (seconds)
+    double drawTime = 0.0;          // Particles drawing time (seconds)
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Switch update mode, GPU update falls back to CPU if compute shaders are not available
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            ParticleSystem previous = particles;
+
+            updateMode = (updateMode == PARTICLE_UPDATE_CPU)? PARTICLE_UPDATE_GPU : PARTICLE_UPDATE_CPU;
+            particles = LoadParticleSystem(MAX_PARTICLES, updateMode);
+
+            particles.gravity = previous.gravity;
+            particles.startSize = previous.startSize;
+            particles.endSize = previous.endSize;
+            particles.startColor = previous.startColor;
+            particles.endColor = previous.endColor;
+
+            UnloadParticleSystem(previous);
+        }
+
+        if (IsKeyDown(KEY_UP) && (emitRate < 100000)) emitRate += 500;
+        if (IsKeyDown(KEY_DOWN) && (emitRate > 500)) emitRate -= 500;
+
+        // Benchmark: fill the whole pool with long-lived particles
+        if (IsKeyPressed(KEY_B)) EmitParticles(particles, (Vector2){ screenWidth/2.0f, screenHeight/2.0f }, (Vector2){ 0.0f, -250.0f }, 400.0f, 6.0f, MAX_PARTICLES);
+
+        EmitParticles(particles, GetMousePosition(), (Vector2){ 0.0f, -250.0f }, 150.0f, 2.0f, (int)(emitRate*GetFrameTime()));
+
+        double time = GetTime();
+        UpdateParticleSystem(particles, GetFrameTime());
+        updateTime = GetTime() - time;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(BLACK);
+
+            time = GetTime();
+            BeginBlendMode(BLEND_ADDITIVE);
+                DrawParticleSystem(particles, spark);
+            EndBlendMode();
+            drawTime = GetTime() - time;
+
+            DrawText(TextFormat("PARTICLES: %i - EMIT RATE [UP/DOWN]: %i/s", GetParticleCount(particles), emitRate), 10, 40, 20, RAYWHITE);
+            DrawText(TextFormat("UPDATE [SPACE]: %s", (updateMode == PARTICLE_UPDATE_CPU)? "CPU" : "GPU"), 10, 70, 20, RAYWHITE);
+            DrawText(TextFormat("UPDATE TIME: %.2f ms - DRAW TIME: %.2f ms", updateTime*1000.0, drawTime*1000.0), 10, 100, 20, RAYWHITE);
+            DrawText("Press [B] to fill pool with 1M particles", 10, 130, 20, RAYWHITE);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadParticleSystem(particles);    // Unload particles pool (RAM and VRAM)
+    UnloadTexture(spark);               // Unload particle texture
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
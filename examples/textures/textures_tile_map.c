@@ -0,0 +1,128 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - tile map
+*
+*   NOTE: Tile map is split in chunks baked into static vertex buffers, only chunks visible
+*   by camera are drawn and chunks are only rebuilt when their tiles change
+*
+*   Example originally created with raylib 4.6, last time updated with raylib 4.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2023 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAP_SIZE            1024    // Tile map width and height (tiles)
+#define TILE_SIZE             16    // Tile size (pixels)
+#define TILESET_COLUMNS        4    // Tileset tiles per row (and rows)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - tile map");
+
+    // Generate tileset texture, every tile is a framed color square
+    Image image = GenImageColor(TILE_SIZE*TILESET_COLUMNS, TILE_SIZE*TILESET_COLUMNS, BLANK);
+
+    for (int i = 0; i < TILESET_COLUMNS*TILESET_COLUMNS; i++)
+    {
+        Rectangle rec = { (float)(i%TILESET_COLUMNS)*TILE_SIZE, (float)(i/TILESET_COLUMNS)*TILE_SIZE, TILE_SIZE, TILE_SIZE };
+        ImageDrawRectangleRec(&image, rec, ColorFromHSV(i*360.0f/(TILESET_COLUMNS*TILESET_COLUMNS), 0.5f, 0.9f));
+        ImageDrawRectangleLines(&image, rec, 1, Fade(BLACK, 0.2f));
+    }
+
+    Texture2D tileset = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    // Load tile map (1M tiles) and fill it with a terrain-like pattern
+    TileMap map = LoadTileMap(tileset, TILE_SIZE, TILE_SIZE, MAP_SIZE, MAP_SIZE);
+
+    for (int y = 0; y < MAP_SIZE; y++)
+    {
+        for (int x = 0; x < MAP_SIZE; x++)
+        {
+            if (((x/8 + y/8)%5) != 0) SetTileMapTile(map, x, y, ((x/32)^(y/32))%(TILESET_COLUMNS*TILESET_COLUMNS));
+        }
+    }
+
+    Camera2D camera = { 0 };
+    camera.offset = (Vector2){ screenWidth/2.0f, screenHeight/2.0f };
+    camera.target = (Vector2){ MAP_SIZE*TILE_SIZE/2.0f, MAP_SIZE*TILE_SIZE/2.0f };
+    camera.zoom = 1.0f;
+
+    int paintTile = 0;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        float speed = 600.0f*GetFrameTime()/camera.zoom;
+
+        if (IsKeyDown(KEY_RIGHT)) camera.target.x += speed;
+        if (IsKeyDown(KEY_LEFT)) camera.target.x -= speed;
+        if (IsKeyDown(KEY_DOWN)) camera.target.y += speed;
+        if (IsKeyDown(KEY_UP)) camera.target.y -= speed;
+
+        camera.zoom += GetMouseWheelMove()*0.1f*camera.zoom;
+        if (camera.zoom < 0.1f) camera.zoom = 0.1f;
+        if (camera.zoom > 8.0f) camera.zoom = 8.0f;
+
+        if (IsKeyPressed(KEY_SPACE)) paintTile = (paintTile + 1)%(TILESET_COLUMNS*TILESET_COLUMNS);
+
+        // Paint tiles, only modified chunk is rebuilt
+        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsMouseButtonDown(MOUSE_BUTTON_RIGHT))
+        {
+            Vector2 world = GetScreenToWorld2D(GetMousePosition(), camera);
+            int tile = IsMouseButtonDown(MOUSE_BUTTON_LEFT)? paintTile : -1;
+
+            if ((world.x >= 0) && (world.y >= 0)) SetTileMapTile(map, (int)(world.x/TILE_SIZE), (int)(world.y/TILE_SIZE), tile);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(DARKGRAY);
+
+            BeginMode2D(camera);
+
+                DrawTileMap(map, camera, (Vector2){ 0, 0 }, WHITE);
+
+            EndMode2D();
+
+            DrawRectangle(0, 0, screenWidth, 40, Fade(BLACK, 0.6f));
+            DrawText(TextFormat("%ix%i tiles - ARROWS: move, WHEEL: zoom, MOUSE: paint/erase, SPACE: tile", MAP_SIZE, MAP_SIZE), 100, 14, 10, RAYWHITE);
+            DrawTextureRec(tileset, (Rectangle){ (float)(paintTile%TILESET_COLUMNS)*TILE_SIZE, (float)(paintTile/TILESET_COLUMNS)*TILE_SIZE, TILE_SIZE, TILE_SIZE }, (Vector2){ 760, 12 }, WHITE);
+
+            DrawFPS(10, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTileMap(map);         // Unload tile map tiles and chunks
+    UnloadTexture(tileset);     // Unload tileset texture
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -47,6 +47,8 @@
 #define SUPPORT_GESTURES_SYSTEM         1
 // Mouse gestures are directly mapped like touches and processed by gestures system
 #define SUPPORT_MOUSE_GESTURES          1
+// Particle system module is included (rparticles.h), particles updated on CPU (SIMD) or GPU (compute shader)
+#define SUPPORT_PARTICLE_SYSTEM         1
 // Reconfigure standard input to receive key inputs, works with SSH connection.
 #define SUPPORT_SSH_KEYBOARD_RPI        1
 // Setting a higher resolution can improve the accuracy of time-out intervals in wait functions.
@@ -55,6 +57,7 @@
 // Use busy wait loop for timing sync, if not defined, a high-resolution timer is set up and used
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
+// NOTE: Sleep time is adapted to measured system sleep overshoot, so only the residual time is busy waited
 #define SUPPORT_PARTIALBUSY_WAIT_LOOP
 // Wait for events passively (sleeping while no events) instead of polling them actively every frame
 //#define SUPPORT_EVENTS_WAITING          1
@@ -64,8 +67,18 @@
 #define SUPPORT_GIF_RECORDING           1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
-// Support automatic generated events, loading and recording of those events when required
+// Support automation events recording (F11) and playing (F9) hotkeys, defined in KeyCallback()
+// NOTE: Automation events API is always available, only hotkeys and on-screen indicator are disabled
 //#define SUPPORT_EVENTS_AUTOMATION       1
+// Support a pool of worker threads to run jobs asynchronously, used by async loading functions
+// NOTE: If not defined, jobs run synchronously, async loading functions are still available
+#define SUPPORT_JOB_SYSTEM              1
+// Support profile zones recording, raylib internal hot paths are also instrumented, exported as Chrome trace events
+// NOTE: If not defined, internal profile zones are removed at compile time
+//#define SUPPORT_PROFILER                1
+// Use SIMD intrinsics (SSE/NEON, selected at compile time) for raymath matrix and quaternion operations
+// NOTE: Results are bit-compatible with scalar code, unless compiler contracts scalar multiply-adds (FMA)
+//#define RAYMATH_SIMD                    1
 // Support custom frame control, only for advance users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -73,7 +86,6 @@
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
 #define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
 
 #define MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
@@ -87,6 +99,13 @@
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
 
+#define MAX_JOB_WORKERS                 8       // Maximum number of job worker threads
+#define MAX_JOB_QUEUE_SIZE           1024       // Maximum number of jobs in flight (queued, running or finishing)
+
+#define MAX_PROFILE_THREADS            16       // Maximum number of threads recording profile zones
+#define MAX_PROFILE_ZONES           16384       // Maximum number of recorded profile zones per thread (oldest are overwritten)
+#define MAX_PROFILE_ZONE_DEPTH         32       // Maximum profile zones nesting depth
+
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
@@ -107,6 +126,9 @@
 
 #define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
 
+#define RL_MAX_GPU_ZONES                     128      // Maximum number of GPU timer zones waiting for results
+#define RL_MAX_GPU_ZONE_DEPTH                 16      // Maximum GPU timer zones nesting depth
+
 #define RL_CULL_DISTANCE_NEAR               0.01      // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR              1000.0      // Default projection matrix far cull distance
 
@@ -137,6 +159,11 @@
 // Some lines-based shapes could still use lines
 #define SUPPORT_QUADS_DRAW_MODE         1
 
+// rshapes: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_SHAPES_ARC_CACHE           16       // Maximum number of unit arcs cached for circular shapes drawing
+#define MAX_SHAPES_ARC_SEGMENTS       256       // Maximum segments of a cached unit arc, longer arcs are computed on drawing
+
 
 //------------------------------------------------------------------------------------
 // Module: rtextures - Configuration Flags
@@ -166,6 +193,10 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define TILEMAP_CHUNK_SIZE             32       // Tile map chunk size (tiles per side), must be lower than 128 (16 bit indices)
+
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -232,6 +263,12 @@
 //------------------------------------------------------------------------------------
 // Standard file io library (stdio.h) included
 #define SUPPORT_STANDARD_FILEIO         1
+// Memory-mapped file loading, MapFileData() maps files read-only instead of copying them into heap memory
+// NOTE: Used by LoadImage(), LoadFontEx(), LoadModel() and LoadWave() to avoid file data copies
+#define SUPPORT_FILE_MAPPING            1
+// Pack files support: MountPackFile(), ExportPackFile(), files are loaded from an indexed archive with compressed entries
+// NOTE: Entries compression requires SUPPORT_COMPRESSION_API
+#define SUPPORT_PACK_FILES              1
 // Show TRACELOG() output messages
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
@@ -240,5 +277,6 @@
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MEM_FRAME_ARENA_SIZE      8388608       // Frame memory arena size per thread (8 MB, main thread and job workers), MemAllocFrame() allocations not fitting use heap memory
 
 #endif // CONFIG_H
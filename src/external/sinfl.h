@@ -128,7 +128,12 @@ struct sinfl {
   unsigned lits[SINFL_LIT_TBL_SIZE];
   unsigned dsts[SINFL_OFF_TBL_SIZE];
 };
+/* raylib: output buffer growth callback, reallocates output buffer to at least
+ * `need` bytes capacity, updates `cap` and returns new buffer (0 on failure) */
+typedef void *(*sinfl_grow_func)(void *out, int *cap, int need);
+
 extern int sinflate(void *out, int cap, const void *in, int size);
+extern int sinflate_grow(void **out, int *cap, const void *in, int size, sinfl_grow_func grow);
 extern int zsinflate(void *out, int cap, const void *in, int size);
 
 #ifdef __cplusplus
@@ -364,8 +369,19 @@ sinfl_decode(struct sinfl *s, const unsigned *tbl, int bit_len) {
   sinfl_eat(s, key & 0x0f);
   return (key >> 16) & 0x0fff;
 }
+/* raylib: output buffer too small, grow it (keeping decompressed data) or fail with -1 */
+#define SINFL_GROW(need) do {\
+    int pos_ = (int)(out - o);\
+    unsigned char *buf_ = 0;\
+    if (!grow) return -1;\
+    buf_ = (unsigned char*)grow(*outbuf, cap, pos_ + (need));\
+    if (!buf_) return -1;\
+    *outbuf = buf_;\
+    o = buf_, out = buf_ + pos_, oe = buf_ + *cap;\
+  } while (0)
+
 static int
-sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size) {
+sinfl_decompress(void **outbuf, int *cap, const unsigned char *in, int size, sinfl_grow_func grow) {
   static const unsigned char order[] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
   static const short dbase[30+2] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
       257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
@@ -376,7 +392,8 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
   static const unsigned char lbits[29+2] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,
       4,4,4,5,5,5,5,0,0,0};
 
-  const unsigned char *oe = out + cap;
+  unsigned char *out = (unsigned char*)*outbuf;
+  const unsigned char *oe = out + *cap;
   const unsigned char *e = in + size, *o = out;
   enum sinfl_states {hdr,stored,fixed,dyn,blk};
   enum sinfl_states state = hdr;
@@ -400,17 +417,22 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
     } break;
     case stored: {
       /* uncompressed block */
+      /* raylib: fixed stored block data position (bytes already loaded in bit buffer are rewound) */
       int len, nlen;
       sinfl_refill(&s);
       sinfl__get(&s,s.bitcnt & 7);
       len = sinfl__get(&s,16);
       nlen = sinfl__get(&s,16);
-      in -= 2; s.bitcnt = 0;
+      s.bitptr -= s.bitcnt >> 3;
+      s.bitbuf = 0; s.bitcnt = 0;
 
-      if (len > (e-in) || !len)
+      if (len != (~nlen & 0xffff) || len > (e-s.bitptr))
         return (int)(out-o);
-      memcpy(out, in, (size_t)len);
-      in += len, out += len;
+      if (len > (oe-out)) /* raylib: output buffer too small */
+        SINFL_GROW(len);
+      memcpy(out, s.bitptr, (size_t)len);
+      s.bitptr += len, out += len;
+      if (last) return (int)(out-o);
       state = hdr;
     } break;
     case fixed: {
@@ -462,12 +484,15 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         int sym = sinfl_decode(&s, s.lits, 10);
         if (sym < 256) {
           /* literal */
-          if (sinfl_unlikely(out >= oe)) {
-            return (int)(out-o);
+          if (sinfl_unlikely(out >= oe)) { /* raylib: output buffer too small */
+            SINFL_GROW(1);
           }
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) { /* raylib: output buffer too small */
+              SINFL_GROW(1);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -491,6 +516,10 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         if (sinfl_unlikely(offs > (int)(out-o))) {
           return (int)(out-o);
         }
+        if (sinfl_unlikely(len > (int)(oe-out))) { /* raylib: output buffer too small */
+          SINFL_GROW(len);
+          dst = out, src = out - offs;
+        }
         out = out + len;
 
 #ifndef SINFL_NO_SIMD
@@ -561,7 +590,13 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
 }
 extern int
 sinflate(void *out, int cap, const void *in, int size) {
-  return sinfl_decompress((unsigned char*)out, cap, (const unsigned char*)in, size);
+  /* raylib: returns -1 if output buffer is too small */
+  return sinfl_decompress(&out, &cap, (const unsigned char*)in, size, 0);
+}
+extern int
+sinflate_grow(void **out, int *cap, const void *in, int size, sinfl_grow_func grow) {
+  /* raylib: output buffer is grown on demand, decompression resumes on grown buffer */
+  return sinfl_decompress(out, cap, (const unsigned char*)in, size, grow);
 }
 static unsigned
 sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
@@ -595,8 +630,10 @@ zsinflate(void *out, int cap, const void *mem, int size) {
   const unsigned char *in = (const unsigned char*)mem;
   if (size >= 6) {
     const unsigned char *eob = in + size - 4;
-    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size);
-    unsigned a = sinfl_adler32(1u, (unsigned char*)out, n);
+    int n = sinfl_decompress(&out, &cap, in + 2u, size, 0);
+    unsigned a;
+    if (n < 0) return -1; /* raylib: output buffer too small */
+    a = sinfl_adler32(1u, (unsigned char*)out, n);
     unsigned h = eob[0] << 24 | eob[1] << 16 | eob[2] << 8 | eob[3] << 0;
     return a == h ? n : -1;
   } else {
@@ -44,6 +44,7 @@ revision history:
     1.02  (2021-09-10)  @raysan5: Reviewed some formating
     1.03  (2021-10-02)  @catmanl: Reduce warnings on gcc
     1.04  (2021-10-17)  @warzes: Fixing the error of loading VOX models
+    1.05  (2023-10-17)  Added Vox_LoadFromMemoryEx() to load voxels without building mesh arrays
 
 */
 
@@ -137,6 +138,7 @@ extern "C" {            // Prevents name mangling of functions
 
 // Functions
 int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArray3D* pvoxarray);
+int Vox_LoadFromMemoryEx(unsigned char* pvoxData, unsigned int voxDataSize, VoxArray3D* pvoxarray, int buildMesh);
 void Vox_FreeArrays(VoxArray3D* voxarray);
 
 #ifdef __cplusplus
@@ -529,6 +531,13 @@ static void Vox_Build_Voxel(VoxArray3D* pvoxArray, int x, int y, int z, int matI
 
 // MagicaVoxel *.vox file format Loader
 int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArray3D* pvoxarray)
+{
+	return Vox_LoadFromMemoryEx(pvoxData, voxDataSize, pvoxarray, 1);
+}
+
+// MagicaVoxel *.vox file format Loader, mesh arrays (one quad per visible voxel face) are only built if buildMesh is not 0
+// NOTE: Without mesh arrays, voxels are read with Vox_GetVoxel(), Vox_FreeArrays() still frees the loaded data
+int Vox_LoadFromMemoryEx(unsigned char* pvoxData, unsigned int voxDataSize, VoxArray3D* pvoxarray, int buildMesh)
 {
 	//////////////////////////////////////////////////
 	// Read VOX file
@@ -647,6 +656,8 @@ int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArr
 		}
 	}
 
+	if (buildMesh == 0) return VOX_SUCCESS;
+
 	//////////////////////////////////////////////////////////
 	// Building Mesh
 	//   TODO compute globals indices array
@@ -184,6 +184,10 @@ typedef struct tagBITMAPINFOHEADER {
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
     #endif
+    #ifndef PROFILE_ZONE_BEGIN
+        #define PROFILE_ZONE_BEGIN(name)    (void)0
+        #define PROFILE_ZONE_END()          (void)0
+    #endif
 
     // Allow custom memory allocators
     #ifndef RL_MALLOC
@@ -399,6 +403,16 @@ static AudioData AUDIO = {          // Global AUDIO context
     .mixedProcessor = NULL
 };
 
+#if !defined(RAUDIO_STANDALONE)
+// Wave/sound asynchronous loading job data
+typedef struct WaveLoadJob {
+    char *fileName;             // File name to load (copied after job data)
+    Wave wave;                  // Loaded wave (worker thread)
+    Wave *outWave;              // Destination wave, set on job finish (LoadWaveAsync())
+    Sound *outSound;            // Destination sound, set on job finish (LoadSoundAsync())
+} WaveLoadJob;
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
@@ -406,11 +420,19 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
 
+#if !defined(RAUDIO_STANDALONE)
+static unsigned int QueueWaveLoadJob(const char *fileName, Wave *wave, Sound *sound);  // Queue wave/sound async loading job
+static void WaveLoadJobWork(void *data);        // Wave loading job work, decode and convert wave (worker thread)
+static void WaveLoadJobFinish(void *data);      // Wave loading job finish, set wave or load sound (main thread)
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
 
 static unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead);     // Load file data as byte array (read)
+static unsigned char *MapFileData(const char *fileName, unsigned int *dataSize);       // Map file data (no file mapping on standalone mode, data is loaded)
+static void UnmapFileData(unsigned char *data, unsigned int dataSize);                 // Unmap file data
 static bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite); // Save data to file from byte array (write)
 static bool SaveFileText(const char *fileName, char *text);         // Save text data to file (write), string must be '\0' terminated
 #endif
@@ -728,18 +750,27 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
-    // Loading file to memory
+    // Mapping file to memory (read-only, no heap copy)
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    unsigned char *fileData = MapFileData(fileName, &fileSize);
 
     // Loading wave from memory data
     if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
-    RL_FREE(fileData);
+    UnmapFileData(fileData, fileSize);
 
     return wave;
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Load wave data from file asynchronously, returns job id
+// NOTE: Wave is decoded on a worker thread and set on main thread once job is done (IsJobDone())
+unsigned int LoadWaveAsync(const char *fileName, Wave *wave)
+{
+    return QueueWaveLoadJob(fileName, wave, NULL);
+}
+#endif
+
 // Load wave from memory buffer, fileType refers to extension: i.e. ".wav"
 // WARNING: File extension must be provided in lower-case
 Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
@@ -873,6 +904,16 @@ Sound LoadSound(const char *fileName)
     return sound;
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Load sound from file asynchronously, returns job id
+// NOTE: Wave is decoded and converted to device format on a worker thread,
+// sound is created and set on main thread once job is done (IsJobDone())
+unsigned int LoadSoundAsync(const char *fileName, Sound *sound)
+{
+    return QueueWaveLoadJob(fileName, NULL, sound);
+}
+#endif
+
 // Load sound from wave data
 // NOTE: Wave data must be unallocated manually
 Sound LoadSoundFromWave(Wave wave)
@@ -1762,6 +1803,8 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    PROFILE_ZONE_BEGIN("UpdateMusicStream");
+
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
     // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
@@ -1907,6 +1950,7 @@ void UpdateMusicStream(Music music)
             {
                 // Streaming is ending, we filled latest frames from input
                 StopMusicStream(music);
+                PROFILE_ZONE_END();
                 return;
             }
         }
@@ -1915,6 +1959,8 @@ void UpdateMusicStream(Music music)
     // NOTE: In case window is minimized, music stream is stopped,
     // just make sure to play again on window restore
     if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
+
+    PROFILE_ZONE_END();
 }
 
 // Check if any music is playing
@@ -2263,6 +2309,53 @@ void DetachAudioMixedProcessor(AudioCallback process)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+#if !defined(RAUDIO_STANDALONE)
+// Queue wave/sound async loading job
+// NOTE: File name is copied, destination wave/sound must be valid until job is done
+static unsigned int QueueWaveLoadJob(const char *fileName, Wave *wave, Sound *sound)
+{
+    int fileNameSize = (int)strlen(fileName) + 1;
+
+    WaveLoadJob *job = (WaveLoadJob *)RL_CALLOC(1, sizeof(WaveLoadJob) + fileNameSize);
+    job->fileName = (char *)job + sizeof(WaveLoadJob);
+    memcpy(job->fileName, fileName, fileNameSize);
+    job->outWave = wave;
+    job->outSound = sound;
+
+    return QueueJob(WaveLoadJobWork, WaveLoadJobFinish, job);
+}
+
+// Wave loading job work, decode and convert wave (worker thread)
+static void WaveLoadJobWork(void *data)
+{
+    WaveLoadJob *job = (WaveLoadJob *)data;
+
+    job->wave = LoadWave(job->fileName);
+
+    // Convert wave to device format, so LoadSoundFromWave() on main thread is just a copy
+    if ((job->outSound != NULL) && (job->wave.data != NULL) && AUDIO.System.isReady && (AUDIO_DEVICE_FORMAT == ma_format_f32))
+    {
+        WaveFormat(&job->wave, AUDIO.System.device.sampleRate, 32, AUDIO_DEVICE_CHANNELS);
+    }
+}
+
+// Wave loading job finish, set wave or load sound (main thread)
+static void WaveLoadJobFinish(void *data)
+{
+    WaveLoadJob *job = (WaveLoadJob *)data;
+
+    if (job->outSound != NULL)
+    {
+        *job->outSound = LoadSoundFromWave(job->wave);
+        UnloadWave(job->wave);
+    }
+    else if (job->outWave != NULL) *job->outWave = job->wave;
+    else UnloadWave(job->wave);
+
+    RL_FREE(job);
+}
+#endif
+
 // Log callback function
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
 {
@@ -2618,6 +2711,19 @@ static unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead
     return data;
 }
 
+// Map file data into memory
+// NOTE: On standalone mode, file data is just loaded into heap memory
+static unsigned char *MapFileData(const char *fileName, unsigned int *dataSize)
+{
+    return LoadFileData(fileName, dataSize);
+}
+
+// Unmap file data
+static void UnmapFileData(unsigned char *data, unsigned int dataSize)
+{
+    RL_FREE(data);
+}
+
 // Save data to file from buffer
 static bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite)
 {
@@ -506,6 +506,117 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// Frame time statistics (seconds)
+typedef struct FrameStats {
+    float average;                  // Frame time average
+    float min;                      // Frame time minimum
+    float max;                      // Frame time maximum
+    float p50;                      // Frame time 50th percentile (median)
+    float p90;                      // Frame time 90th percentile
+    float p99;                      // Frame time 99th percentile
+    int frameCount;                 // Number of frames registered in statistics history
+    int hitchCount;                 // Number of frame hitches (frames over 1.5x expected frame time)
+    float sleepOvershoot;           // Estimated system sleep overshoot, busy waited after sleeping
+} FrameStats;
+
+// Frame memory statistics (current thread scratch arena)
+typedef struct MemFrameStats {
+    unsigned int capacity;          // Arena capacity (bytes)
+    unsigned int used;              // Used memory, including heap allocations (bytes)
+    unsigned int peak;              // Peak used memory, including heap allocations (bytes)
+    unsigned int heapCount;         // Number of allocations not fitting in arena (heap allocated)
+} MemFrameStats;
+
+// Compressor, chunked data compression (DEFLATE)
+typedef struct Compressor {
+    int level;                      // Compression level: 0 (fastest) to 8 (best)
+    void *state;                    // Compressor internal state (compression context and history window)
+} Compressor;
+
+// Broadphase2D, boxes overlapping pairs detection
+typedef struct Broadphase2D {
+    int type;                       // Broadphase type (BroadphaseType)
+    void *state;                    // Broadphase internal state (boxes, grid cells or tree nodes, pairs)
+} Broadphase2D;
+
+// BroadphasePair, overlapping boxes pair
+typedef struct BroadphasePair {
+    int a;                          // First box user id
+    int b;                          // Second box user id
+} BroadphasePair;
+
+// BoxTree, dynamic bounding volume hierarchy for boxes overlap and ray queries
+typedef struct BoxTree {
+    float margin;                   // Boxes bounds margin, boxes moving inside it do not update tree
+    void *state;                    // Box tree internal state (boxes and nodes)
+} BoxTree;
+
+// Path2D, vector path for anti-aliased strokes drawing
+typedef struct Path2D {
+    float tolerance;                // Curves flattening tolerance (maximum distance to curve)
+    void *state;                    // Path internal state (points, stroke vertices and GPU buffers)
+} Path2D;
+
+// DisplayList, drawing recorded once and replayed from GPU vertex buffers
+typedef struct DisplayList {
+    int vertexCount;                // Recorded vertex count
+    int drawCount;                  // Recorded draw calls count (one per texture or mode change)
+    void *state;                    // Display list internal state (rlgl display list: draw calls and GPU buffers)
+} DisplayList;
+
+// TileMap, tile layer drawn in chunks from static vertex buffers
+typedef struct TileMap {
+    int width;                      // Tile map width (tiles)
+    int height;                     // Tile map height (tiles)
+    int tileWidth;                  // Tile width (tileset pixels, world units)
+    int tileHeight;                 // Tile height (tileset pixels, world units)
+    Texture2D tileset;              // Tileset texture, tiles indexed by rows
+    int *tiles;                     // Tiles tileset index (width*height), -1 for empty tiles
+    void *state;                    // Tile map internal state (chunks vertex buffers)
+} TileMap;
+
+// ParticleSystem, particles pool updated on CPU (SIMD) or GPU (compute shader) and drawn instanced
+// NOTE: Gravity, size and colors can be changed at any time, they are applied on update
+typedef struct ParticleSystem {
+    int capacity;                   // Particles pool capacity (maximum alive particles)
+    Vector2 gravity;                // Particles acceleration (world units/seconds^2)
+    float startSize;                // Particle size when emitted
+    float endSize;                  // Particle size at end of life
+    Color startColor;               // Particle color when emitted
+    Color endColor;                 // Particle color at end of life
+    void *state;                    // Particle system internal state (particles data arrays and GPU buffers)
+} ParticleSystem;
+
+// InstanceBuffer, persistent GPU buffer with per-instance data for instanced mesh drawing
+typedef struct InstanceBuffer {
+    unsigned int id;                // OpenGL vertex buffer id
+    int format;                     // Instances data format (InstanceFormat)
+    int capacity;                   // Buffer capacity (instances)
+    int head;                       // Streaming write position (instances), used by StreamInstanceBuffer()
+} InstanceBuffer;
+
+// VoxelMap, voxel volume drawn in chunks meshes, chunks remeshed on worker threads when voxels change
+// NOTE: Voxels are indexed as voxels[(z*height + y)*width + x], palette colors are applied on chunks remesh
+typedef struct VoxelMap {
+    int width;                      // Voxel map width (X, voxels)
+    int height;                     // Voxel map height (Y, voxels)
+    int length;                     // Voxel map length (Z, voxels)
+    float voxelSize;                // Voxel size (world units)
+    unsigned char *voxels;          // Voxels palette index (width*height*length), 0 for empty voxels
+    Color *palette;                 // Voxels colors palette (256 colors, color 0 not used)
+    void *state;                    // Voxel map internal state (chunks meshes)
+} VoxelMap;
+
+// Terrain, heightmap tiles drawn with chunked LOD, heights sampled from height textures in vertex shader
+// NOTE: Streamed terrain tiles are loaded on worker threads when camera gets closer than stream distance
+typedef struct Terrain {
+    Vector3 tileSize;               // Terrain tile size (world units), tile heights [0..1] are scaled by tileSize.y
+    int tileCountX;                 // Terrain tiles count along X axis
+    int tileCountZ;                 // Terrain tiles count along Z axis
+    float streamDistance;           // Tiles streaming distance (world units), 0.0f keeps all tiles loaded
+    void *state;                    // Terrain internal state (tiles heights, LOD quadtrees and GPU data)
+} Terrain;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -911,13 +1022,49 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Broadphase type
+typedef enum {
+    BROADPHASE_GRID = 0,            // Uniform grid (spatial hash), boxes of similar size
+    BROADPHASE_TREE                 // Dynamic AABB tree, boxes of varying size
+} BroadphaseType;
+
+// Path stroke join
+typedef enum {
+    PATH_JOIN_MITER = 0,            // Sharp corner, bevel if longer than miter limit
+    PATH_JOIN_BEVEL,                // Cut corner
+    PATH_JOIN_ROUND                 // Rounded corner
+} PathJoin;
+
+// Path stroke cap
+typedef enum {
+    PATH_CAP_BUTT = 0,              // Stroke ends at path end point
+    PATH_CAP_SQUARE,                // Stroke extends half thickness over path end point
+    PATH_CAP_ROUND                  // Stroke ends with half circle
+} PathCap;
+
+// Particle system update mode
+typedef enum {
+    PARTICLE_UPDATE_CPU = 0,        // Particles updated on CPU (SIMD if enabled)
+    PARTICLE_UPDATE_GPU             // Particles updated on GPU with compute shader (requires OpenGL 4.3)
+} ParticleUpdateMode;
+
+// Instance buffer data format
+// NOTE: Instance data is read from shader attribute SHADER_LOC_MATRIX_MODEL (matrix type, consecutive locations)
+typedef enum {
+    INSTANCE_FORMAT_MATRIX = 0,     // Matrix (64 bytes), shader attribute: mat4 (columns)
+    INSTANCE_FORMAT_MATRIX_3X4,     // Matrix first three rows (48 bytes), shader attribute: mat3x4 (rows)
+    INSTANCE_FORMAT_TRANSFORM       // Transform, translation + uniform scale (scale.x) and rotation (32 bytes), shader attribute: mat2x4
+} InstanceFormat;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advance users
+// WARNING: LoadFileDataCallback is also called from job worker threads (Load*Async() functions), it must be thread-safe
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
 typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, unsigned int *bytesRead);      // FileIO: Load binary data
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, unsigned int bytesToWrite);  // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef void (*JobCallback)(void *data);                                // Jobs: Job work (worker thread) or finish (main thread) step
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1014,6 +1161,14 @@ RLAPI void EndScissorMode(void);                                  // End scissor
 RLAPI void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
 RLAPI void EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
 
+// Display list functions
+// NOTE: Display lists are not available on OpenGL 1.1
+RLAPI void BeginDisplayList(void);                                // Begin recording drawing into a display list
+RLAPI DisplayList EndDisplayList(void);                           // End recording, returns display list loaded into GPU
+RLAPI void UnloadDisplayList(DisplayList list);                   // Unload display list from GPU memory (VRAM)
+RLAPI void DrawDisplayList(DisplayList list, Vector2 position, Color tint); // Draw display list at position with tint
+RLAPI void DrawDisplayListEx(DisplayList list, Vector2 position, float rotation, float scale, Color tint); // Draw display list with extended parameters
+
 // VR stereo config functions for VR simulator
 RLAPI VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device);     // Load VR stereo config for VR simulator device parameters
 RLAPI void UnloadVrStereoConfig(VrStereoConfig config);           // Unload VR stereo config
@@ -1044,12 +1199,26 @@ RLAPI Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera); // Get the
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
 RLAPI int GetFPS(void);                                           // Get current FPS
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
+RLAPI FrameStats GetFrameStats(void);                             // Get frame time statistics (percentiles, hitches) from last frames
+RLAPI void ResetFrameStats(void);                                 // Reset frame time statistics
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 
 // Misc. functions
 RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
 RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void StartScreenRecording(const char *fileName);            // Start screen recording into file (.gif or raw RGBA video frames)
+RLAPI void StopScreenRecording(void);                             // Stop screen recording and save file
+
+// Automation events functions
+RLAPI void StartAutomationEventRecording(void);                   // Start recording automation events (input state changes), previous events are discarded
+RLAPI void StopAutomationEventRecording(void);                    // Stop recording automation events
+RLAPI bool ExportAutomationEvents(const char *fileName);          // Export recorded automation events into a binary file
+RLAPI bool LoadAutomationEvents(const char *fileName);            // Load automation events from a binary file, ready to be played
+RLAPI void PlayAutomationEvents(float timeStep);                  // Start playing automation events, fixed time step replays faster than real time (0 for recorded frame times)
+RLAPI void StopAutomationEventPlaying(void);                      // Stop playing automation events
+RLAPI bool IsAutomationEventRecording(void);                      // Check if automation events are being recorded
+RLAPI bool IsAutomationEventPlaying(void);                        // Check if automation events are being played
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 
 RLAPI void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
@@ -1057,6 +1226,11 @@ RLAPI void SetTraceLogLevel(int logLevel);                        // Set the cur
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void *MemAllocFrame(unsigned int size);                     // Frame memory allocator (current thread scratch arena), valid until freed or frame end
+RLAPI void MemFreeFrame(void *ptr);                               // Frame memory free (allocating thread only), arena space is reused in stack order
+RLAPI void ResetMemFrame(void);                                   // Reset current thread frame memory (called by EndDrawing() on main thread)
+RLAPI MemFrameStats GetMemFrameStats(void);                       // Get current thread frame memory stats (peak usage, heap allocations)
+RLAPI void UnloadMemFrame(void);                                  // Unload current thread frame memory (required before exiting user threads using it)
 
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1071,11 +1245,16 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead);       // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI unsigned char *MapFileData(const char *fileName, unsigned int *dataSize);         // Map file data read-only into memory (no heap copy, lazily loaded)
+RLAPI void UnmapFileData(unsigned char *data, unsigned int dataSize); // Unmap file data mapped by MapFileData()
 RLAPI bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite);   // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, unsigned int size, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
 RLAPI void UnloadFileText(char *text);                            // Unload file text data allocated by LoadFileText()
 RLAPI bool SaveFileText(const char *fileName, char *text);        // Save text data to file (write), string must be '\0' terminated, returns true on success
+RLAPI bool MountPackFile(const char *fileName, const char *mountPath); // Mount pack file, files under mountPath are loaded from pack entries (chains file data/text load callbacks)
+RLAPI void UnmountPackFile(void);                                 // Unmount pack file, files are loaded from disk
+RLAPI bool ExportPackFile(const char *fileName, const char *dirPath); // Export directory files (recursive) into a pack file, returns true on success
 RLAPI bool FileExists(const char *fileName);                      // Check if file exists
 RLAPI bool DirectoryExists(const char *dirPath);                  // Check if a directory path exists
 RLAPI bool IsFileExtension(const char *fileName, const char *ext); // Check file extension (including point: .png, .wav)
@@ -1099,10 +1278,25 @@ RLAPI long GetFileModTime(const char *fileName);                  // Get file mo
 
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI unsigned char *CompressDataEx(const unsigned char *data, int dataSize, int *compDataSize, int level); // Compress data (DEFLATE algorithm) with level (0..8), multithreaded, memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI Compressor LoadCompressor(int level);                                                           // Load compressor for chunked data compression (DEFLATE algorithm), level: 0..8
+RLAPI void UnloadCompressor(Compressor compressor);                                                   // Unload compressor
+RLAPI unsigned char *CompressDataChunk(Compressor compressor, const unsigned char *data, int dataSize, bool last, int *compDataSize); // Compress data chunk, consecutive chunks form a DEFLATE stream, memory must be MemFree()
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
 
+// Job system functionality (asynchronous work on worker threads)
+RLAPI unsigned int QueueJob(JobCallback work, JobCallback finish, void *data); // Queue job, work runs on a worker thread and finish (optional) on main thread (EndDrawing), returns job id
+RLAPI bool IsJobDone(unsigned int jobId);                         // Check if a job is done (work and finish steps completed)
+RLAPI void WaitJob(unsigned int jobId);                           // Wait for a job to be done, finish step runs on calling thread (main thread only)
+RLAPI void SetJobFinishBudget(float seconds);                     // Set main thread time budget per frame for jobs finish steps (GPU uploads)
+
+// Profiler functionality (CPU profile zones, per thread)
+RLAPI void BeginProfileZone(const char *name);                    // Begin a profile zone on current thread (name must be a static string)
+RLAPI void EndProfileZone(void);                                  // End last profile zone begun on current thread
+RLAPI bool ExportProfileTrace(const char *fileName);              // Export recorded profile zones as Chrome trace events JSON file
+
 //------------------------------------------------------------------------------------
 // Input Handling Functions (Module: core)
 //------------------------------------------------------------------------------------
@@ -1216,6 +1410,20 @@ RLAPI void DrawPoly(Vector2 center, int sides, float radius, float rotation, Col
 RLAPI void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color);          // Draw a polygon outline of n sides
 RLAPI void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color); // Draw a polygon outline of n sides with extended parameters
 
+// Path (vector shapes) functions
+RLAPI Path2D LoadPath2D(void);                                                                           // Load path, curves flattened with default tolerance
+RLAPI void UnloadPath2D(Path2D path);                                                                    // Unload path (points and stroke GPU buffers)
+RLAPI void ClearPath2D(Path2D path);                                                                     // Clear path points, last stroke is kept
+RLAPI void PathMoveTo(Path2D path, Vector2 point);                                                       // Begin a new sub-path at point
+RLAPI void PathLineTo(Path2D path, Vector2 point);                                                       // Add line from current point to point
+RLAPI void PathLineStrip(Path2D path, const Vector2 *points, int pointCount);                             // Add lines from current point through points
+RLAPI void PathQuadraticTo(Path2D path, Vector2 control, Vector2 point);                                 // Add quadratic bezier curve from current point to point
+RLAPI void PathCubicTo(Path2D path, Vector2 control1, Vector2 control2, Vector2 point);                   // Add cubic bezier curve from current point to point
+RLAPI void PathArc(Path2D path, Vector2 center, float radius, float startAngle, float endAngle);          // Add circle arc (angles in degrees), line from current point to arc start
+RLAPI void PathClose(Path2D path);                                                                       // Close current sub-path
+RLAPI void StrokePath2D(Path2D path, float thick, int join, int cap);                                    // Tessellate path stroke and upload it to GPU (PathJoin, PathCap)
+RLAPI void DrawPath2D(Path2D path, Color color);                                                         // Draw path stroke (anti-aliased, single draw call)
+
 // Basic shapes collision detection functions
 RLAPI bool CheckCollisionRecs(Rectangle rec1, Rectangle rec2);                                           // Check collision between two rectangles
 RLAPI bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2);        // Check collision between two circles
@@ -1228,6 +1436,15 @@ RLAPI bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 start
 RLAPI bool CheckCollisionPointLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold);                // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
 RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
 
+// Broadphase collision detection functions
+RLAPI Broadphase2D LoadBroadphase2D(int type, float cellSize);                                          // Load broadphase, cellSize: grid cell size (BROADPHASE_GRID) or boxes margin (BROADPHASE_TREE)
+RLAPI void UnloadBroadphase2D(Broadphase2D broadphase);                                                 // Unload broadphase
+RLAPI int AddBroadphaseBox(Broadphase2D broadphase, Rectangle box, int userId);                         // Add box to broadphase, returns box id
+RLAPI void UpdateBroadphaseBox(Broadphase2D broadphase, int boxId, Rectangle box);                      // Update box bounds
+RLAPI void RemoveBroadphaseBox(Broadphase2D broadphase, int boxId);                                     // Remove box from broadphase
+RLAPI BroadphasePair *GetBroadphasePairs(Broadphase2D broadphase, int *pairCount);                      // Get overlapping boxes pairs (user ids), array owned by broadphase
+RLAPI int GetBroadphaseBoxesRec(Broadphase2D broadphase, Rectangle rec, int *userIds, int maxCount);    // Get boxes overlapping rectangle (user ids), returns boxes count
+
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
 //------------------------------------------------------------------------------------
@@ -1235,6 +1452,7 @@ RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);
 // Image loading functions
 // NOTE: These functions do not require GPU access
 RLAPI Image LoadImage(const char *fileName);                                                             // Load image from file into CPU memory (RAM)
+RLAPI unsigned int LoadImageAsync(const char *fileName, Image *image);                                   // Load image from file into CPU memory (RAM) asynchronously, image is set once job is done, returns job id
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
@@ -1315,6 +1533,7 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // Texture loading functions
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
+RLAPI unsigned int LoadTextureAsync(const char *fileName, Texture2D *texture);                           // Load texture from file into GPU memory (VRAM) asynchronously, texture is set once job is done, returns job id
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
@@ -1338,6 +1557,23 @@ RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position,
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
 
+// Tile map functions
+// NOTE: Every tile map is one layer, tiles must be modified with SetTileMapTile() to rebuild chunks
+RLAPI TileMap LoadTileMap(Texture2D tileset, int tileWidth, int tileHeight, int width, int height);      // Load tile map (all tiles empty), tileset is not unloaded with tile map
+RLAPI void UnloadTileMap(TileMap map);                                                                   // Unload tile map tiles and chunks from memory (RAM and VRAM)
+RLAPI void SetTileMapTile(TileMap map, int x, int y, int tile);                                          // Set tile map tile (tileset tile index, -1 for empty)
+RLAPI int GetTileMapTile(TileMap map, int x, int y);                                                     // Get tile map tile (tileset tile index, -1 for empty)
+RLAPI void DrawTileMap(TileMap map, Camera2D camera, Vector2 position, Color tint);                      // Draw tile map chunks visible by camera
+
+// Particle system functions
+// NOTE: Particles are 2D quads, drawn with current matrices (i.e. inside BeginMode2D())
+RLAPI ParticleSystem LoadParticleSystem(int capacity, int updateMode);                                   // Load particle system with particles pool capacity (ParticleUpdateMode)
+RLAPI void UnloadParticleSystem(ParticleSystem system);                                                  // Unload particle system from memory (RAM and VRAM)
+RLAPI void EmitParticles(ParticleSystem system, Vector2 position, Vector2 velocity, float spread, float lifetime, int count); // Emit particles, velocity randomly varied by spread
+RLAPI void UpdateParticleSystem(ParticleSystem system, float deltaTime);                                 // Update particles (move, age, interpolate size and color), remove dead particles
+RLAPI void DrawParticleSystem(ParticleSystem system, Texture2D texture);                                 // Draw particles with texture (white quads if texture id is 0)
+RLAPI int GetParticleCount(ParticleSystem system);                                                       // Get particle system particles count
+
 // Color/pixel related functions
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
 RLAPI int ColorToInt(Color color);                                          // Get hexadecimal value for a Color
@@ -1363,6 +1599,7 @@ RLAPI int GetPixelDataSize(int width, int height, int format);              // G
 RLAPI Font GetFontDefault(void);                                                            // Get the default Font
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCount);  // Load font from file with extended parameters, use NULL for fontChars and 0 for glyphCount to load the default character set
+RLAPI unsigned int LoadFontAsync(const char *fileName, int fontSize, int *fontChars, int glyphCount, Font *font); // Load font from file with extended parameters asynchronously, font is set once job is done, returns job id
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
@@ -1470,6 +1707,11 @@ RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI InstanceBuffer LoadInstanceBuffer(int capacity, int format);                          // Load instance buffer for instanced drawing (InstanceFormat)
+RLAPI void UnloadInstanceBuffer(InstanceBuffer buffer);                                      // Unload instance buffer from GPU memory (VRAM)
+RLAPI void UpdateInstanceBuffer(InstanceBuffer buffer, const void *data, int offset, int count); // Update instance buffer instances (Matrix or Transform data, by format)
+RLAPI int StreamInstanceBuffer(InstanceBuffer *buffer, const void *data, int count);         // Stream instances into buffer (ring, orphaned when full), returns first instance written
+RLAPI void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int first, int count); // Draw multiple mesh instances with material and instance buffer data
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
@@ -1484,7 +1726,7 @@ RLAPI Mesh GenMeshCylinder(float radius, float height, int slices);
 RLAPI Mesh GenMeshCone(float radius, float height, int slices);                             // Generate cone/pyramid mesh
 RLAPI Mesh GenMeshTorus(float radius, float size, int radSeg, int sides);                   // Generate torus mesh
 RLAPI Mesh GenMeshKnot(float radius, float size, int radSeg, int sides);                    // Generate trefoil knot mesh
-RLAPI Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                 // Generate heightmap mesh from image data
+RLAPI Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                 // Generate heightmap mesh from image data (smooth normals, indexed up to 65536 pixels)
 RLAPI Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);                               // Generate cubes-based map mesh from image data
 
 // Material loading/unloading functions
@@ -1512,6 +1754,31 @@ RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
+// Box tree functions (dynamic bounding volume hierarchy)
+RLAPI BoxTree LoadBoxTree(float margin);                                                    // Load box tree, boxes moving inside margin do not update tree
+RLAPI void UnloadBoxTree(BoxTree tree);                                                     // Unload box tree
+RLAPI int AddBoxTreeBox(BoxTree tree, BoundingBox box, int userId);                         // Add box to tree, returns box id
+RLAPI void UpdateBoxTreeBox(BoxTree tree, int boxId, BoundingBox box);                      // Update box bounds
+RLAPI void RemoveBoxTreeBox(BoxTree tree, int boxId);                                       // Remove box from tree
+RLAPI int GetBoxTreeBoxes(BoxTree tree, BoundingBox box, int *userIds, int maxCount);       // Get boxes overlapping box (user ids), returns boxes count
+RLAPI int GetBoxTreeBoxesSphere(BoxTree tree, Vector3 center, float radius, int *userIds, int maxCount); // Get boxes overlapping sphere (user ids), returns boxes count
+RLAPI RayCollision GetRayCollisionBoxTree(BoxTree tree, Ray ray, int *userId);              // Get collision info between ray and closest tree box, returns box user id
+RLAPI int GetRayCollisionBoxTreeArray(BoxTree tree, const Ray *rays, int rayCount, RayCollision *collisions, int *userIds); // Get collision info between rays and closest tree boxes, returns hits count
+
+// Voxel map functions (chunks meshed with greedy quads merging)
+RLAPI VoxelMap LoadVoxelMap(int width, int height, int length, float voxelSize);            // Load voxel map, all voxels empty, palette initialized to white
+RLAPI void UnloadVoxelMap(VoxelMap map);                                                    // Unload voxel map voxels and chunks meshes
+RLAPI void SetVoxelMapVoxel(VoxelMap map, int x, int y, int z, unsigned char voxel);        // Set voxel map voxel (palette index, 0 for empty voxel)
+RLAPI unsigned char GetVoxelMapVoxel(VoxelMap map, int x, int y, int z);                    // Get voxel map voxel (palette index, 0 for empty or out of bounds voxel)
+RLAPI void DrawVoxelMap(VoxelMap map, Vector3 position, Color tint);                        // Draw voxel map chunks, changed chunks are remeshed asynchronously
+
+// Terrain functions (chunked LOD, requires OpenGL 3.3)
+RLAPI Terrain LoadTerrain(Image heightmap, Vector3 size);                                   // Load terrain from heightmap image (single tile)
+RLAPI Terrain LoadTerrainTiles(const char *fileNameFormat, int tileCountX, int tileCountZ, Vector3 tileSize); // Load terrain streamed from heightmap tiles files (file name format with tile x and z)
+RLAPI void UnloadTerrain(Terrain terrain);                                                  // Unload terrain tiles from memory (RAM and VRAM)
+RLAPI void DrawTerrain(Terrain terrain, Camera camera, Vector3 position, Color tint);        // Draw terrain visible chunks with LOD, tiles are streamed around camera
+RLAPI float GetTerrainHeight(Terrain terrain, float x, float z);                            // Get terrain height at position (terrain space), 0.0f for tiles not loaded
+
 //------------------------------------------------------------------------------------
 // Audio Loading and Playing Functions (Module: audio)
 //------------------------------------------------------------------------------------
@@ -1525,9 +1792,11 @@ RLAPI void SetMasterVolume(float volume);                             // Set mas
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
+RLAPI unsigned int LoadWaveAsync(const char *fileName, Wave *wave);  // Load wave data from file asynchronously, wave is set once job is done, returns job id
 RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
 RLAPI bool IsWaveReady(Wave wave);                                    // Checks if wave data is ready
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
+RLAPI unsigned int LoadSoundAsync(const char *fileName, Sound *sound); // Load sound from file asynchronously, sound is set once job is done, returns job id
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
 RLAPI bool IsSoundReady(Sound sound);                                 // Checks if a sound is ready
 RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
@@ -11,7 +11,8 @@
 *       Example: In memory order, row0 is [m0 m4 m8 m12] but in semantic math row0 is [m0 m1 m2 m3]
 *     - Functions are always self-contained, no function use another raymath function inside,
 *       required code is directly re-implemented inside
-*     - Functions input parameters are always received by value (2 unavoidable exceptions)
+*     - Functions input parameters are always received by value (2 unavoidable exceptions),
+*       except batch functions (*Array), that process arrays of values received by pointer
 *     - Functions use always a "result" variable for return
 *     - Functions are always defined inline
 *     - Angles are always in radians (DEG2RAD/RAD2DEG macros provided for convenience)
@@ -26,6 +27,14 @@
 *           Define static inline functions code, so #include header suffices for use.
 *           This may use up lots of memory.
 *
+*       #define RAYMATH_SIMD
+*           Use SIMD intrinsics for MatrixMultiply() and Vector3BoundsArray(), instruction set is selected
+*           at compile time: SSE (x86, x64) or NEON (ARM), scalar code is used if none is available.
+*           Other functions are kept scalar, compilers already vectorize them or packing Vector3/Quaternion
+*           values into 4-floats registers costs more than it saves (check examples/core/core_raymath_simd.c)
+*           NOTE: Operations are performed in the same order than scalar code, so results are bit-compatible,
+*           unless compiler contracts scalar code multiply-adds into FMA instructions (i.e. -mfma)
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -164,6 +173,42 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabs()
 
+// SIMD instruction set selection and 4-floats vector operations
+// NOTE: Vectors are loaded/stored unaligned, raymath types do not require alignment
+#if defined(RAYMATH_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>  // Required for: SSE intrinsics
+        #define RAYMATH_SIMD_SSE
+        typedef __m128 rmFloat4;
+        #define RM_LOAD4(ptr)           _mm_loadu_ps(ptr)
+        #define RM_STORE4(ptr, v)       _mm_storeu_ps(ptr, v)
+        #define RM_SET4(x, y, z, w)     _mm_setr_ps(x, y, z, w)
+        #define RM_SPLAT4(x)            _mm_set1_ps(x)
+        #define RM_ADD4(a, b)           _mm_add_ps(a, b)
+        #define RM_SUB4(a, b)           _mm_sub_ps(a, b)
+        #define RM_MUL4(a, b)           _mm_mul_ps(a, b)
+        #define RM_MIN4(a, b)           _mm_min_ps(a, b)
+        #define RM_MAX4(a, b)           _mm_max_ps(a, b)
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>   // Required for: NEON intrinsics
+        #define RAYMATH_SIMD_NEON
+        typedef float32x4_t rmFloat4;
+        #define RM_LOAD4(ptr)           vld1q_f32(ptr)
+        #define RM_STORE4(ptr, v)       vst1q_f32(ptr, v)
+        #define RM_SET4(x, y, z, w)     vsetq_lane_f32(w, vsetq_lane_f32(z, vsetq_lane_f32(y, vdupq_n_f32(x), 1), 2), 3)
+        #define RM_SPLAT4(x)            vdupq_n_f32(x)
+        #define RM_ADD4(a, b)           vaddq_f32(a, b)
+        #define RM_SUB4(a, b)           vsubq_f32(a, b)
+        #define RM_MUL4(a, b)           vmulq_f32(a, b)
+        #define RM_MIN4(a, b)           vminq_f32(a, b)
+        #define RM_MAX4(a, b)           vmaxq_f32(a, b)
+    #endif
+#endif
+
+#if defined(RAYMATH_SIMD_SSE) || defined(RAYMATH_SIMD_NEON)
+    #define RAYMATH_SIMD_ENABLED        // SIMD code paths available
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -1266,6 +1311,27 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_ENABLED)
+    // NOTE: Every result row in memory [m0 m4 m8 m12] is a linear combination of left rows in memory,
+    // weighted by the same row of right matrix, terms are accumulated in the same order than scalar code
+    const float *a = &left.m0;
+    const float *b = &right.m0;
+    float *r = &result.m0;
+
+    rmFloat4 row0 = RM_LOAD4(a);
+    rmFloat4 row1 = RM_LOAD4(a + 4);
+    rmFloat4 row2 = RM_LOAD4(a + 8);
+    rmFloat4 row3 = RM_LOAD4(a + 12);
+
+    for (int i = 0; i < 16; i += 4)
+    {
+        rmFloat4 sum = RM_MUL4(row0, RM_SPLAT4(b[i]));
+        sum = RM_ADD4(sum, RM_MUL4(row1, RM_SPLAT4(b[i + 1])));
+        sum = RM_ADD4(sum, RM_MUL4(row2, RM_SPLAT4(b[i + 2])));
+        sum = RM_ADD4(sum, RM_MUL4(row3, RM_SPLAT4(b[i + 3])));
+        RM_STORE4(r + i, sum);
+    }
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -1282,6 +1348,7 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
@@ -2137,4 +2204,191 @@ RMAPI int QuaternionEquals(Quaternion p, Quaternion q)
     return result;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batch (array) math
+//----------------------------------------------------------------------------------
+// NOTE: Batch functions process arrays of values (AoS), values required by every element are computed
+// once per call, results are bit-compatible with single value functions (except QuaternionSlerpArray()),
+// result array can be the same as input array (in-place processing)
+
+// Transform an array of points by a matrix (count points)
+RMAPI void Vector3TransformArray(Vector3 *result, const Vector3 *points, int count, Matrix mat)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+        float z = points[i].z;
+
+        result[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        result[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
+// Rotate an array of vectors by a quaternion (count vectors)
+RMAPI void Vector3RotateByQuaternionArray(Vector3 *result, const Vector3 *points, int count, Quaternion q)
+{
+    // Rotation coefficients, same expressions than Vector3RotateByQuaternion()
+    float xx = q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z;
+    float xy = 2*q.x*q.y - 2*q.w*q.z;
+    float xz = 2*q.x*q.z + 2*q.w*q.y;
+    float yx = 2*q.w*q.z + 2*q.x*q.y;
+    float yy = q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z;
+    float yz = -2*q.w*q.x + 2*q.y*q.z;
+    float zx = -2*q.w*q.y + 2*q.x*q.z;
+    float zy = 2*q.w*q.x + 2*q.y*q.z;
+    float zz = q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 v = points[i];
+
+        result[i].x = v.x*xx + v.y*xy + v.z*xz;
+        result[i].y = v.x*yx + v.y*yy + v.z*yz;
+        result[i].z = v.x*zx + v.y*zy + v.z*zz;
+    }
+}
+
+// Multiply arrays of matrices, element by element: result[i] = left[i]*right[i] (count matrices)
+RMAPI void MatrixMultiplyArray(Matrix *result, const Matrix *left, const Matrix *right, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const float *a = &left[i].m0;
+        const float *b = &right[i].m0;
+        float r[16] = { 0 };
+
+        // NOTE: Matrix elements are in memory order [m0 m4 m8 m12 m1 m5 ...], every result row in memory
+        // is a linear combination of left rows in memory, weighted by the same row of right matrix
+        for (int k = 0; k < 16; k += 4)
+        {
+            for (int j = 0; j < 4; j++) r[k + j] = a[j]*b[k] + a[4 + j]*b[k + 1] + a[8 + j]*b[k + 2] + a[12 + j]*b[k + 3];
+        }
+        // NOTE: Result is copied after computation, result array can be the same as left or right arrays
+        float *dst = &result[i].m0;
+        for (int k = 0; k < 16; k++) dst[k] = r[k];
+    }
+}
+
+// Calculate spherical linear interpolation between arrays of quaternions, element by element (count quaternions)
+// NOTE: Same algorithm as QuaternionSlerp(), with reciprocal of sinHalfTheta computed once per element
+RMAPI void QuaternionSlerpArray(Quaternion *result, const Quaternion *q1, const Quaternion *q2, int count, float amount)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Quaternion a = q1[i];
+        Quaternion b = q2[i];
+        Quaternion r = { 0 };
+
+        float cosHalfTheta = a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w;
+
+        if (cosHalfTheta < 0)
+        {
+            b.x = -b.x; b.y = -b.y; b.z = -b.z; b.w = -b.w;
+            cosHalfTheta = -cosHalfTheta;
+        }
+
+        if (fabsf(cosHalfTheta) >= 1.0f) r = a;
+        else if (cosHalfTheta > 0.95f)
+        {
+            // Normalized linear interpolation
+            r.x = a.x + amount*(b.x - a.x);
+            r.y = a.y + amount*(b.y - a.y);
+            r.z = a.z + amount*(b.z - a.z);
+            r.w = a.w + amount*(b.w - a.w);
+
+            float length = sqrtf(r.x*r.x + r.y*r.y + r.z*r.z + r.w*r.w);
+            if (length == 0.0f) length = 1.0f;
+            float ilength = 1.0f/length;
+
+            r.x *= ilength;
+            r.y *= ilength;
+            r.z *= ilength;
+            r.w *= ilength;
+        }
+        else
+        {
+            float halfTheta = acosf(cosHalfTheta);
+            float sinHalfTheta = sqrtf(1.0f - cosHalfTheta*cosHalfTheta);
+
+            float ratioA = 0.5f;
+            float ratioB = 0.5f;
+
+            if (fabsf(sinHalfTheta) >= 0.001f)
+            {
+                float invSinHalfTheta = 1.0f/sinHalfTheta;
+                ratioA = sinf((1 - amount)*halfTheta)*invSinHalfTheta;
+                ratioB = sinf(amount*halfTheta)*invSinHalfTheta;
+            }
+
+            r.x = (a.x*ratioA + b.x*ratioB);
+            r.y = (a.y*ratioA + b.y*ratioB);
+            r.z = (a.z*ratioA + b.z*ratioB);
+            r.w = (a.w*ratioA + b.w*ratioB);
+        }
+
+        result[i] = r;
+    }
+}
+
+// Get bounds (min and max corners) of an array of points (count points)
+// NOTE: If count is 0, min and max are set to zero
+RMAPI void Vector3BoundsArray(const Vector3 *points, int count, Vector3 *min, Vector3 *max)
+{
+    Vector3 minPoint = { 0 };
+    Vector3 maxPoint = { 0 };
+
+    if (count > 0)
+    {
+        minPoint = points[0];
+        maxPoint = points[0];
+
+#if defined(RAYMATH_SIMD_ENABLED)
+        rmFloat4 minv = RM_SET4(points[0].x, points[0].y, points[0].z, 0.0f);
+        rmFloat4 maxv = minv;
+        int i = 1;
+
+        // NOTE: Four floats are loaded per point, last point is loaded separately to avoid reading out of bounds
+        for (; i < count - 1; i++)
+        {
+            rmFloat4 p = RM_LOAD4(&points[i].x);
+            minv = RM_MIN4(minv, p);
+            maxv = RM_MAX4(maxv, p);
+        }
+
+        if (i < count)
+        {
+            rmFloat4 p = RM_SET4(points[i].x, points[i].y, points[i].z, 0.0f);
+            minv = RM_MIN4(minv, p);
+            maxv = RM_MAX4(maxv, p);
+        }
+
+        float r[4] = { 0 };
+        RM_STORE4(r, minv);
+        minPoint.x = r[0];
+        minPoint.y = r[1];
+        minPoint.z = r[2];
+        RM_STORE4(r, maxv);
+        maxPoint.x = r[0];
+        maxPoint.y = r[1];
+        maxPoint.z = r[2];
+#else
+        for (int i = 1; i < count; i++)
+        {
+            minPoint.x = fminf(minPoint.x, points[i].x);
+            minPoint.y = fminf(minPoint.y, points[i].y);
+            minPoint.z = fminf(minPoint.z, points[i].z);
+            maxPoint.x = fmaxf(maxPoint.x, points[i].x);
+            maxPoint.y = fmaxf(maxPoint.y, points[i].y);
+            maxPoint.z = fmaxf(maxPoint.z, points[i].z);
+        }
+#endif
+    }
+
+    *min = minPoint;
+    *max = maxPoint;
+}
+
 #endif  // RAYMATH_H
+
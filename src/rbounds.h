@@ -0,0 +1,436 @@
+/**********************************************************************************************
+*
+*   rbounds - Dynamic bounds tree (bounding volume hierarchy) for 2D rectangles and 3D boxes
+*
+*   Internal module used by broadphase (rshapes) and box tree (rmodels): the tree manages nodes
+*   allocation, leaves insertion by surface area heuristic (perimeter for 2D), removal and
+*   rebalancing; queries are done by modules traversing nodes array from root node
+*
+*   CONFIGURATION:
+*       #define BOUNDS_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           Functions are defined as 'static' by default, so every module including the
+*           implementation gets its own copy and modules can be enabled independently.
+*
+*   DEPENDENCIES:
+*       TRACELOG(), RL_REALLOC(), RL_FREE() - Defined by utils.h, included before this header,
+*       default definitions provided otherwise (no logging)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 agent
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RBOUNDS_H
+#define RBOUNDS_H
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Function specifiers definition
+#ifndef RBAPI
+    #define RBAPI static    // Functions defined as 'static' by default, internal to including module
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Bounds tree node, leaves bounds are items bounds (usually enlarged by a margin)
+typedef struct BoundsTreeNode {
+    float min[3];                   // Node bounds min corner (z not used by 2D trees)
+    float max[3];                   // Node bounds max corner (z not used by 2D trees)
+    int parent;                     // Parent node, next free node if not in use
+    int child1;                     // First child node (-1 for leaves)
+    int child2;                     // Second child node (-1 for leaves)
+    int height;                     // Node height (0 for leaves, -1 if not in use)
+    int item;                       // Leaf item id
+} BoundsTreeNode;
+
+// Bounds tree, dynamic bounding volume hierarchy
+// NOTE: Queries are done by modules traversing nodes from root, stack capacity matches nodes capacity
+typedef struct BoundsTree {
+    int dimensions;                 // Bounds dimensions: 2 (perimeter cost) or 3 (surface area cost)
+    BoundsTreeNode *nodes;          // Nodes array
+    int nodeCount;                  // Nodes array used entries
+    int nodeCapacity;               // Nodes array capacity
+    int freeNode;                   // First free node (free list), -1 if none
+    int root;                       // Root node, -1 if tree is empty
+    int *stack;                     // Traversal stack
+} BoundsTree;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+RBAPI BoundsTree LoadBoundsTree(int dimensions);                   // Load bounds tree (2D or 3D bounds)
+RBAPI void UnloadBoundsTree(BoundsTree *tree);                     // Unload bounds tree
+RBAPI int AddBoundsTreeLeaf(BoundsTree *tree, const float *min, const float *max, int item);   // Add leaf to bounds tree, returns leaf node (-1 on failure)
+RBAPI void RemoveBoundsTreeLeaf(BoundsTree *tree, int leaf);       // Remove leaf from bounds tree
+RBAPI void MoveBoundsTreeLeaf(BoundsTree *tree, int leaf, const float *min, const float *max); // Move leaf to new bounds (never fails)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RBOUNDS_H
+
+/***********************************************************************************
+*
+*   BOUNDS IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(BOUNDS_IMPLEMENTATION)
+
+#include <stdlib.h>             // Required for: realloc(), free(), NULL
+
+#ifndef RL_REALLOC
+    #define RL_REALLOC(ptr,sz)      realloc(ptr,sz)
+#endif
+#ifndef RL_FREE
+    #define RL_FREE(ptr)            free(ptr)
+#endif
+#ifndef TRACELOG
+    #define TRACELOG(level, ...)    (void)0
+#endif
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static int AllocateBoundsTreeNode(BoundsTree *tree);                                         // Allocate bounds tree node (capacity must be reserved)
+static void FreeBoundsTreeNode(BoundsTree *tree, int node);                                  // Free bounds tree node
+static float GetBoundsTreeCost(const BoundsTree *tree, const float *min, const float *max);  // Get bounds cost (perimeter or half surface area)
+static void InsertBoundsTreeLeaf(BoundsTree *tree, int leaf);                                // Insert leaf into tree (one free node required)
+static void ExtractBoundsTreeLeaf(BoundsTree *tree, int leaf);                               // Extract leaf from tree, leaf node is not freed
+static int BalanceBoundsTreeNode(BoundsTree *tree, int node);                                // Balance tree node with rotations, returns node at its position
+static void FitBoundsTreeNode(BoundsTree *tree, int node);                                   // Update node bounds and height from children
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load bounds tree, dimensions: 2 (rectangles) or 3 (boxes)
+RBAPI BoundsTree LoadBoundsTree(int dimensions)
+{
+    BoundsTree tree = { 0 };
+
+    tree.dimensions = (dimensions == 2)? 2 : 3;
+    tree.freeNode = -1;
+    tree.root = -1;
+
+    return tree;
+}
+
+// Unload bounds tree
+RBAPI void UnloadBoundsTree(BoundsTree *tree)
+{
+    RL_FREE(tree->nodes);
+    RL_FREE(tree->stack);
+
+    *tree = LoadBoundsTree(tree->dimensions);
+}
+
+// Add leaf to bounds tree, returns leaf node (-1 on failure, tree is not modified)
+// NOTE: Nodes required by insertion (leaf and its new parent) are reserved before changing the tree
+RBAPI int AddBoundsTreeLeaf(BoundsTree *tree, const float *min, const float *max, int item)
+{
+    int freeCount = 0;
+    for (int node = tree->freeNode; (node != -1) && (freeCount < 2); node = tree->nodes[node].parent) freeCount++;
+
+    if ((tree->nodeCount + 2 - freeCount) > tree->nodeCapacity)
+    {
+        int capacity = (tree->nodeCapacity > 0)? tree->nodeCapacity*2 : 128;
+        BoundsTreeNode *nodes = (BoundsTreeNode *)RL_REALLOC(tree->nodes, capacity*sizeof(BoundsTreeNode));
+        int *stack = (nodes != NULL)? (int *)RL_REALLOC(tree->stack, capacity*sizeof(int)) : NULL;
+
+        if (nodes != NULL) tree->nodes = nodes;
+        if (stack == NULL)
+        {
+            TRACELOG(LOG_WARNING, "BOUNDS: Failed to grow bounds tree nodes");
+            return -1;
+        }
+
+        tree->stack = stack;
+        tree->nodeCapacity = capacity;
+    }
+
+    int leaf = AllocateBoundsTreeNode(tree);
+
+    for (int i = 0; i < tree->dimensions; i++)
+    {
+        tree->nodes[leaf].min[i] = min[i];
+        tree->nodes[leaf].max[i] = max[i];
+    }
+    tree->nodes[leaf].item = item;
+
+    InsertBoundsTreeLeaf(tree, leaf);
+
+    return leaf;
+}
+
+// Remove leaf from bounds tree, leaf node is freed
+RBAPI void RemoveBoundsTreeLeaf(BoundsTree *tree, int leaf)
+{
+    ExtractBoundsTreeLeaf(tree, leaf);
+    FreeBoundsTreeNode(tree, leaf);
+}
+
+// Move leaf to new bounds, leaf is reinserted in tree
+// NOTE: Parent node freed on extraction is reused on insertion, so tree never grows
+RBAPI void MoveBoundsTreeLeaf(BoundsTree *tree, int leaf, const float *min, const float *max)
+{
+    ExtractBoundsTreeLeaf(tree, leaf);
+
+    for (int i = 0; i < tree->dimensions; i++)
+    {
+        tree->nodes[leaf].min[i] = min[i];
+        tree->nodes[leaf].max[i] = max[i];
+    }
+
+    InsertBoundsTreeLeaf(tree, leaf);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Allocate bounds tree node, from free list or nodes array reserved capacity
+static int AllocateBoundsTreeNode(BoundsTree *tree)
+{
+    int node = tree->freeNode;
+
+    if (node != -1) tree->freeNode = tree->nodes[node].parent;
+    else node = tree->nodeCount++;
+
+    tree->nodes[node].parent = -1;
+    tree->nodes[node].child1 = -1;
+    tree->nodes[node].child2 = -1;
+    tree->nodes[node].height = 0;
+    tree->nodes[node].item = -1;
+
+    return node;
+}
+
+// Free bounds tree node
+static void FreeBoundsTreeNode(BoundsTree *tree, int node)
+{
+    tree->nodes[node].parent = tree->freeNode;
+    tree->nodes[node].height = -1;
+    tree->freeNode = node;
+}
+
+// Get bounds cost used by tree heuristic: perimeter (half) for 2D bounds, surface area (half) for 3D bounds
+static float GetBoundsTreeCost(const BoundsTree *tree, const float *min, const float *max)
+{
+    float cost = 0.0f;
+
+    if (tree->dimensions == 2) cost = (max[0] - min[0]) + (max[1] - min[1]);
+    else
+    {
+        float sizeX = max[0] - min[0];
+        float sizeY = max[1] - min[1];
+        float sizeZ = max[2] - min[2];
+
+        cost = sizeX*sizeY + sizeY*sizeZ + sizeZ*sizeX;
+    }
+
+    return cost;
+}
+
+// Insert leaf into tree, one node must be available (free list or reserved capacity) for new parent
+// NOTE: Sibling is chosen descending the tree by minimum cost increase (surface area heuristic)
+static void InsertBoundsTreeLeaf(BoundsTree *tree, int leaf)
+{
+    if (tree->root == -1)
+    {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = -1;
+        return;
+    }
+
+    BoundsTreeNode leafNode = tree->nodes[leaf];
+    int sibling = tree->root;
+
+    while (tree->nodes[sibling].child1 != -1)
+    {
+        BoundsTreeNode *node = &tree->nodes[sibling];
+        float combinedMin[3] = { 0 };
+        float combinedMax[3] = { 0 };
+
+        for (int i = 0; i < tree->dimensions; i++)
+        {
+            combinedMin[i] = (node->min[i] < leafNode.min[i])? node->min[i] : leafNode.min[i];
+            combinedMax[i] = (node->max[i] > leafNode.max[i])? node->max[i] : leafNode.max[i];
+        }
+
+        float cost = GetBoundsTreeCost(tree, node->min, node->max);
+        float combinedCost = GetBoundsTreeCost(tree, combinedMin, combinedMax);
+
+        // Cost of creating a new parent for this node and the leaf, and minimum cost of pushing the leaf further down
+        float parentCost = 2.0f*combinedCost;
+        float inheritanceCost = 2.0f*(combinedCost - cost);
+
+        int children[2] = { node->child1, node->child2 };
+        float childCost[2] = { 0 };
+
+        for (int c = 0; c < 2; c++)
+        {
+            BoundsTreeNode *child = &tree->nodes[children[c]];
+
+            for (int i = 0; i < tree->dimensions; i++)
+            {
+                combinedMin[i] = (child->min[i] < leafNode.min[i])? child->min[i] : leafNode.min[i];
+                combinedMax[i] = (child->max[i] > leafNode.max[i])? child->max[i] : leafNode.max[i];
+            }
+
+            childCost[c] = GetBoundsTreeCost(tree, combinedMin, combinedMax) + inheritanceCost;
+            if (child->child1 != -1) childCost[c] -= GetBoundsTreeCost(tree, child->min, child->max);
+        }
+
+        if ((parentCost < childCost[0]) && (parentCost < childCost[1])) break;
+
+        sibling = (childCost[0] < childCost[1])? children[0] : children[1];
+    }
+
+    // Create new parent for sibling and leaf
+    int oldParent = tree->nodes[sibling].parent;
+    int newParent = AllocateBoundsTreeNode(tree);
+
+    tree->nodes[newParent].parent = oldParent;
+    tree->nodes[newParent].child1 = sibling;
+    tree->nodes[newParent].child2 = leaf;
+    tree->nodes[sibling].parent = newParent;
+    tree->nodes[leaf].parent = newParent;
+
+    if (oldParent != -1)
+    {
+        if (tree->nodes[oldParent].child1 == sibling) tree->nodes[oldParent].child1 = newParent;
+        else tree->nodes[oldParent].child2 = newParent;
+    }
+    else tree->root = newParent;
+
+    // Walk back up the tree refitting bounds and heights
+    for (int node = newParent; node != -1; node = tree->nodes[node].parent)
+    {
+        node = BalanceBoundsTreeNode(tree, node);
+        FitBoundsTreeNode(tree, node);
+    }
+}
+
+// Extract leaf from tree, its parent node is freed, leaf node is not freed
+static void ExtractBoundsTreeLeaf(BoundsTree *tree, int leaf)
+{
+    if (leaf == tree->root)
+    {
+        tree->root = -1;
+        return;
+    }
+
+    int parent = tree->nodes[leaf].parent;
+    int grandParent = tree->nodes[parent].parent;
+    int sibling = (tree->nodes[parent].child1 == leaf)? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+
+    if (grandParent != -1)
+    {
+        // Replace parent by sibling
+        if (tree->nodes[grandParent].child1 == parent) tree->nodes[grandParent].child1 = sibling;
+        else tree->nodes[grandParent].child2 = sibling;
+
+        tree->nodes[sibling].parent = grandParent;
+        FreeBoundsTreeNode(tree, parent);
+
+        for (int node = grandParent; node != -1; node = tree->nodes[node].parent)
+        {
+            node = BalanceBoundsTreeNode(tree, node);
+            FitBoundsTreeNode(tree, node);
+        }
+    }
+    else
+    {
+        tree->root = sibling;
+        tree->nodes[sibling].parent = -1;
+        FreeBoundsTreeNode(tree, parent);
+    }
+
+    tree->nodes[leaf].parent = -1;
+}
+
+// Balance tree node: if children heights differ by more than one, rotate the higher child up
+// NOTE: Returns the node now placed at input node position
+static int BalanceBoundsTreeNode(BoundsTree *tree, int a)
+{
+    BoundsTreeNode *nodeA = &tree->nodes[a];
+    if ((nodeA->child1 == -1) || (nodeA->height < 2)) return a;
+
+    int balance = tree->nodes[nodeA->child2].height - tree->nodes[nodeA->child1].height;
+    if ((balance >= -1) && (balance <= 1)) return a;
+
+    // Higher child (up) replaces node, node takes the lower grandchild
+    int up = (balance > 1)? nodeA->child2 : nodeA->child1;
+    BoundsTreeNode *nodeUp = &tree->nodes[up];
+    int f = nodeUp->child1;
+    int g = nodeUp->child2;
+
+    nodeUp->child1 = a;
+    nodeUp->parent = nodeA->parent;
+    nodeA->parent = up;
+
+    if (nodeUp->parent != -1)
+    {
+        if (tree->nodes[nodeUp->parent].child1 == a) tree->nodes[nodeUp->parent].child1 = up;
+        else tree->nodes[nodeUp->parent].child2 = up;
+    }
+    else tree->root = up;
+
+    // Higher grandchild stays with up, lower one goes to node
+    int keep = (tree->nodes[f].height > tree->nodes[g].height)? f : g;
+    int give = (keep == f)? g : f;
+
+    nodeUp->child2 = keep;
+    if (balance > 1) nodeA->child2 = give;
+    else nodeA->child1 = give;
+    tree->nodes[give].parent = a;
+
+    FitBoundsTreeNode(tree, a);
+    FitBoundsTreeNode(tree, up);
+
+    return up;
+}
+
+// Update node bounds and height from children
+static void FitBoundsTreeNode(BoundsTree *tree, int node)
+{
+    BoundsTreeNode *n = &tree->nodes[node];
+    if (n->child1 == -1) return;
+
+    BoundsTreeNode *child1 = &tree->nodes[n->child1];
+    BoundsTreeNode *child2 = &tree->nodes[n->child2];
+
+    for (int i = 0; i < tree->dimensions; i++)
+    {
+        n->min[i] = (child1->min[i] < child2->min[i])? child1->min[i] : child2->min[i];
+        n->max[i] = (child1->max[i] > child2->max[i])? child1->max[i] : child2->max[i];
+    }
+
+    n->height = 1 + ((child1->height > child2->height)? child1->height : child2->height);
+}
+
+#endif // BOUNDS_IMPLEMENTATION
@@ -49,6 +49,9 @@
 *       #define SUPPORT_MOUSE_GESTURES
 *           Mouse gestures are directly mapped like touches and processed by gestures system.
 *
+*       #define SUPPORT_PARTICLE_SYSTEM
+*           Particle system module is included (rparticles.h), particles updated on CPU (SIMD) or GPU (compute shader)
+*
 *       #define SUPPORT_TOUCH_AS_MOUSE
 *           Touch input and mouse input are shared. Mouse functions also return touch information.
 *
@@ -61,7 +64,8 @@
 *           Use busy wait loop for timing sync, if not defined, a high-resolution timer is setup and used
 *
 *       #define SUPPORT_PARTIALBUSY_WAIT_LOOP
-*           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
+*           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end,
+*           sleep time is adapted to measured system sleep overshoot, so only the residual time is busy waited
 *
 *       #define SUPPORT_EVENTS_WAITING
 *           Wait for events passively (sleeping while no events) instead of polling them actively every frame
@@ -78,7 +82,19 @@
 *           for linkage
 *
 *       #define SUPPORT_EVENTS_AUTOMATION
-*           Support automatic generated events, loading and recording of those events when required
+*           Support automation events recording (F11) and playing (F9) hotkeys, with an on-screen indicator,
+*           automation events API is always available: StartAutomationEventRecording(), PlayAutomationEvents()
+*
+*       #define SUPPORT_JOB_SYSTEM
+*           Support a pool of worker threads to run jobs asynchronously: QueueJob(), used by async loading
+*           functions (LoadImageAsync(), LoadTextureAsync()...), jobs finish steps run on main thread
+*           NOTE: If not defined or threads are not available (PLATFORM_WEB), jobs run synchronously
+*
+*       #define SUPPORT_PROFILER
+*           Support profile zones recording: BeginProfileZone()/EndProfileZone(), raylib internal hot paths
+*           are also instrumented, recorded zones can be exported as Chrome trace events: ExportProfileTrace()
+*           GPU timer zones (rlgl timestamp queries) are also recorded and exported, mapped to CPU time
+*           NOTE: If not defined, internal profile zones are removed at compile time
 *
 *   DEPENDENCIES:
 *       rglfw    - Manage graphic device, OpenGL context and inputs on PLATFORM_DESKTOP (Windows, Linux, OSX, FreeBSD...)
@@ -133,6 +149,11 @@
     #include "rcamera.h"             // Camera system functionality
 #endif
 
+#if defined(SUPPORT_PARTICLE_SYSTEM)
+    #define PARTICLES_IMPLEMENTATION
+    #include "rparticles.h"          // Particle system functionality
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     #define MSF_GIF_MALLOC(contextPointer, newSize) RL_MALLOC(newSize)
     #define MSF_GIF_REALLOC(contextPointer, oldMemory, oldSize, newSize) RL_REALLOC(oldMemory, newSize)
@@ -179,6 +200,7 @@
 #include <stdlib.h>                 // Required for: srand(), rand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
+#include <ctype.h>                  // Required for: tolower() [Used in IsFileExtension()]
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
@@ -289,6 +311,76 @@
     //#include "GLES2/gl2.h"            // OpenGL ES 2.0 library (not required in this module, only in rlgl)
 #endif
 
+#if defined(SUPPORT_JOB_SYSTEM) && !defined(PLATFORM_WEB)
+    #define JOB_SYSTEM_THREADED         // Jobs run on worker threads, otherwise they run synchronously
+
+    #if defined(_WIN32)
+        // NOTE: We declare required Win32 threading symbols to avoid including windows.h (kernel32.lib linkage required)
+        typedef struct { void *ptr; } JobMutex;         // Win32: SRWLOCK
+        typedef struct { void *ptr; } JobCondition;     // Win32: CONDITION_VARIABLE
+        typedef void *JobThread;                        // Win32: HANDLE
+
+        void __stdcall InitializeSRWLock(JobMutex *lock);
+        void __stdcall AcquireSRWLockExclusive(JobMutex *lock);
+        void __stdcall ReleaseSRWLockExclusive(JobMutex *lock);
+        void __stdcall InitializeConditionVariable(JobCondition *cond);
+        int __stdcall SleepConditionVariableSRW(JobCondition *cond, JobMutex *lock, unsigned long milliseconds, unsigned long flags);
+        void __stdcall WakeConditionVariable(JobCondition *cond);
+        void __stdcall WakeAllConditionVariable(JobCondition *cond);
+        void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        int __stdcall CloseHandle(void *handle);
+        unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+
+        #define JOB_MUTEX_STATIC_INIT           { 0 }                   // SRWLOCK_INIT
+        #define JOB_MUTEX_INIT(mutex)           InitializeSRWLock(mutex)
+        #define JOB_MUTEX_LOCK(mutex)           AcquireSRWLockExclusive(mutex)
+        #define JOB_MUTEX_UNLOCK(mutex)         ReleaseSRWLockExclusive(mutex)
+        #define JOB_MUTEX_DESTROY(mutex)        (void)0
+        #define JOB_CONDITION_INIT(cond)        InitializeConditionVariable(cond)
+        #define JOB_CONDITION_WAIT(cond, mutex) SleepConditionVariableSRW(cond, mutex, 0xffffffff, 0)
+        #define JOB_CONDITION_SIGNAL(cond)      WakeConditionVariable(cond)
+        #define JOB_CONDITION_BROADCAST(cond)   WakeAllConditionVariable(cond)
+        #define JOB_CONDITION_DESTROY(cond)     (void)0
+    #else
+        #include <pthread.h>                    // POSIX threads management (jobs workers)
+        #include <unistd.h>                     // Required for: sysconf()
+
+        typedef pthread_mutex_t JobMutex;
+        typedef pthread_cond_t JobCondition;
+        typedef pthread_t JobThread;
+
+        #define JOB_MUTEX_STATIC_INIT           PTHREAD_MUTEX_INITIALIZER
+        #define JOB_MUTEX_INIT(mutex)           pthread_mutex_init(mutex, NULL)
+        #define JOB_MUTEX_LOCK(mutex)           pthread_mutex_lock(mutex)
+        #define JOB_MUTEX_UNLOCK(mutex)         pthread_mutex_unlock(mutex)
+        #define JOB_MUTEX_DESTROY(mutex)        pthread_mutex_destroy(mutex)
+        #define JOB_CONDITION_INIT(cond)        pthread_cond_init(cond, NULL)
+        #define JOB_CONDITION_WAIT(cond, mutex) pthread_cond_wait(cond, mutex)
+        #define JOB_CONDITION_SIGNAL(cond)      pthread_cond_signal(cond)
+        #define JOB_CONDITION_BROADCAST(cond)   pthread_cond_broadcast(cond)
+        #define JOB_CONDITION_DESTROY(cond)     pthread_cond_destroy(cond)
+    #endif
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    // NOTE: Profile zones are recorded in per-thread buffers, only registration requires atomic operations
+    #if defined(_MSC_VER)
+        long _InterlockedIncrement(long volatile *addend);
+        #pragma intrinsic(_InterlockedIncrement)
+
+        #define PROFILER_THREAD_LOCAL               __declspec(thread)
+        #define PROFILER_ATOMIC_INCREMENT(value)    _InterlockedIncrement(value)
+        #define PROFILER_ATOMIC_LOAD(value)         (*(value))              // MSVC: volatile access has acquire semantics
+        #define PROFILER_ATOMIC_STORE(value, x)     (*(value) = (x))        // MSVC: volatile access has release semantics
+    #else
+        #define PROFILER_THREAD_LOCAL               __thread
+        #define PROFILER_ATOMIC_INCREMENT(value)    __atomic_add_fetch(value, 1, __ATOMIC_ACQ_REL)
+        #define PROFILER_ATOMIC_LOAD(value)         __atomic_load_n(value, __ATOMIC_ACQUIRE)
+        #define PROFILER_ATOMIC_STORE(value, x)     __atomic_store_n(value, x, __ATOMIC_RELEASE)
+    #endif
+#endif
+
 #if defined(PLATFORM_WEB)
     #define GLFW_INCLUDE_ES2            // GLFW3: Enable OpenGL ES 2.0 (translated to WebGL)
     //#define GLFW_INCLUDE_ES3            // GLFW3: Enable OpenGL ES 3.0 (transalted to WebGL2?)
@@ -309,9 +401,6 @@
     #define DEFAULT_EVDEV_PATH       "/dev/input/"  // Path to the linux input events
 #endif
 
-#ifndef MAX_FILEPATH_CAPACITY
-    #define MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
-#endif
 #ifndef MAX_FILEPATH_LENGTH
     #define MAX_FILEPATH_LENGTH         4096        // Maximum length for filepaths (Linux PATH_MAX default value)
 #endif
@@ -341,9 +430,51 @@
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
 
+#ifndef FRAME_TIME_HISTORY_SIZE
+    #define FRAME_TIME_HISTORY_SIZE      256        // Number of frame times registered for frame statistics
+#endif
+#ifndef FRAME_HITCH_FACTOR
+    #define FRAME_HITCH_FACTOR           1.5        // Frame time over expected frame time factor considered a hitch
+#endif
+#define SLEEP_OVERSHOOT_DEFAULT        0.001        // Initial system sleep overshoot estimation (seconds)
+#define SLEEP_OVERSHOOT_SAMPLES           32        // Number of sleep overshoot samples for estimation moving average
+
 #ifndef MAX_DECOMPRESSION_SIZE
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
+#ifndef DECOMPRESSION_MIN_CAPACITY
+    #define DECOMPRESSION_MIN_CAPACITY   65536      // Minimum size allocated for decompression in bytes, grows as required
+#endif
+#ifndef COMPRESSION_CHUNK_SIZE
+    #define COMPRESSION_CHUNK_SIZE      262144      // Data chunk size for parallel compression in bytes
+#endif
+#define COMPRESSION_LEVEL_DEFAULT          8        // Default compression level (DEFLATE), same as stbiw
+
+#ifndef MAX_JOB_WORKERS
+    #define MAX_JOB_WORKERS                8        // Maximum number of job worker threads
+#endif
+#ifndef MAX_JOB_QUEUE_SIZE
+    #define MAX_JOB_QUEUE_SIZE          1024        // Maximum number of jobs in flight (queued, running or finishing)
+#endif
+#ifndef JOB_FINISH_TIME_BUDGET
+    #define JOB_FINISH_TIME_BUDGET     0.002        // Default main thread time budget per frame for jobs finish steps (in seconds)
+#endif
+
+#define SCREEN_CAPTURE_BUFFERS             3        // Number of pixel buffers for screen captures readback (captures in flight on GPU)
+#define SCREEN_CAPTURE_QUEUE_SIZE          8        // Maximum number of screen captures waiting for encoding (per type)
+
+#define AUTOMATION_EVENTS_CHUNK_SIZE   65536        // Automation events stream chunk size (in bytes), stream grows chunk by chunk
+#define AUTOMATION_FIXED_SCALE        1024.0f       // Automation events fixed-point scale for float values (positions, wheel, axis)
+
+#ifndef MAX_PROFILE_THREADS
+    #define MAX_PROFILE_THREADS           16        // Maximum number of threads recording profile zones
+#endif
+#ifndef MAX_PROFILE_ZONES
+    #define MAX_PROFILE_ZONES          16384        // Maximum number of recorded profile zones per thread (oldest are overwritten)
+#endif
+#ifndef MAX_PROFILE_ZONE_DEPTH
+    #define MAX_PROFILE_ZONE_DEPTH        32        // Maximum profile zones nesting depth
+#endif
 
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
@@ -372,6 +503,158 @@ typedef struct {
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
+// File paths builder, used while scanning directories
+// NOTE: Paths are stored '\0' separated in a growable string arena, referenced by offset,
+// pointers are only resolved on BuildFilePathList() once the arena will not move anymore
+typedef struct FilePathBuilder {
+    char *buffer;                       // Paths string arena
+    unsigned int bufferSize;            // Paths string arena used size (bytes)
+    unsigned int bufferCapacity;        // Paths string arena allocated size (bytes)
+    unsigned int *offsets;              // Paths start offsets in string arena
+    unsigned int count;                 // Paths count
+    unsigned int capacity;              // Paths offsets allocated count
+} FilePathBuilder;
+
+// Job state
+typedef enum {
+    JOB_STATE_FREE = 0,             // Job slot available (job done)
+    JOB_STATE_QUEUED,               // Job waiting for a worker thread
+    JOB_STATE_RUNNING,              // Job work running on a worker thread
+    JOB_STATE_FINISHING             // Job work done, waiting for finish step on main thread
+} JobState;
+
+// Job data
+typedef struct Job {
+    unsigned int id;                // Job id, 0 is not a valid id
+    JobState state;                 // Job state
+    JobCallback work;               // Job work, runs on a worker thread
+    JobCallback finish;             // Job finish, runs on main thread (optional)
+    void *data;                     // Job user data, passed to work and finish
+} Job;
+
+#if defined(JOB_SYSTEM_THREADED)
+// Job ranges task data, shared by threads running ranges
+typedef struct JobRangesTask {
+    JobRangeCallback work;          // Range work
+    void *data;                     // Range work user data
+    int count;                      // Items count, split in ranges
+    int rangeCount;                 // Number of ranges
+    int nextRange;                  // Next range to be claimed
+    int doneRanges;                 // Number of ranges done
+    int refCount;                   // Threads using task data, last one frees it
+    JobMutex mutex;                 // Task data access mutex
+    JobCondition rangesDone;        // Signaled when all ranges are done
+} JobRangesTask;
+#endif
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Compressor internal state, used for chunked data compression
+typedef struct CompressorState {
+    struct sdefl sdefl;             // Compression context
+    unsigned char *buffer;          // History window followed by current chunk data
+    int bufferCapacity;             // Buffer allocated size
+    int historySize;                // History window size (up to DEFLATE window size: 32KB)
+    bool finished;                  // Last chunk has been compressed
+} CompressorState;
+
+#if defined(JOB_SYSTEM_THREADED)
+// Parallel compression task data, shared by threads compressing chunks
+typedef struct CompressionTask {
+    const unsigned char *data;      // Data to compress
+    int dataSize;                   // Data size
+    int level;                      // Compression level
+    int chunkCount;                 // Number of chunks
+    int nextChunk;                  // Next chunk to be claimed
+    int doneChunks;                 // Number of chunks compressed
+    int refCount;                   // Threads using task data, last one frees it
+    unsigned char **chunkData;      // Chunks compressed data
+    int *chunkSize;                 // Chunks compressed data size
+    JobMutex mutex;                 // Task data access mutex
+    JobCondition chunksDone;        // Signaled when all chunks are compressed
+} CompressionTask;
+#endif
+#endif
+
+#if defined(SUPPORT_PROFILER)
+// Profile zone recorded data
+typedef struct ProfileZone {
+    const char *name;               // Zone name (static string, not copied)
+    double start;                   // Zone start time (in seconds)
+    double duration;                // Zone duration (in seconds)
+} ProfileZone;
+
+// Profile zones thread buffer, only written by owner thread
+typedef struct ProfileThreadBuffer {
+    ProfileZone zones[MAX_PROFILE_ZONES];   // Recorded zones (ring buffer, oldest zones are overwritten)
+    volatile unsigned int zoneCount;        // Recorded zones count, next zone slot is (zoneCount%MAX_PROFILE_ZONES)
+    const char *openNames[MAX_PROFILE_ZONE_DEPTH];  // Open zones names stack
+    double openStarts[MAX_PROFILE_ZONE_DEPTH];      // Open zones start times stack
+    int depth;                              // Open zones count
+} ProfileThreadBuffer;
+#endif
+
+// Screen capture types
+typedef enum {
+    SCREEN_CAPTURE_SCREENSHOT = 0,  // Screenshot, exported as image file
+    SCREEN_CAPTURE_RECORDING        // Screen recording frame
+} ScreenCaptureType;
+
+// Screenshot file formats, resolved from file extension on main thread
+// NOTE: IsFileExtension() uses rtext internal static buffers, it can not be used on jobs
+typedef enum {
+    SCREENSHOT_FORMAT_PNG = 0,      // PNG image, encoded and saved on screenshot job
+    SCREENSHOT_FORMAT_OTHER         // Other image formats, exported with ExportImage() on main thread
+} ScreenshotFormat;
+
+// Screen capture data, read back from screen
+typedef struct ScreenCapture {
+    int type;                       // Capture type (ScreenCaptureType)
+    unsigned int frame;             // Frame counter when capture was requested
+    int width;                      // Capture width (0 if capture readback slot is free)
+    int height;                     // Capture height
+    int pitch;                      // Bytes from one row to the next, negative if rows are bottom-up
+    unsigned char *data;            // Capture pixels data (RGBA), points to first row in memory
+    char *fileName;                 // Screenshot file path
+    int format;                     // Screenshot file format (ScreenshotFormat)
+    struct ScreenRecording *recording;  // Screen recording frame belongs to, set when frame is requested
+} ScreenCapture;
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Screen recording state, recording frames keep a pointer to it so encoder jobs never read CORE data
+// NOTE: Recording state is only released by StopScreenRecording(), once all its frames are encoded
+typedef struct ScreenRecording {
+    char fileName[MAX_FILEPATH_LENGTH]; // Screen recording file path
+    FILE *file;                     // Raw video frames file (NULL if recording GIF)
+    MsfGifState gifState;           // GIF encoder state
+    int width;                      // Recording frames width
+    int height;                     // Recording frames height
+} ScreenRecording;
+#endif
+
+// Automation events stream chunk
+typedef struct AutomationChunk {
+    struct AutomationChunk *next;   // Next chunk in stream
+    unsigned int size;              // Chunk data size used (in bytes)
+    unsigned int capacity;          // Chunk data capacity (in bytes)
+    unsigned char *data;            // Chunk data
+} AutomationChunk;
+
+// Automation input state, recorded events are deltas from this state
+// NOTE: Float values are stored in fixed-point (AUTOMATION_FIXED_SCALE)
+typedef struct AutomationInputState {
+    char keys[MAX_KEYBOARD_KEYS];                   // Keyboard keys state
+    char mouseButtons[MAX_MOUSE_BUTTONS];           // Mouse buttons state
+    int mousePosition[2];                           // Mouse position
+    int mouseWheel[2];                              // Mouse wheel move
+    int touchPointCount;                            // Touch points count
+    char touchState[MAX_TOUCH_POINTS];              // Touch points state
+    int touchPosition[MAX_TOUCH_POINTS][2];         // Touch points position
+    bool gamepadReady[MAX_GAMEPADS];                // Gamepads ready state
+    char gamepadButtons[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];     // Gamepads buttons state
+    int gamepadAxis[MAX_GAMEPADS][MAX_GAMEPAD_AXIS];            // Gamepads axis state
+    unsigned int gesture;                           // Current gesture (same type as GESTURES.current)
+} AutomationInputState;
+
 // Core global state context data
 typedef struct CoreData {
     struct {
@@ -504,7 +787,85 @@ typedef struct CoreData {
         unsigned long long base;            // Base time measure for hi-res timer
 #endif
         unsigned int frameCounter;          // Frame counter
+
+        double sleepOvershoot;              // Estimated system sleep overshoot, time busy waited after sleep
+        double sleepMean;                   // Measured sleep overshoot moving average
+        double sleepVariance;               // Measured sleep overshoot moving variance
+        unsigned int sleepSamples;          // Measured sleep overshoot samples (up to SLEEP_OVERSHOOT_SAMPLES)
+
+        float frameHistory[FRAME_TIME_HISTORY_SIZE];    // Frame times history (ring buffer)
+        unsigned int frameHistoryIndex;     // Frame times history next index
+        unsigned int frameHistoryCount;     // Frame times history count
+        double frameAverage;                // Frame time moving average (hitches clamped)
+        unsigned int hitchCount;            // Number of frame hitches
     } Time;
+#if defined(SUPPORT_JOB_SYSTEM)
+    struct {
+        bool ready;                         // Check if job system workers have been initialized
+        bool shouldClose;                   // Flag workers to exit
+        int workerCount;                    // Number of worker threads
+        unsigned int nextId;                // Next job id to assign
+        double finishBudget;                // Main thread time budget per frame for finish steps
+
+        Job jobs[MAX_JOB_QUEUE_SIZE];       // Jobs slots, job slot is (id%MAX_JOB_QUEUE_SIZE)
+        unsigned int pending[MAX_JOB_QUEUE_SIZE];   // Queued jobs ids (FIFO ring buffer)
+        unsigned int pendingHead;           // Queued jobs ring buffer head
+        unsigned int pendingCount;          // Queued jobs count
+        unsigned int finished[MAX_JOB_QUEUE_SIZE];  // Jobs ids waiting for finish step (FIFO ring buffer)
+        unsigned int finishedHead;          // Finishing jobs ring buffer head
+        unsigned int finishedCount;         // Finishing jobs count
+#if defined(JOB_SYSTEM_THREADED)
+        JobThread workers[MAX_JOB_WORKERS]; // Worker threads
+        JobMutex mutex;                     // Jobs data access mutex
+        JobCondition workAvailable;         // Signaled when a job is queued
+        JobCondition workDone;              // Signaled when a job work is done
+#endif
+    } Jobs;
+#endif
+#if defined(SUPPORT_PROFILER)
+    struct {
+        ProfileThreadBuffer *volatile threads[MAX_PROFILE_THREADS];   // Threads zones buffers, registered on first zone
+        volatile long threadCount;          // Registered threads count
+        volatile long generation;           // Threads buffers generation, increased when buffers are freed
+
+        ProfileThreadBuffer *gpu;           // GPU timer zones buffer (mapped to CPU time), main thread only
+        double gpuTimeOffset;               // GPU to CPU time offset (in seconds)
+        double gpuCalibrationTime;          // Last GPU to CPU time offset calibration time
+    } Profiler;
+#endif
+    struct {
+        ScreenCapture readbacks[SCREEN_CAPTURE_BUFFERS];    // Captures waiting for pixels readback
+        unsigned int pixelBuffers[SCREEN_CAPTURE_BUFFERS];  // Pixel buffers, one per readback slot
+        int pixelBufferSizes[SCREEN_CAPTURE_BUFFERS];       // Pixel buffers sizes (in bytes)
+        unsigned int screenshotJobs[SCREEN_CAPTURE_QUEUE_SIZE];   // Screenshots encoding jobs ids
+        unsigned int screenshotJobIndex;    // Next screenshot job id slot
+#if defined(SUPPORT_GIF_RECORDING)
+        ScreenRecording *recording;         // Current screen recording (NULL if not recording)
+        ScreenCapture frames[SCREEN_CAPTURE_QUEUE_SIZE];    // Recording frames waiting for encoding (FIFO ring buffer)
+        int framesHead;                     // Recording frames ring buffer head
+        int framesCount;                    // Recording frames waiting for encoding count
+        int framesDropped;                  // Recording frames dropped, encoding could not keep up
+        bool encoding;                      // Recording frames encoder job running
+        unsigned int encoderJob;            // Recording frames encoder job id
+    #if defined(JOB_SYSTEM_THREADED)
+        JobMutex mutex;                     // Recording frames queue access mutex
+        bool mutexReady;                    // Recording frames queue mutex initialized
+    #endif
+#endif
+    } Capture;
+    struct {
+        AutomationChunk *first;             // Events stream first chunk
+        AutomationChunk *last;              // Events stream last chunk (recording)
+        unsigned int frameCount;            // Events stream frames count
+        unsigned int eventCount;            // Events stream events count
+        AutomationInputState state;         // Input state at current stream position
+        bool recording;                     // Recording events
+        bool playing;                       // Playing events
+        float timeStep;                     // Playing fixed time step, frames are not paced (0 to play recorded frame times)
+        AutomationChunk *readChunk;         // Playing stream chunk
+        unsigned int readOffset;            // Playing stream chunk offset
+        unsigned int readFrame;             // Playing frame
+    } Automation;
 } CoreData;
 
 //----------------------------------------------------------------------------------
@@ -521,95 +882,42 @@ static int screenshotCounter = 0;           // Screenshots counter
 #if defined(SUPPORT_GIF_RECORDING)
 static int gifFrameCounter = 0;             // GIF frames counter
 static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-#define MAX_CODE_AUTOMATION_EVENTS      16384
+#if defined(JOB_SYSTEM_THREADED)
+static JobMutex jobSystemMutex = JOB_MUTEX_STATIC_INIT;    // Job system initialization and shutdown mutex
+#endif
+
+#if defined(SUPPORT_PROFILER)
+static PROFILER_THREAD_LOCAL ProfileThreadBuffer *profileBuffer = NULL;    // Current thread profile zones buffer
+static PROFILER_THREAD_LOCAL long profileGeneration = 0;                  // Current thread buffer generation (+1 once registered)
+#endif
 
+// Automation event types
+// NOTE: Events are stored as state changes, parameters are delta encoded when possible
 typedef enum AutomationEventType {
-    EVENT_NONE = 0,
+    EVENT_NONE = 0,                 // End of frame events
     // Input events
     INPUT_KEY_UP,                   // param[0]: key
     INPUT_KEY_DOWN,                 // param[0]: key
-    INPUT_KEY_PRESSED,              // param[0]: key
-    INPUT_KEY_RELEASED,             // param[0]: key
+    INPUT_KEY_PRESSED,              // param[0]: key (keys pressed queue)
+    INPUT_CHAR_PRESSED,             // param[0]: codepoint (chars pressed queue)
     INPUT_MOUSE_BUTTON_UP,          // param[0]: button
     INPUT_MOUSE_BUTTON_DOWN,        // param[0]: button
-    INPUT_MOUSE_POSITION,           // param[0]: x, param[1]: y
-    INPUT_MOUSE_WHEEL_MOTION,       // param[0]: x delta, param[1]: y delta
+    INPUT_MOUSE_POSITION,           // param[0]: x delta, param[1]: y delta
+    INPUT_MOUSE_WHEEL_MOTION,       // param[0]: x, param[1]: y
     INPUT_GAMEPAD_CONNECT,          // param[0]: gamepad
     INPUT_GAMEPAD_DISCONNECT,       // param[0]: gamepad
-    INPUT_GAMEPAD_BUTTON_UP,        // param[0]: button
-    INPUT_GAMEPAD_BUTTON_DOWN,      // param[0]: button
-    INPUT_GAMEPAD_AXIS_MOTION,      // param[0]: axis, param[1]: delta
+    INPUT_GAMEPAD_BUTTON_UP,        // param[0]: gamepad, param[1]: button
+    INPUT_GAMEPAD_BUTTON_DOWN,      // param[0]: gamepad, param[1]: button
+    INPUT_GAMEPAD_AXIS_MOTION,      // param[0]: gamepad, param[1]: axis, param[2]: value
     INPUT_TOUCH_UP,                 // param[0]: id
     INPUT_TOUCH_DOWN,               // param[0]: id
-    INPUT_TOUCH_POSITION,           // param[0]: x, param[1]: y
+    INPUT_TOUCH_POSITION,           // param[0]: id, param[1]: x delta, param[2]: y delta
+    INPUT_TOUCH_COUNT,              // param[0]: touch points count
     INPUT_GESTURE,                  // param[0]: gesture
-    // Window events
-    WINDOW_CLOSE,                   // no params
-    WINDOW_MAXIMIZE,                // no params
-    WINDOW_MINIMIZE,                // no params
-    WINDOW_RESIZE,                  // param[0]: width, param[1]: height
-    // Custom events
-    ACTION_TAKE_SCREENSHOT,
-    ACTION_SETTARGETFPS
+    AUTOMATION_EVENT_TYPES_COUNT
 } AutomationEventType;
-
-// Event type
-// Used to enable events flags
-typedef enum {
-    EVENT_INPUT_KEYBOARD    = 0,
-    EVENT_INPUT_MOUSE       = 1,
-    EVENT_INPUT_GAMEPAD     = 2,
-    EVENT_INPUT_TOUCH       = 4,
-    EVENT_INPUT_GESTURE     = 8,
-    EVENT_WINDOW            = 16,
-    EVENT_CUSTOM            = 32
-} EventType;
-
-static const char *autoEventTypeName[] = {
-    "EVENT_NONE",
-    "INPUT_KEY_UP",
-    "INPUT_KEY_DOWN",
-    "INPUT_KEY_PRESSED",
-    "INPUT_KEY_RELEASED",
-    "INPUT_MOUSE_BUTTON_UP",
-    "INPUT_MOUSE_BUTTON_DOWN",
-    "INPUT_MOUSE_POSITION",
-    "INPUT_MOUSE_WHEEL_MOTION",
-    "INPUT_GAMEPAD_CONNECT",
-    "INPUT_GAMEPAD_DISCONNECT",
-    "INPUT_GAMEPAD_BUTTON_UP",
-    "INPUT_GAMEPAD_BUTTON_DOWN",
-    "INPUT_GAMEPAD_AXIS_MOTION",
-    "INPUT_TOUCH_UP",
-    "INPUT_TOUCH_DOWN",
-    "INPUT_TOUCH_POSITION",
-    "INPUT_GESTURE",
-    "WINDOW_CLOSE",
-    "WINDOW_MAXIMIZE",
-    "WINDOW_MINIMIZE",
-    "WINDOW_RESIZE",
-    "ACTION_TAKE_SCREENSHOT",
-    "ACTION_SETTARGETFPS"
-};
-
-// Automation Event (24 bytes)
-typedef struct AutomationEvent {
-    unsigned int frame;                 // Event frame
-    unsigned int type;                  // Event type (AutomationEventType)
-    int params[4];                      // Event parameters (if required)
-} AutomationEvent;
-
-static AutomationEvent *events = NULL;  // Events array
-static unsigned int eventCount = 0;     // Events count
-static bool eventsPlaying = false;      // Play events
-static bool eventsRecording = false;    // Record events
-
-//static short eventsEnabled = 0b0000001111111111;    // Events enabled for checking
-#endif
 //-----------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------
@@ -624,12 +932,22 @@ extern void UnloadFontDefault(void);        // [Module: text] Unloads default fo
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void InitTimer(void);                            // Initialize timer (hi-resolution if available)
+#if !defined(SUPPORT_BUSY_WAIT_LOOP)
+static void SleepSeconds(double seconds);               // Halt program execution using system sleep functions
+#if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+static void UpdateSleepOvershoot(double overshoot);     // Update system sleep overshoot estimation
+#endif
+#endif
+static void UpdateFrameStats(double frameTime);         // Register frame time into frame statistics
+static int CompareFrameTimes(const void *a, const void *b); // Compare frame times, used for sorting
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
 
-static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+static void AddFilePath(FilePathBuilder *builder, const char *path);   // Add path to file paths builder, grows arena if required
+static FilePathList BuildFilePathList(FilePathBuilder *builder);       // Build file paths list from builder (single allocation), builder is unloaded
+static void ScanDirectoryFiles(const char *basePath, FilePathBuilder *builder, const char *filter);   // Scan all files and directories in a base path
+static void ScanDirectoryFilesRecursively(const char *basePath, FilePathBuilder *builder, const char *filter);  // Scan all files and directories recursively from a base path
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
@@ -688,13 +1006,64 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 
 #endif  // PLATFORM_RPI || PLATFORM_DRM
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-static void LoadAutomationEvents(const char *fileName);     // Load automation events from file
-static void ExportAutomationEvents(const char *fileName);   // Export recorded automation events into a file
-static void RecordAutomationEvent(unsigned int frame);      // Record frame events (to internal events array)
-static void PlayAutomationEvent(unsigned int frame);        // Play frame events (from internal events array)
+#if defined(SUPPORT_COMPRESSION_API)
+static int CompressDataBlocks(struct sdefl *s, unsigned char *out, const unsigned char *in, int start, int end, int level, bool last); // Compress data blocks into a DEFLATE stream
+static void *DecompressGrowBuffer(void *data, int *capacity, int required);   // Grow decompression output buffer, keeps decompressed data
+#if defined(JOB_SYSTEM_THREADED)
+static void CompressChunks(CompressionTask *task);           // Compress task chunks until all of them have been claimed
+static void CompressionTaskWork(void *data);                // Compression task job work
+static void ReleaseCompressionTask(CompressionTask *task);   // Release compression task reference
+#endif
+#endif
+
+#if defined(SUPPORT_JOB_SYSTEM)
+static void InitJobSystem(void);                            // Initialize job system (worker threads)
+static void CloseJobSystem(void);                           // Close job system, waits for running jobs
+static void ProcessJobsFinish(double budget);               // Run finished jobs finish steps on main thread, within time budget
+#if defined(JOB_SYSTEM_THREADED)
+static void RunJobWorker(void);                             // Job worker threads loop
+static void RunJobRangesTask(JobRangesTask *task);          // Run task ranges until all of them have been claimed
+static void JobRangesTaskWork(void *data);                  // Job ranges task job work
+static void ReleaseJobRangesTask(JobRangesTask *task);      // Release job ranges task reference
+#if defined(_WIN32)
+static unsigned long __stdcall JobWorkerThread(void *arg);  // Job worker thread (Win32)
+#else
+static void *JobWorkerThread(void *arg);                    // Job worker thread (POSIX)
+#endif
+#endif
+#endif
+
+#if defined(SUPPORT_PROFILER)
+static ProfileThreadBuffer *GetProfileThreadBuffer(void);   // Get current thread profile zones buffer, registered on first use
+static void UnloadProfileBuffers(void);                     // Unload all threads profile zones buffers
+static void UpdateProfileGpuZones(void);                    // Record finished GPU timer zones into profile trace
+#endif
+
+static void RequestScreenCapture(int type, const char *fileName);  // Request screen capture, pixels are read back some frames later
+static void ProcessScreenCaptures(bool all);                // Process screen captures read back, previous frames only or all of them
+static void ReadbackScreenCapture(int slot);                // Read back screen capture pixels and dispatch capture for encoding
+static void DispatchScreenCapture(ScreenCapture capture);   // Dispatch screen capture for encoding (screenshot job or recording frames queue)
+static void ScreenshotWork(void *data);                     // Screenshot job work: export image file
+static void ScreenshotFinish(void *data);                   // Screenshot job finish: notify and free screenshot data
+static void CloseScreenCapture(void);                       // Close screen capture, finish recording and pending screenshots
+#if defined(SUPPORT_GIF_RECORDING)
+static void PushRecordingFrame(ScreenCapture frame);        // Push recording frame into encoding queue
+#if defined(JOB_SYSTEM_THREADED)
+static void RecordingEncoderWork(void *data);               // Recording frames encoder job work
+#endif
+static void EncodeRecordingFrame(const ScreenCapture *frame);   // Encode recording frame (GIF or raw video frame)
 #endif
 
+static void UpdateAutomationEvents(void);                   // Record or play automation events for current frame (after input polling)
+static void RecordAutomationFrame(void);                    // Record current frame input state changes into events stream
+static void PlayAutomationFrame(void);                      // Play next frame events from events stream into input state
+static void ReleaseAutomationInput(void);                   // Release keys and buttons held by played events, once playing stops
+static void UnloadAutomationEvents(void);                   // Unload automation events stream chunks
+static void WriteAutomationValue(unsigned int value);       // Write unsigned value into events stream (variable-length)
+static void WriteAutomationSigned(int value);               // Write signed value into events stream (zigzag, variable-length)
+static unsigned int ReadAutomationValue(void);              // Read unsigned value from events stream (variable-length)
+static int ReadAutomationSigned(void);                      // Read signed value from events stream (zigzag, variable-length)
+
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -877,6 +1246,9 @@ void InitWindow(int width, int height, const char *title)
     // Initialize hi-res timer
     InitTimer();
 
+    // Load main thread frame memory arena (MemAllocFrame() allocations)
+    LoadMemFrame();
+
     // Initialize random seed
     srand((unsigned int)time(NULL));
 
@@ -947,26 +1319,24 @@ void InitWindow(int width, int height, const char *title)
     emscripten_set_gamepaddisconnected_callback(NULL, 1, EmscriptenGamepadCallback);
 #endif
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-    events = (AutomationEvent *)RL_CALLOC(MAX_CODE_AUTOMATION_EVENTS, sizeof(AutomationEvent));
-    CORE.Time.frameCounter = 0;
-#endif
-
 #endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_RPI || PLATFORM_DRM
 }
 
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
-#if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
+    CloseScreenCapture();       // Finish screen recording and pending screenshots
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    CloseJobSystem();           // Wait for running jobs and close workers
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    UnloadProfileBuffers();     // Unload recorded profile zones
 #endif
 
+    UnloadMemFrame();           // Unload main thread frame memory arena
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
@@ -1095,9 +1465,7 @@ void CloseWindow(void)
     if (CORE.Input.Gamepad.threadId) pthread_join(CORE.Input.Gamepad.threadId, NULL);
 #endif
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-    RL_FREE(events);
-#endif
+    UnloadAutomationEvents();       // Unload automation events stream
 
     CORE.Window.ready = false;
     TRACELOG(LOG_INFO, "Window closed successfully");
@@ -2155,8 +2523,13 @@ void BeginDrawing(void)
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void)
 {
+    PROFILE_ZONE_BEGIN("EndDrawing");
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+    // Process screen captures read back on previous frames, encoded on jobs
+    ProcessScreenCaptures(false);
+
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
     if (gifRecording)
@@ -2164,17 +2537,9 @@ void EndDrawing(void)
         #define GIF_RECORD_FRAMERATE    10
         gifFrameCounter++;
 
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-            msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
-
-            RL_FREE(screenData);    // Free image data
-        }
+        // NOTE: We record one gif frame every 10 game frames, raw video frames are recorded every frame
+        // Frame pixels are read back asynchronously (from backbuffer), before drawing the record indicator
+        if ((CORE.Capture.recording->file != NULL) || ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)) RequestScreenCapture(SCREEN_CAPTURE_RECORDING, NULL);
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
         if (((gifFrameCounter/15)%2) == 1)
@@ -2190,7 +2555,7 @@ void EndDrawing(void)
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     // Draw record/play indicator
-    if (eventsRecording)
+    if (CORE.Automation.recording)
     {
         gifFrameCounter++;
 
@@ -2202,7 +2567,7 @@ void EndDrawing(void)
 
         rlDrawRenderBatchActive();  // Update and draw internal render batch
     }
-    else if (eventsPlaying)
+    else if (CORE.Automation.playing)
     {
         gifFrameCounter++;
 
@@ -2216,8 +2581,26 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(SUPPORT_JOB_SYSTEM)
+    // Run finished jobs finish steps (i.e. GPU uploads), limited by a time budget per frame
+    if (CORE.Jobs.finishedCount > 0)
+    {
+        PROFILE_ZONE_BEGIN("ProcessJobsFinish");
+        ProcessJobsFinish(CORE.Jobs.finishBudget);
+        PROFILE_ZONE_END();
+    }
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    UpdateProfileGpuZones();        // Record finished GPU timer zones (from previous frames)
+#endif
+
+    ResetMemFrame();                // Reset main thread frame memory (MemAllocFrame() allocations)
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    PROFILE_ZONE_BEGIN("SwapScreenBuffer");
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+    PROFILE_ZONE_END();
 
     // Frame time control system
     CORE.Time.current = GetTime();
@@ -2227,9 +2610,12 @@ void EndDrawing(void)
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
     // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    // NOTE: Frames are not paced while playing automation events with a fixed time step
+    if ((CORE.Time.frame < CORE.Time.target) && !(CORE.Automation.playing && (CORE.Automation.timeStep > 0.0f)))
     {
+        PROFILE_ZONE_BEGIN("WaitTime");
         WaitTime(CORE.Time.target - CORE.Time.frame);
+        PROFILE_ZONE_END();
 
         CORE.Time.current = GetTime();
         double waitTime = CORE.Time.current - CORE.Time.previous;
@@ -2238,21 +2624,16 @@ void EndDrawing(void)
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
-    PollInputEvents();      // Poll user events (before next frame update)
-#endif
+    UpdateFrameStats(CORE.Time.frame);
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-    // Events recording and playing logic
-    if (eventsRecording) RecordAutomationEvent(CORE.Time.frameCounter);
-    else if (eventsPlaying)
-    {
-        // TODO: When should we play? After/before/replace PollInputEvents()?
-        if (CORE.Time.frameCounter >= eventCount) eventsPlaying = false;
-        PlayAutomationEvent(CORE.Time.frameCounter);
-    }
+    PROFILE_ZONE_BEGIN("PollInputEvents");
+    PollInputEvents();      // Poll user events (before next frame update)
+    PROFILE_ZONE_END();
 #endif
 
     CORE.Time.frameCounter++;
+
+    PROFILE_ZONE_END();
 }
 
 // Initialize 2D mode with custom camera (2D)
@@ -2339,6 +2720,7 @@ void BeginTextureMode(RenderTexture2D target)
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
     rlEnableFramebuffer(target.id); // Enable render target
+    rlBeginGpuZone("TextureMode");  // Measure render texture pass GPU time
 
     // Set viewport and RLGL internal framebuffer size
     rlViewport(0, 0, target.texture.width, target.texture.height);
@@ -2368,6 +2750,7 @@ void EndTextureMode(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+    rlEndGpuZone();
     rlDisableFramebuffer();         // Disable render target (fbo)
 
     // Set viewport to default framebuffer size
@@ -2450,6 +2833,65 @@ void EndVrStereoMode(void)
     rlDisableStereoRender();
 }
 
+// Begin recording drawing into a display list
+// NOTE: Drawing is recorded instead of drawn, only vertex data and textures are recorded,
+// state changes (shader, blending, scissor, camera) must be set again when drawing the display list
+void BeginDisplayList(void)
+{
+    rlBeginDisplayList();
+}
+
+// End recording drawing into a display list, recorded drawing is loaded into GPU
+DisplayList EndDisplayList(void)
+{
+    DisplayList list = { 0 };
+
+    rlDisplayList recorded = rlEndDisplayList();
+
+    if (recorded.vertexCount > 0)
+    {
+        list.vertexCount = recorded.vertexCount;
+        list.drawCount = recorded.drawCount;
+        list.state = RL_MALLOC(sizeof(rlDisplayList));
+
+        if (list.state != NULL) *((rlDisplayList *)list.state) = recorded;
+        else rlUnloadDisplayList(recorded);
+    }
+    else rlUnloadDisplayList(recorded);
+
+    return list;
+}
+
+// Unload display list from GPU memory (VRAM)
+void UnloadDisplayList(DisplayList list)
+{
+    if (list.state == NULL) return;
+
+    rlUnloadDisplayList(*((rlDisplayList *)list.state));
+    RL_FREE(list.state);
+}
+
+// Draw display list at position with tint
+void DrawDisplayList(DisplayList list, Vector2 position, Color tint)
+{
+    DrawDisplayListEx(list, position, 0.0f, 1.0f, tint);
+}
+
+// Draw display list with extended parameters
+// NOTE: Recorded drawing is translated to position, rotated and scaled around its origin
+void DrawDisplayListEx(DisplayList list, Vector2 position, float rotation, float scale, Color tint)
+{
+    if (list.state == NULL) return;
+
+    rlPushMatrix();
+        rlTranslatef(position.x, position.y, 0.0f);
+        rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+        rlScalef(scale, scale, 1.0f);
+
+        rlDrawDisplayList(*((rlDisplayList *)list.state), (float)tint.r/255.0f, (float)tint.g/255.0f, (float)tint.b/255.0f, (float)tint.a/255.0f);
+    rlPopMatrix();
+}
+
 // Load VR stereo config for VR simulator device parameters
 VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device)
 {
@@ -2902,6 +3344,50 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get frame time statistics from frame times history
+// NOTE: Frame times are registered on EndDrawing(), percentiles are computed on call
+FrameStats GetFrameStats(void)
+{
+    FrameStats stats = { 0 };
+
+    int count = (int)CORE.Time.frameHistoryCount;
+    stats.frameCount = count;
+    stats.hitchCount = (int)CORE.Time.hitchCount;
+    stats.sleepOvershoot = (float)CORE.Time.sleepOvershoot;
+
+    if (count > 0)
+    {
+        float sortedTimes[FRAME_TIME_HISTORY_SIZE] = { 0 };
+        float total = 0.0f;
+
+        for (int i = 0; i < count; i++)
+        {
+            sortedTimes[i] = CORE.Time.frameHistory[i];
+            total += sortedTimes[i];
+        }
+
+        qsort(sortedTimes, count, sizeof(float), CompareFrameTimes);
+
+        stats.average = total/count;
+        stats.min = sortedTimes[0];
+        stats.max = sortedTimes[count - 1];
+        stats.p50 = sortedTimes[(count - 1)*50/100];
+        stats.p90 = sortedTimes[(count - 1)*90/100];
+        stats.p99 = sortedTimes[(count - 1)*99/100];
+    }
+
+    return stats;
+}
+
+// Reset frame time statistics: frame times history and hitches count
+void ResetFrameStats(void)
+{
+    CORE.Time.frameHistoryIndex = 0;
+    CORE.Time.frameHistoryCount = 0;
+    CORE.Time.frameAverage = 0.0;
+    CORE.Time.hitchCount = 0;
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -2936,127 +3422,359 @@ void SetConfigFlags(unsigned int flags)
 // NOTE TRACELOG() function is located in [utils.h]
 
 // Takes a screenshot of current screen (saved a .png)
+// NOTE: Screen pixels are read back asynchronously and image is exported on a job,
+// so file is written some frames later (all pending screenshots are written on CloseWindow())
 void TakeScreenshot(const char *fileName)
 {
 #if defined(SUPPORT_MODULE_RTEXTURES)
     // Security check to (partially) avoid malicious code on PLATFORM_WEB
     if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character");  return; }
 
-    Vector2 scale = GetWindowScaleDPI();
-    unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-    Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
-
     char path[2048] = { 0 };
     strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
 
-    ExportImage(image, path);           // WARNING: Module required: rtextures
-    RL_FREE(imgData);
-
-#if defined(PLATFORM_WEB)
-    // Download file from MEMFS (emscripten memory filesystem)
-    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
-    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(path), GetFileName(path)));
-#endif
-
-    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+    RequestScreenCapture(SCREEN_CAPTURE_SCREENSHOT, path);
 #else
     TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
 #endif
 }
 
-// Get a random value between min and max (both included)
-// WARNING: Ranges higher than RAND_MAX will return invalid results
-// More specifically, if (max - min) > INT_MAX there will be an overflow,
-// and otherwise if (max - min) > RAND_MAX the random value will incorrectly never exceed a certain threshold
-int GetRandomValue(int min, int max)
+// Start screen recording into file (.gif or raw RGBA video frames)
+// NOTE: GIF records one frame every 10 frames, any other file extension records
+// raw RGBA frames (one per frame), frames are encoded on jobs
+void StartScreenRecording(const char *fileName)
 {
-    if (min > max)
+#if defined(SUPPORT_GIF_RECORDING)
+    // Security check to (partially) avoid malicious code on PLATFORM_WEB
+    if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character");  return; }
+
+    if (gifRecording) StopScreenRecording();
+
+    ScreenRecording *recording = (ScreenRecording *)RL_CALLOC(1, sizeof(ScreenRecording));
+    if (recording == NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate memory for screen recording"); return; }
+
+    Vector2 scale = GetWindowScaleDPI();
+    recording->width = (int)((float)CORE.Window.render.width*scale.x);
+    recording->height = (int)((float)CORE.Window.render.height*scale.y);
+    CORE.Capture.framesDropped = 0;
+
+    strncpy(recording->fileName, TextFormat("%s/%s", CORE.Storage.basePath, fileName), MAX_FILEPATH_LENGTH - 1);
+
+#if defined(JOB_SYSTEM_THREADED)
+    if (!CORE.Capture.mutexReady)
     {
-        int tmp = max;
-        max = min;
-        min = tmp;
+        JOB_MUTEX_INIT(&CORE.Capture.mutex);
+        CORE.Capture.mutexReady = true;
     }
+#endif
 
-    if ((unsigned int)(max - min) > (unsigned int)RAND_MAX)
+    if (IsFileExtension(fileName, ".gif"))
     {
-        TRACELOG(LOG_WARNING, "Invalid GetRandomValue() arguments, range should not be higher than %i", RAND_MAX);
+        msf_gif_begin(&recording->gifState, recording->width, recording->height);
+
+        TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", fileName);
     }
+    else
+    {
+        recording->file = fopen(recording->fileName, "wb");
 
-    return (rand()%(abs(max - min) + 1) + min);
+        if (recording->file == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to open screen recording file", fileName);
+            RL_FREE(recording);
+            return;
+        }
+
+        TRACELOG(LOG_INFO, "SYSTEM: Start raw video recording: %s", fileName);
+        TRACELOG(LOG_INFO, "    > Convert with: ffmpeg -f rawvideo -pixel_format rgb0 -video_size %ix%i -framerate %i -i %s out.mp4",
+            recording->width, recording->height, (CORE.Time.target > 0.0)? (int)(1.0/CORE.Time.target + 0.5) : 60, GetFileName(fileName));
+    }
+
+    CORE.Capture.recording = recording;
+    gifRecording = true;
+    gifFrameCounter = 0;
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Screen recording requires SUPPORT_GIF_RECORDING");
+#endif
 }
 
-// Set the seed for the random number generator
-void SetRandomSeed(unsigned int seed)
+// Stop screen recording, waits for pending frames encoding and saves file
+void StopScreenRecording(void)
 {
-    srand(seed);
+#if defined(SUPPORT_GIF_RECORDING)
+    if (!gifRecording) return;
+
+    gifRecording = false;
+
+    // Read back frames in flight and wait for encoder to process all of them,
+    // recording state is not accessed by encoder jobs after this point
+    ProcessScreenCaptures(true);
+    if (CORE.Capture.encoderJob != 0) WaitJob(CORE.Capture.encoderJob);
+    CORE.Capture.encoderJob = 0;
+
+    ScreenRecording *recording = CORE.Capture.recording;
+    CORE.Capture.recording = NULL;
+
+    if (recording->file != NULL)
+    {
+        fclose(recording->file);
+
+        TRACELOG(LOG_INFO, "SYSTEM: Finish raw video recording");
+    }
+    else
+    {
+        MsfGifResult result = msf_gif_end(&recording->gifState);
+
+        SaveFileData(recording->fileName, result.data, (unsigned int)result.dataSize);
+        msf_gif_free(result);
+
+    #if defined(PLATFORM_WEB)
+        // Download file from MEMFS (emscripten memory filesystem)
+        // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
+        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(recording->fileName), GetFileName(recording->fileName)));
+    #endif
+
+        TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
+    }
+
+    RL_FREE(recording);
+
+    if (CORE.Capture.framesDropped > 0) TRACELOG(LOG_WARNING, "SYSTEM: Screen recording dropped %i frames, encoding could not keep up", CORE.Capture.framesDropped);
+#endif
 }
 
-// Check if the file exists
-bool FileExists(const char *fileName)
+// Start recording automation events (input state changes), previous events are discarded
+// NOTE: Recording has no events limit, events stream grows in chunks
+void StartAutomationEventRecording(void)
 {
-    bool result = false;
+    UnloadAutomationEvents();
+    memset(&CORE.Automation.state, 0, sizeof(AutomationInputState));
 
-#if defined(_WIN32)
-    if (_access(fileName, 0) != -1) result = true;
-#else
-    if (access(fileName, F_OK) != -1) result = true;
-#endif
+    CORE.Automation.recording = true;
+    TRACELOG(LOG_INFO, "SYSTEM: Automation events recording started");
+}
 
-    // NOTE: Alternatively, stat() can be used instead of access()
-    //#include <sys/stat.h>
-    //struct stat statbuf;
-    //if (stat(filename, &statbuf) == 0) result = true;
+// Stop recording automation events
+void StopAutomationEventRecording(void)
+{
+    if (!CORE.Automation.recording) return;
 
-    return result;
+    CORE.Automation.recording = false;
+    TRACELOG(LOG_INFO, "SYSTEM: Automation events recording stopped: %i frames, %i events", CORE.Automation.frameCount, CORE.Automation.eventCount);
 }
 
-// Check file extension
-// NOTE: Extensions checking is not case-sensitive
-bool IsFileExtension(const char *fileName, const char *ext)
+// Export automation events into a binary file
+// File format: "rAE " id, version, frames count, events count, data size (unsigned int each), events stream data
+bool ExportAutomationEvents(const char *fileName)
 {
-    #define MAX_FILE_EXTENSION_SIZE  16
+    bool success = false;
+    unsigned int dataSize = 0;
 
-    bool result = false;
-    const char *fileExt = GetFileExtension(fileName);
+    for (AutomationChunk *chunk = CORE.Automation.first; chunk != NULL; chunk = chunk->next) dataSize += chunk->size;
+
+    FILE *repFile = fopen(fileName, "wb");
 
-    if (fileExt != NULL)
+    if (repFile != NULL)
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount);  // WARNING: Module required: rtext
+        unsigned int header[4] = { 1, CORE.Automation.frameCount, CORE.Automation.eventCount, dataSize };
 
-        char fileExtLower[MAX_FILE_EXTENSION_SIZE + 1] = { 0 };
-        strncpy(fileExtLower, TextToLower(fileExt), MAX_FILE_EXTENSION_SIZE);  // WARNING: Module required: rtext
+        success = (fwrite("rAE ", 1, 4, repFile) == 4) && (fwrite(header, sizeof(unsigned int), 4, repFile) == 4);
 
-        for (int i = 0; i < extCount; i++)
+        for (AutomationChunk *chunk = CORE.Automation.first; success && (chunk != NULL); chunk = chunk->next)
         {
-            if (strcmp(fileExtLower, TextToLower(checkExts[i])) == 0)
-            {
-                result = true;
-                break;
-            }
+            success = (fwrite(chunk->data, 1, chunk->size, repFile) == chunk->size);
         }
-#else
-        if (strcmp(fileExt, ext) == 0) result = true;
-#endif
+
+        fclose(repFile);
     }
 
-    return result;
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Automation events exported successfully (%i frames, %i bytes)", fileName, CORE.Automation.frameCount, dataSize);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export automation events", fileName);
+
+    return success;
 }
 
-// Check if a directory path exists
-bool DirectoryExists(const char *dirPath)
+// Load automation events from a binary file, ready to be played
+bool LoadAutomationEvents(const char *fileName)
 {
-    bool result = false;
-    DIR *dir = opendir(dirPath);
+    bool success = false;
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileSize);
 
-    if (dir != NULL)
+    if (fileData != NULL)
     {
-        result = true;
-        closedir(dir);
-    }
+        unsigned int header[4] = { 0 };
 
-    return result;
+        if ((fileSize >= 20) && (memcmp(fileData, "rAE ", 4) == 0)) memcpy(header, fileData + 4, sizeof(header));
+
+        if ((header[0] == 1) && (header[3] <= (fileSize - 20)))
+        {
+            UnloadAutomationEvents();
+
+            // NOTE: Loaded stream is stored in a single chunk
+            AutomationChunk *chunk = (AutomationChunk *)RL_CALLOC(1, sizeof(AutomationChunk));
+            chunk->data = (unsigned char *)RL_MALLOC((header[3] > 0)? header[3] : 1);
+            chunk->size = header[3];
+            chunk->capacity = header[3];
+            memcpy(chunk->data, fileData + 20, header[3]);
+
+            CORE.Automation.first = chunk;
+            CORE.Automation.last = chunk;
+            CORE.Automation.frameCount = header[1];
+            CORE.Automation.eventCount = header[2];
+            success = true;
+
+            TRACELOG(LOG_INFO, "FILEIO: [%s] Automation events loaded successfully (%i frames, %i events)", fileName, header[1], header[2]);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Automation events file not valid", fileName);
+
+        UnloadFileData(fileData);
+    }
+
+    return success;
+}
+
+// Start playing automation events, played input state replaces polled input state every frame
+// NOTE: If timeStep > 0, GetFrameTime() returns timeStep and frames are not paced (replay faster than real time,
+// VSync should be disabled), otherwise GetFrameTime() returns recorded frame times
+void PlayAutomationEvents(float timeStep)
+{
+    StopAutomationEventRecording();
+    if (CORE.Automation.playing) ReleaseAutomationInput();
+
+    memset(&CORE.Automation.state, 0, sizeof(AutomationInputState));
+    CORE.Automation.readChunk = CORE.Automation.first;
+    CORE.Automation.readOffset = 0;
+    CORE.Automation.readFrame = 0;
+    CORE.Automation.timeStep = timeStep;
+    CORE.Automation.playing = (CORE.Automation.frameCount > 0);
+
+    if (CORE.Automation.playing) TRACELOG(LOG_INFO, "SYSTEM: Automation events playing started (%i frames)", CORE.Automation.frameCount);
+}
+
+// Stop playing automation events, input state is polled again
+void StopAutomationEventPlaying(void)
+{
+    if (CORE.Automation.playing) ReleaseAutomationInput();
+    CORE.Automation.playing = false;
+}
+
+// Check if automation events are being recorded
+bool IsAutomationEventRecording(void)
+{
+    return CORE.Automation.recording;
+}
+
+// Check if automation events are being played
+bool IsAutomationEventPlaying(void)
+{
+    return CORE.Automation.playing;
+}
+
+// Get a random value between min and max (both included)
+// WARNING: Ranges higher than RAND_MAX will return invalid results
+// More specifically, if (max - min) > INT_MAX there will be an overflow,
+// and otherwise if (max - min) > RAND_MAX the random value will incorrectly never exceed a certain threshold
+int GetRandomValue(int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    if ((unsigned int)(max - min) > (unsigned int)RAND_MAX)
+    {
+        TRACELOG(LOG_WARNING, "Invalid GetRandomValue() arguments, range should not be higher than %i", RAND_MAX);
+    }
+
+    return (rand()%(abs(max - min) + 1) + min);
+}
+
+// Set the seed for the random number generator
+void SetRandomSeed(unsigned int seed)
+{
+    srand(seed);
+}
+
+// Check if the file exists
+bool FileExists(const char *fileName)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    if (_access(fileName, 0) != -1) result = true;
+#else
+    if (access(fileName, F_OK) != -1) result = true;
+#endif
+
+    // NOTE: Alternatively, stat() can be used instead of access()
+    //#include <sys/stat.h>
+    //struct stat statbuf;
+    //if (stat(filename, &statbuf) == 0) result = true;
+
+    return result;
+}
+
+// Check file extension
+// NOTE: Extensions checking is not case-sensitive, multiple extensions can be provided separated by ';'
+// NOTE: Function is reentrant (no internal static buffers), it can be used from job worker threads
+bool IsFileExtension(const char *fileName, const char *ext)
+{
+    #define MAX_FILE_EXTENSION_SIZE  16
+
+    bool result = false;
+    const char *fileExt = GetFileExtension(fileName);
+
+    if ((fileExt != NULL) && (ext != NULL))
+    {
+        char fileExtLower[MAX_FILE_EXTENSION_SIZE + 1] = { 0 };
+
+        for (int i = 0; (i < MAX_FILE_EXTENSION_SIZE) && (fileExt[i] != '\0'); i++) fileExtLower[i] = (char)tolower((unsigned char)fileExt[i]);
+
+        // Compare file extension against every ';' separated extension
+        const char *checkExt = ext;
+
+        while (!result && (checkExt != NULL))
+        {
+            const char *separator = strchr(checkExt, ';');
+            int checkExtLength = (separator != NULL)? (int)(separator - checkExt) : (int)strlen(checkExt);
+
+            if (checkExtLength == (int)strlen(fileExtLower))
+            {
+                result = true;
+
+                for (int i = 0; i < checkExtLength; i++)
+                {
+                    if (tolower((unsigned char)checkExt[i]) != fileExtLower[i])
+                    {
+                        result = false;
+                        break;
+                    }
+                }
+            }
+
+            checkExt = (separator != NULL)? separator + 1 : NULL;
+        }
+    }
+
+    return result;
+}
+
+// Check if a directory path exists
+bool DirectoryExists(const char *dirPath)
+{
+    bool result = false;
+    DIR *dir = opendir(dirPath);
+
+    if (dir != NULL)
+    {
+        result = true;
+        closedir(dir);
+    }
+
+    return result;
 }
 
 // Get file length in bytes
@@ -3290,38 +4008,17 @@ const char *GetApplicationDirectory(void)
 
 // Load directory filepaths
 // NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
 // No recursive scanning is done!
 FilePathList LoadDirectoryFiles(const char *dirPath)
 {
     FilePathList files = { 0 };
-    unsigned int fileCounter = 0;
 
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
-
-    if (dir != NULL) // It's a directory
+    if (DirectoryExists(dirPath))
     {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
-
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
         // NOTE: Directory paths are also registered
-        ScanDirectoryFiles(dirPath, &files, NULL);
-
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) TRACELOG(LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
+        FilePathBuilder builder = { 0 };
+        ScanDirectoryFiles(dirPath, &builder, NULL);
+        files = BuildFilePathList(&builder);
     }
     else TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
 
@@ -3329,28 +4026,23 @@ FilePathList LoadDirectoryFiles(const char *dirPath)
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use MAX_FILEPATH_CAPACITY
+// NOTE: Paths storage grows as required, there is no maximum files count
 FilePathList LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
-    FilePathList files = { 0 };
-
-    files.capacity = MAX_FILEPATH_CAPACITY;
-    files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
+    FilePathBuilder builder = { 0 };
 
     // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &files, filter);
-    else ScanDirectoryFiles(basePath, &files, filter);
+    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &builder, filter);
+    else ScanDirectoryFiles(basePath, &builder, filter);
 
-    return files;
+    return BuildFilePathList(&builder);
 }
 
 // Unload directory filepaths
+// NOTE: Paths pointers and paths strings are stored in a single memory block
 // WARNING: files.count is not reseted to 0 after unloading
 void UnloadDirectoryFiles(FilePathList files)
 {
-    for (unsigned int i = 0; i < files.capacity; i++) RL_FREE(files.paths[i]);
-
     RL_FREE(files.paths);
 }
 
@@ -3423,40 +4115,131 @@ long GetFileModTime(const char *fileName)
 }
 
 // Compress data (DEFLATE algorithm)
+// NOTE: Compression level 8, same as stbiw
 unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
+    return CompressDataEx(data, dataSize, compDataSize, COMPRESSION_LEVEL_DEFAULT);
+}
 
+// Compress data (DEFLATE algorithm) with compression level: 0 (fastest) to 8 (best)
+// NOTE: Big data is split in chunks compressed in parallel by job workers (if available),
+// chunks are joined into a single valid DEFLATE stream, each chunk uses previous data as dictionary
+unsigned char *CompressDataEx(const unsigned char *data, int dataSize, int *compDataSize, int level)
+{
     unsigned char *compData = NULL;
+    *compDataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
-    // Compress data and generate a valid DEFLATE stream
-    struct sdefl sdefl = { 0 };
-    int bounds = sdefl_bound(dataSize);
-    compData = (unsigned char *)RL_CALLOC(bounds, 1);
-    *compDataSize = sdeflate(&sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbiw
+    if (level < 0) level = 0;
+    if (level > SDEFL_LVL_MAX) level = SDEFL_LVL_MAX;
+
+#if defined(JOB_SYSTEM_THREADED)
+    int chunkCount = (dataSize + COMPRESSION_CHUNK_SIZE - 1)/COMPRESSION_CHUNK_SIZE;
 
-    TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
+    InitJobSystem();
+
+    if ((chunkCount > 1) && CORE.Jobs.ready)
+    {
+        CompressionTask *task = (CompressionTask *)RL_CALLOC(1, sizeof(CompressionTask));
+        task->data = data;
+        task->dataSize = dataSize;
+        task->level = level;
+        task->chunkCount = chunkCount;
+        task->chunkData = (unsigned char **)RL_CALLOC(chunkCount, sizeof(unsigned char *));
+        task->chunkSize = (int *)RL_CALLOC(chunkCount, sizeof(int));
+        JOB_MUTEX_INIT(&task->mutex);
+        JOB_CONDITION_INIT(&task->chunksDone);
+
+        int jobCount = (chunkCount - 1 < CORE.Jobs.workerCount)? chunkCount - 1 : CORE.Jobs.workerCount;
+        task->refCount = jobCount + 1;
+
+        // Worker jobs and calling thread compress chunks until all of them are claimed
+        // NOTE: Calling thread never waits for jobs to start, so it is safe to use from a job
+        for (int i = 0; i < jobCount; i++) QueueJob(CompressionTaskWork, NULL, task);
+        CompressChunks(task);
+
+        JOB_MUTEX_LOCK(&task->mutex);
+        while (task->doneChunks < task->chunkCount) JOB_CONDITION_WAIT(&task->chunksDone, &task->mutex);
+        JOB_MUTEX_UNLOCK(&task->mutex);
+
+        // Join compressed chunks, all of them end byte-aligned
+        bool success = true;
+        for (int i = 0; i < chunkCount; i++)
+        {
+            if (task->chunkData[i] == NULL) success = false;
+            else *compDataSize += task->chunkSize[i];
+        }
+
+        if (success) compData = (unsigned char *)RL_MALLOC(*compDataSize);
+
+        if (compData != NULL)
+        {
+            int offset = 0;
+
+            for (int i = 0; i < chunkCount; i++)
+            {
+                memcpy(compData + offset, task->chunkData[i], task->chunkSize[i]);
+                offset += task->chunkSize[i];
+            }
+        }
+        else *compDataSize = 0;
+
+        for (int i = 0; i < chunkCount; i++) RL_FREE(task->chunkData[i]);
+        ReleaseCompressionTask(task);
+    }
+    else
+#endif
+    {
+        struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+        compData = (unsigned char *)RL_MALLOC(sdefl_bound(dataSize) + 16);
+
+        if ((sdefl != NULL) && (compData != NULL)) *compDataSize = CompressDataBlocks(sdefl, compData, data, 0, dataSize, level, true);
+
+        RL_FREE(sdefl);
+    }
+
+    if (compData == NULL) TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate required compression memory");
+    else TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
 #endif
 
     return compData;
 }
 
 // Decompress data (DEFLATE algorithm)
+// NOTE: Output buffer grows as required, up to MAX_DECOMPRESSION_SIZE, returned data has the exact decompressed size
 unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
 {
     unsigned char *data = NULL;
+    *dataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
     // Decompress data from a valid DEFLATE stream
-    data = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int length = sinflate(data, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+    // NOTE: Decompression output size is unknown, output buffer is grown when filled and
+    // decompression resumes on grown buffer (DecompressGrowBuffer()), data is never decompressed twice
+    int capacity = (compDataSize < (MAX_DECOMPRESSION_SIZE*1024*1024)/4)? compDataSize*4 : MAX_DECOMPRESSION_SIZE*1024*1024;
+    if (capacity < DECOMPRESSION_MIN_CAPACITY) capacity = DECOMPRESSION_MIN_CAPACITY;
+
+    data = (unsigned char *)RL_MALLOC(capacity);
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate required decompression memory");
+        return NULL;
+    }
+
+    int length = sinflate_grow((void **)&data, &capacity, compData, compDataSize, DecompressGrowBuffer);
+
+    if (length < 0)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data, MAX_DECOMPRESSION_SIZE reached or out of memory");
+        RL_FREE(data);
+        return NULL;
+    }
 
-    // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
-    // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
-    unsigned char *temp = (unsigned char *)RL_REALLOC(data, length);
+    // Shrink output buffer to exact decompressed size
+    unsigned char *output = (unsigned char *)RL_REALLOC(data, (length > 0)? length : 1);
 
-    if (temp != NULL) data = temp;
+    if (output != NULL) data = output;
     else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
 
     *dataSize = length;
@@ -3467,6 +4250,91 @@ unsigned char *DecompressData(const unsigned char *compData, int compDataSize, i
     return data;
 }
 
+// Load compressor for chunked data compression (DEFLATE algorithm), level: 0 (fastest) to 8 (best)
+// NOTE: Compressor keeps only last 32KB of data (DEFLATE window), memory usage is bounded by chunks size
+Compressor LoadCompressor(int level)
+{
+    Compressor compressor = { 0 };
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (level < 0) level = 0;
+    if (level > SDEFL_LVL_MAX) level = SDEFL_LVL_MAX;
+
+    compressor.level = level;
+    compressor.state = RL_CALLOC(1, sizeof(CompressorState));
+
+    if (compressor.state == NULL) TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compressor memory");
+#endif
+
+    return compressor;
+}
+
+// Unload compressor
+void UnloadCompressor(Compressor compressor)
+{
+#if defined(SUPPORT_COMPRESSION_API)
+    CompressorState *state = (CompressorState *)compressor.state;
+
+    if (state != NULL)
+    {
+        RL_FREE(state->buffer);
+        RL_FREE(state);
+    }
+#endif
+}
+
+// Compress data chunk, compressed chunks written consecutively form a single valid DEFLATE stream
+// NOTE: Last chunk must be flagged to end the stream, compressed chunk memory must be MemFree()
+unsigned char *CompressDataChunk(Compressor compressor, const unsigned char *data, int dataSize, bool last, int *compDataSize)
+{
+    unsigned char *compData = NULL;
+    *compDataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    CompressorState *state = (CompressorState *)compressor.state;
+
+    if ((state == NULL) || state->finished)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Compressor not valid or last chunk already compressed");
+        return NULL;
+    }
+
+    // Chunk data is placed after history window, so matches can reference previous chunks data
+    if ((state->historySize + dataSize) > state->bufferCapacity)
+    {
+        unsigned char *buffer = (unsigned char *)RL_REALLOC(state->buffer, state->historySize + dataSize);
+
+        if (buffer == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compressor memory");
+            return NULL;
+        }
+
+        state->buffer = buffer;
+        state->bufferCapacity = state->historySize + dataSize;
+    }
+
+    if (dataSize > 0) memcpy(state->buffer + state->historySize, data, dataSize);
+
+    compData = (unsigned char *)RL_MALLOC(sdefl_bound(dataSize) + 16);
+
+    if (compData != NULL)
+    {
+        *compDataSize = CompressDataBlocks(&state->sdefl, compData, state->buffer, state->historySize, state->historySize + dataSize, compressor.level, last);
+
+        // Keep last data as history window for next chunk
+        int totalSize = state->historySize + dataSize;
+        int historySize = (totalSize < SDEFL_WIN_SIZ)? totalSize : SDEFL_WIN_SIZ;
+        memmove(state->buffer, state->buffer + totalSize - historySize, historySize);
+        state->historySize = historySize;
+        state->finished = last;
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate required compression memory");
+#endif
+
+    return compData;
+}
+
 // Encode data to Base64 string
 char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
@@ -3561,49 +4429,338 @@ unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize)
     return decodedData;
 }
 
-// Open URL with default system browser (if available)
-// NOTE: This function is only safe to use if you control the URL given.
-// A user could craft a malicious string performing another action.
-// Only call this function yourself not with user input or make sure to check the string yourself.
-// Ref: https://github.com/raysan5/raylib/issues/686
-void OpenURL(const char *url)
+// Queue job to run asynchronously, returns job id
+// NOTE: work runs on a worker thread, finish (optional) runs later on main thread inside EndDrawing(),
+// so finish can access GPU and publish job results; job is done once finish has been run
+// WARNING: Queued jobs must not block waiting for other jobs
+unsigned int QueueJob(JobCallback work, JobCallback finish, void *data)
 {
-    // Security check to (aprtially) avoid malicious code on PLATFORM_WEB
-    if (strchr(url, '\'') != NULL) TRACELOG(LOG_WARNING, "SYSTEM: Provided URL could be potentially malicious, avoid [\'] character");
-    else
+    unsigned int id = 0;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    InitJobSystem();
+
+    #if defined(JOB_SYSTEM_THREADED)
+    if (CORE.Jobs.ready)
     {
-#if defined(PLATFORM_DESKTOP)
-        char *cmd = (char *)RL_CALLOC(strlen(url) + 32, sizeof(char));
-    #if defined(_WIN32)
-        sprintf(cmd, "explorer \"%s\"", url);
+        JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+
+        // Look for a free job slot, starting at next id
+        for (int i = 0; i < MAX_JOB_QUEUE_SIZE; i++)
+        {
+            unsigned int nextId = CORE.Jobs.nextId++;
+            if (nextId == 0) nextId = CORE.Jobs.nextId++;
+
+            Job *job = &CORE.Jobs.jobs[nextId%MAX_JOB_QUEUE_SIZE];
+
+            if (job->state == JOB_STATE_FREE)
+            {
+                id = nextId;
+                *job = (Job){ id, JOB_STATE_QUEUED, work, finish, data };
+
+                CORE.Jobs.pending[(CORE.Jobs.pendingHead + CORE.Jobs.pendingCount)%MAX_JOB_QUEUE_SIZE] = id;
+                CORE.Jobs.pendingCount++;
+
+                JOB_CONDITION_SIGNAL(&CORE.Jobs.workAvailable);
+                break;
+            }
+        }
+
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+        if (id != 0) return id;
+
+        TRACELOG(LOG_WARNING, "JOBS: Maximum jobs in flight reached (%i), running job synchronously", MAX_JOB_QUEUE_SIZE);
+    }
     #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        sprintf(cmd, "xdg-open '%s'", url); // Alternatives: firefox, x-www-browser
+
+    // Job runs synchronously, returned id does not match any job slot, so it is reported as done
+    #if defined(JOB_SYSTEM_THREADED)
+    JOB_MUTEX_LOCK(&jobSystemMutex);
+    if (CORE.Jobs.ready) JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
     #endif
-    #if defined(__APPLE__)
-        sprintf(cmd, "open '%s'", url);
+
+    id = CORE.Jobs.nextId++;
+    if (id == 0) id = CORE.Jobs.nextId++;
+
+    #if defined(JOB_SYSTEM_THREADED)
+    if (CORE.Jobs.ready) JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+    JOB_MUTEX_UNLOCK(&jobSystemMutex);
     #endif
-        int result = system(cmd);
-        if (result == -1) TRACELOG(LOG_WARNING, "OpenURL() child process could not be created");
-        RL_FREE(cmd);
-#endif
-#if defined(PLATFORM_WEB)
-        emscripten_run_script(TextFormat("window.open('%s', '_blank')", url));
 #endif
-#if defined(PLATFORM_ANDROID)
-        JNIEnv *env = NULL;
-        JavaVM *vm = CORE.Android.app->activity->vm;
-        (*vm)->AttachCurrentThread(vm, &env, NULL);
 
-        jstring urlString = (*env)->NewStringUTF(env, url);
-        jclass uriClass = (*env)->FindClass(env, "android/net/Uri");
-        jmethodID uriParse = (*env)->GetStaticMethodID(env, uriClass, "parse", "(Ljava/lang/String;)Landroid/net/Uri;");
-        jobject uri = (*env)->CallStaticObjectMethod(env, uriClass, uriParse, urlString);
+    if (work != NULL) work(data);
+    if (finish != NULL) finish(data);
 
-        jclass intentClass = (*env)->FindClass(env, "android/content/Intent");
-        jfieldID actionViewId = (*env)->GetStaticFieldID(env, intentClass, "ACTION_VIEW", "Ljava/lang/String;");
-        jobject actionView = (*env)->GetStaticObjectField(env, intentClass, actionViewId);
-        jmethodID newIntent = (*env)->GetMethodID(env, intentClass, "<init>", "(Ljava/lang/String;Landroid/net/Uri;)V");
+    return id;
+}
+
+// Check if a job is done (work and finish steps completed)
+bool IsJobDone(unsigned int jobId)
+{
+    bool done = true;
+
+#if defined(JOB_SYSTEM_THREADED)
+    if (CORE.Jobs.ready)
+    {
+        JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+        Job *job = &CORE.Jobs.jobs[jobId%MAX_JOB_QUEUE_SIZE];
+        if ((job->id == jobId) && (job->state != JOB_STATE_FREE)) done = false;
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+    }
+#endif
+
+    return done;
+}
+
+// Wait for a job to be done
+// NOTE: Job finish step runs on calling thread, so it must be called from main thread
+void WaitJob(unsigned int jobId)
+{
+#if defined(JOB_SYSTEM_THREADED)
+    if (!CORE.Jobs.ready) return;
+
+    JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+
+    Job *job = &CORE.Jobs.jobs[jobId%MAX_JOB_QUEUE_SIZE];
+
+    while ((job->id == jobId) && (job->state != JOB_STATE_FREE))
+    {
+        if (job->state == JOB_STATE_FINISHING)
+        {
+            // Run finish step now, its entry in finished queue will be skipped
+            Job finished = *job;
+            job->state = JOB_STATE_RUNNING;
+            JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+            if (finished.finish != NULL) finished.finish(finished.data);
+
+            JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+            job->state = JOB_STATE_FREE;
+        }
+        else JOB_CONDITION_WAIT(&CORE.Jobs.workDone, &CORE.Jobs.mutex);
+    }
+
+    JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+#endif
+}
+
+// Run work over items range [0..count) split in ranges, ranges are run by worker jobs and calling thread
+// NOTE: Calling thread runs ranges until all of them are claimed and only waits for ranges being run by
+// workers, never for queued jobs to start, so it can be called from any thread (including jobs)
+void RunJobRanges(JobRangeCallback work, void *data, int count, int rangeSize, int maxRanges)
+{
+    if (count <= 0) return;
+
+    int rangeCount = (count + rangeSize - 1)/rangeSize;
+    if (rangeCount > maxRanges) rangeCount = maxRanges;
+
+#if defined(JOB_SYSTEM_THREADED)
+    InitJobSystem();
+
+    JobRangesTask *task = NULL;
+    if ((rangeCount > 1) && CORE.Jobs.ready) task = (JobRangesTask *)RL_CALLOC(1, sizeof(JobRangesTask));
+
+    if (task != NULL)
+    {
+        task->work = work;
+        task->data = data;
+        task->count = count;
+        task->rangeCount = rangeCount;
+        JOB_MUTEX_INIT(&task->mutex);
+        JOB_CONDITION_INIT(&task->rangesDone);
+
+        int jobCount = (rangeCount - 1 < CORE.Jobs.workerCount)? rangeCount - 1 : CORE.Jobs.workerCount;
+        task->refCount = jobCount + 1;
+
+        for (int i = 0; i < jobCount; i++) QueueJob(JobRangesTaskWork, NULL, task);
+        RunJobRangesTask(task);
+
+        JOB_MUTEX_LOCK(&task->mutex);
+        while (task->doneRanges < task->rangeCount) JOB_CONDITION_WAIT(&task->rangesDone, &task->mutex);
+        JOB_MUTEX_UNLOCK(&task->mutex);
+
+        ReleaseJobRangesTask(task);
+        return;
+    }
+#endif
+
+    // Ranges are run in order on calling thread
+    for (int i = 0; i < rangeCount; i++) work(data, (int)((long long)count*i/rangeCount), (int)((long long)count*(i + 1)/rangeCount));
+}
+
+// Set main thread time budget per frame for jobs finish steps (in seconds)
+// NOTE: At least one job finish step is run per frame, even if it exceeds the budget
+void SetJobFinishBudget(float seconds)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    InitJobSystem();
+    CORE.Jobs.finishBudget = (double)seconds;
+#endif
+}
+
+// Begin a profile zone on current thread, zones can be nested
+// NOTE: Zone name is not copied, it must be a static string (i.e. a string literal)
+void BeginProfileZone(const char *name)
+{
+#if defined(SUPPORT_PROFILER)
+    ProfileThreadBuffer *buffer = GetProfileThreadBuffer();
+
+    if (buffer != NULL)
+    {
+        // NOTE: Zones nested deeper than MAX_PROFILE_ZONE_DEPTH are counted but not recorded
+        if (buffer->depth < MAX_PROFILE_ZONE_DEPTH)
+        {
+            buffer->openNames[buffer->depth] = name;
+            buffer->openStarts[buffer->depth] = GetTime();
+        }
+
+        buffer->depth++;
+    }
+#endif
+}
+
+// End last profile zone begun on current thread
+void EndProfileZone(void)
+{
+#if defined(SUPPORT_PROFILER)
+    ProfileThreadBuffer *buffer = GetProfileThreadBuffer();
+
+    if ((buffer != NULL) && (buffer->depth > 0))
+    {
+        buffer->depth--;
+
+        if (buffer->depth < MAX_PROFILE_ZONE_DEPTH)
+        {
+            unsigned int count = buffer->zoneCount;
+            ProfileZone *zone = &buffer->zones[count%MAX_PROFILE_ZONES];
+
+            zone->name = buffer->openNames[buffer->depth];
+            zone->start = buffer->openStarts[buffer->depth];
+            zone->duration = GetTime() - zone->start;
+
+            PROFILER_ATOMIC_STORE(&buffer->zoneCount, count + 1);  // Publish zone
+        }
+    }
+#endif
+}
+
+// Export recorded profile zones as Chrome trace events JSON file (chrome://tracing, ui.perfetto.dev)
+// NOTE: Only last MAX_PROFILE_ZONES zones per thread are kept, thread ids are registration order,
+// GPU timer zones (rlgl timestamp queries) are exported in an additional "GPU" thread
+// WARNING: Zones recorded by other threads while exporting could overwrite oldest exported zones
+bool ExportProfileTrace(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PROFILER)
+    int threadCount = (int)PROFILER_ATOMIC_LOAD(&CORE.Profiler.threadCount);
+    if (threadCount > MAX_PROFILE_THREADS) threadCount = MAX_PROFILE_THREADS;
+
+    // Get published zones count per thread and required text size
+    // NOTE: GPU timer zones are exported as an additional thread, after registered threads
+    ProfileThreadBuffer *buffers[MAX_PROFILE_THREADS + 1] = { 0 };
+    unsigned int zoneCounts[MAX_PROFILE_THREADS + 1] = { 0 };
+    int bufferCount = threadCount + 1;
+    int totalCount = 0;
+    size_t textSize = 128;
+
+    for (int t = 0; t < bufferCount; t++)
+    {
+        buffers[t] = (t < threadCount)? PROFILER_ATOMIC_LOAD(&CORE.Profiler.threads[t]) : CORE.Profiler.gpu;
+        if (buffers[t] == NULL) continue;
+
+        zoneCounts[t] = PROFILER_ATOMIC_LOAD(&buffers[t]->zoneCount);
+
+        unsigned int first = (zoneCounts[t] > MAX_PROFILE_ZONES)? zoneCounts[t] - MAX_PROFILE_ZONES : 0;
+        for (unsigned int i = first; i < zoneCounts[t]; i++) textSize += 2*strlen(buffers[t]->zones[i%MAX_PROFILE_ZONES].name) + 128;
+    }
+
+    char *text = (char *)RL_MALLOC(textSize);
+    int length = sprintf(text, "{\"traceEvents\":[\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%i,\"args\":{\"name\":\"GPU\"}}", threadCount);
+
+    for (int t = 0; t < bufferCount; t++)
+    {
+        if (buffers[t] == NULL) continue;
+
+        unsigned int first = (zoneCounts[t] > MAX_PROFILE_ZONES)? zoneCounts[t] - MAX_PROFILE_ZONES : 0;
+
+        for (unsigned int i = first; i < zoneCounts[t]; i++)
+        {
+            const ProfileZone *zone = &buffers[t]->zones[i%MAX_PROFILE_ZONES];
+
+            length += sprintf(text + length, ",\n{\"name\":\"");
+
+            // Escape zone name for JSON string
+            for (const char *c = zone->name; *c != '\0'; c++)
+            {
+                if ((*c == '\"') || (*c == '\\')) text[length++] = '\\';
+                text[length++] = *c;
+            }
+
+            length += sprintf(text + length, "\",\"cat\":\"raylib\",\"ph\":\"X\",\"pid\":0,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f}",
+                t, zone->start*1000000.0, zone->duration*1000000.0);
+            totalCount++;
+        }
+    }
+
+    sprintf(text + length, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    success = SaveFileText(fileName, text);
+    RL_FREE(text);
+
+    if (success) TRACELOG(LOG_INFO, "PROFILER: [%s] Profile trace exported successfully (%i zones)", fileName, totalCount);
+    else TRACELOG(LOG_WARNING, "PROFILER: [%s] Failed to export profile trace", fileName);
+#else
+    TRACELOG(LOG_WARNING, "PROFILER: Profile zones recording not supported (SUPPORT_PROFILER)");
+#endif
+
+    return success;
+}
+
+// Open URL with default system browser (if available)
+// NOTE: This function is only safe to use if you control the URL given.
+// A user could craft a malicious string performing another action.
+// Only call this function yourself not with user input or make sure to check the string yourself.
+// Ref: https://github.com/raysan5/raylib/issues/686
+void OpenURL(const char *url)
+{
+    // Security check to (aprtially) avoid malicious code on PLATFORM_WEB
+    if (strchr(url, '\'') != NULL) TRACELOG(LOG_WARNING, "SYSTEM: Provided URL could be potentially malicious, avoid [\'] character");
+    else
+    {
+#if defined(PLATFORM_DESKTOP)
+        char *cmd = (char *)RL_CALLOC(strlen(url) + 32, sizeof(char));
+    #if defined(_WIN32)
+        sprintf(cmd, "explorer \"%s\"", url);
+    #endif
+    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+        sprintf(cmd, "xdg-open '%s'", url); // Alternatives: firefox, x-www-browser
+    #endif
+    #if defined(__APPLE__)
+        sprintf(cmd, "open '%s'", url);
+    #endif
+        int result = system(cmd);
+        if (result == -1) TRACELOG(LOG_WARNING, "OpenURL() child process could not be created");
+        RL_FREE(cmd);
+#endif
+#if defined(PLATFORM_WEB)
+        emscripten_run_script(TextFormat("window.open('%s', '_blank')", url));
+#endif
+#if defined(PLATFORM_ANDROID)
+        JNIEnv *env = NULL;
+        JavaVM *vm = CORE.Android.app->activity->vm;
+        (*vm)->AttachCurrentThread(vm, &env, NULL);
+
+        jstring urlString = (*env)->NewStringUTF(env, url);
+        jclass uriClass = (*env)->FindClass(env, "android/net/Uri");
+        jmethodID uriParse = (*env)->GetStaticMethodID(env, uriClass, "parse", "(Ljava/lang/String;)Landroid/net/Uri;");
+        jobject uri = (*env)->CallStaticObjectMethod(env, uriClass, uriParse, urlString);
+
+        jclass intentClass = (*env)->FindClass(env, "android/content/Intent");
+        jfieldID actionViewId = (*env)->GetStaticFieldID(env, intentClass, "ACTION_VIEW", "Ljava/lang/String;");
+        jobject actionView = (*env)->GetStaticObjectField(env, intentClass, actionViewId);
+        jmethodID newIntent = (*env)->GetMethodID(env, intentClass, "<init>", "(Ljava/lang/String;Landroid/net/Uri;)V");
         jobject intent = (*env)->AllocObject(env, intentClass);
 
         (*env)->CallVoidMethod(env, intent, newIntent, actionView, uri);
@@ -4800,6 +5957,10 @@ static bool InitGraphicsDevice(int width, int height)
     // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
 
+#if defined(SUPPORT_PROFILER)
+    rlEnableGpuZones();     // Record GPU timer zones, included in exported profile trace
+#endif
+
     // Setup default viewport
     // NOTE: It updated CORE.Window.render.width and CORE.Window.render.height
     SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
@@ -4919,6 +6080,90 @@ static void SetupFramebuffer(int width, int height)
     }
 }
 
+#if !defined(SUPPORT_BUSY_WAIT_LOOP)
+// Halt program execution using system sleep functions
+static void SleepSeconds(double seconds)
+{
+#if defined(_WIN32)
+    Sleep((unsigned long)(seconds*1000.0));
+#endif
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+    struct timespec req = { 0 };
+    time_t sec = seconds;
+    long nsec = (seconds - sec)*1000000000L;
+    req.tv_sec = sec;
+    req.tv_nsec = nsec;
+
+    // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
+    while (nanosleep(&req, &req) == -1) continue;
+#endif
+#if defined(__APPLE__)
+    usleep(seconds*1000000.0);
+#endif
+}
+
+#if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+// Update system sleep overshoot estimation with a measured sleep overshoot
+// NOTE: Estimation is the moving average plus standard deviation of measured overshoots,
+// so most sleeps end before the requested time and only the residual is busy waited
+static void UpdateSleepOvershoot(double overshoot)
+{
+    const double alpha = 1.0/SLEEP_OVERSHOOT_SAMPLES;
+
+    if (CORE.Time.sleepSamples == 0)
+    {
+        CORE.Time.sleepMean = overshoot;
+        CORE.Time.sleepVariance = SLEEP_OVERSHOOT_DEFAULT*SLEEP_OVERSHOOT_DEFAULT;
+    }
+    else
+    {
+        // Exponential moving average and variance, adapts to system load changes
+        double delta = overshoot - CORE.Time.sleepMean;
+        CORE.Time.sleepMean += alpha*delta;
+        CORE.Time.sleepVariance = (1.0 - alpha)*(CORE.Time.sleepVariance + alpha*delta*delta);
+    }
+
+    if (CORE.Time.sleepSamples < SLEEP_OVERSHOOT_SAMPLES) CORE.Time.sleepSamples++;
+
+    CORE.Time.sleepOvershoot = CORE.Time.sleepMean + sqrt(CORE.Time.sleepVariance);
+    if (CORE.Time.sleepOvershoot < 0.0) CORE.Time.sleepOvershoot = 0.0;
+}
+#endif
+#endif  // !SUPPORT_BUSY_WAIT_LOOP
+
+// Register frame time into frame statistics, detecting hitches
+// NOTE: A hitch is a frame taking longer than FRAME_HITCH_FACTOR times the expected frame time,
+// expected frame time is target frame time or, if not set, average frame time
+static void UpdateFrameStats(double frameTime)
+{
+    double expected = (CORE.Time.target > 0.0)? CORE.Time.target : CORE.Time.frameAverage;
+
+    if ((CORE.Time.frameHistoryCount > 0) && (expected > 0.0) && (frameTime > FRAME_HITCH_FACTOR*expected)) CORE.Time.hitchCount++;
+
+    // Frame time average, hitches are clamped so a single hitch barely raises hitch threshold,
+    // but a sustained slowdown still moves the average to the new frame time
+    if (CORE.Time.frameHistoryCount == 0) CORE.Time.frameAverage = frameTime;
+    else
+    {
+        double sample = frameTime;
+        if ((expected > 0.0) && (sample > FRAME_HITCH_FACTOR*expected)) sample = FRAME_HITCH_FACTOR*expected;
+        CORE.Time.frameAverage += (sample - CORE.Time.frameAverage)/FRAME_TIME_HISTORY_SIZE;
+    }
+
+    CORE.Time.frameHistory[CORE.Time.frameHistoryIndex] = (float)frameTime;
+    CORE.Time.frameHistoryIndex = (CORE.Time.frameHistoryIndex + 1)%FRAME_TIME_HISTORY_SIZE;
+    if (CORE.Time.frameHistoryCount < FRAME_TIME_HISTORY_SIZE) CORE.Time.frameHistoryCount++;
+}
+
+// Compare frame times, used for sorting
+static int CompareFrameTimes(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+
 // Initialize hi-resolution timer
 static void InitTimer(void)
 {
@@ -4946,6 +6191,8 @@ static void InitTimer(void)
 // Wait for some time (stop program execution)
 // NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
 // take longer than expected... for that reason we use the busy wait loop
+// NOTE: Partial busy wait sleeps for the requested time minus the estimated sleep overshoot,
+// measured on previous sleeps, and busy waits only the residual time
 // Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
 // Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timing on Win32!
 void WaitTime(double seconds)
@@ -4958,31 +6205,25 @@ void WaitTime(double seconds)
     while (GetTime() < destinationTime) { }
 #else
     #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
-    #else
-        double sleepSeconds = seconds;
-    #endif
+        if (CORE.Time.sleepSamples == 0) CORE.Time.sleepOvershoot = SLEEP_OVERSHOOT_DEFAULT;
 
-    // System halt functions
-    #if defined(_WIN32)
-        Sleep((unsigned long)(sleepSeconds*1000.0));
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
-        struct timespec req = { 0 };
-        time_t sec = sleepSeconds;
-        long nsec = (sleepSeconds - sec)*1000000000L;
-        req.tv_sec = sec;
-        req.tv_nsec = nsec;
-
-        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
-        while (nanosleep(&req, &req) == -1) continue;
-    #endif
-    #if defined(__APPLE__)
-        usleep(sleepSeconds*1000000.0);
-    #endif
+        // NOTE: Busy wait is limited to half the requested time, so a short sleep is always
+        // measured and a too high overshoot estimation recovers, instead of busy waiting forever
+        double overshoot = CORE.Time.sleepOvershoot;
+        if (overshoot > seconds*0.5) overshoot = seconds*0.5;
+
+        double sleepSeconds = seconds - overshoot;
+
+        if (sleepSeconds > 0.0)
+        {
+            double sleepStart = GetTime();
+            SleepSeconds(sleepSeconds);
+            UpdateSleepOvershoot((GetTime() - sleepStart) - sleepSeconds);
+        }
 
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
         while (GetTime() < destinationTime) { }
+    #else
+        SleepSeconds(seconds);
     #endif
 #endif
 }
@@ -5253,51 +6494,1011 @@ void PollInputEvents(void)
             CORE.Input.Gamepad.axisCount = gamepadState.numAxes;
         }
     }
-#endif
+#endif
+
+#if defined(PLATFORM_ANDROID)
+    // Register previous keys states
+    // NOTE: Android supports up to 260 keys
+    for (int i = 0; i < 260; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+
+    // Android ALooper_pollAll() variables
+    int pollResult = 0;
+    int pollEvents = 0;
+
+    // Poll Events (registered events)
+    // NOTE: Activity is paused if not enabled (CORE.Android.appEnabled)
+    while ((pollResult = ALooper_pollAll(CORE.Android.appEnabled? 0 : -1, NULL, &pollEvents, (void**)&CORE.Android.source)) >= 0)
+    {
+        // Process this event
+        if (CORE.Android.source != NULL) CORE.Android.source->process(CORE.Android.app, CORE.Android.source);
+
+        // NOTE: Never close window, native activity is controlled by the system!
+        if (CORE.Android.app->destroyRequested != 0)
+        {
+            //CORE.Window.shouldClose = true;
+            //ANativeActivity_finish(CORE.Android.app->activity);
+        }
+    }
+#endif
+
+#if (defined(PLATFORM_RPI) || defined(PLATFORM_DRM)) && defined(SUPPORT_SSH_KEYBOARD_RPI)
+    // NOTE: Keyboard reading could be done using input_event(s) or just read from stdin, both methods are used here.
+    // stdin reading is still used for legacy purposes, it allows keyboard input trough SSH console
+
+    if (!CORE.Input.Keyboard.evtMode) ProcessKeyboard();
+
+    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
+    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
+#endif
+
+    // Record polled input state or replace it by played input state
+    if (CORE.Automation.recording || CORE.Automation.playing) UpdateAutomationEvents();
+}
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Compress data blocks into a DEFLATE stream, returns compressed size
+// NOTE: Data before start (up to 32KB) is used as dictionary, matches can reference it,
+// if not last, stream ends byte-aligned with a non-final stored block, so more data can be appended
+// NOTE: Compression loop based on sdefl_compr() [external/sdefl.h], extended to support dictionary and non-final chunks
+static int CompressDataBlocks(struct sdefl *s, unsigned char *out, const unsigned char *in, int start, int end, int level, bool last)
+{
+    static const unsigned char pref[] = { 8, 10, 14, 24, 30, 48, 65, 96, 130 };
+    int maxChain = (level < 8)? (1 << (level + 1)) : (1 << 13);
+    unsigned char *q = out;
+
+    if ((start == end) && !last) return 0;
+
+    // Non-final chunks last byte is written in a stored block, to end chunk byte-aligned
+    int compEnd = last? end : end - 1;
+    int i = (start > SDEFL_WIN_SIZ)? start - SDEFL_WIN_SIZ : 0;
+    int litlen = 0;
+
+    s->bits = s->bitcnt = 0;
+    s->seq_cnt = 0;
+    memset(&s->freq, 0, sizeof(s->freq));
+    for (int n = 0; n < SDEFL_HASH_SIZ; n++) s->tbl[n] = SDEFL_NIL;
+
+    // Register dictionary data positions in hash chains
+    for (; (i < start) && ((compEnd - i) > SDEFL_MIN_MATCH); i++)
+    {
+        unsigned int h = sdefl_hash32(&in[i]);
+        s->prv[i&SDEFL_WIN_MSK] = s->tbl[h];
+        s->tbl[h] = i;
+    }
+
+    i = start;
+
+    if (start < compEnd || last)
+    {
+        do
+        {
+            int blockEnd = ((i + SDEFL_BLK_MAX) < compEnd)? (i + SDEFL_BLK_MAX) : compEnd;
+
+            while (i < blockEnd)
+            {
+                struct sdefl_match m = { 0 };
+                int left = blockEnd - i;
+                int maxMatch = (left >= SDEFL_MAX_MATCH)? SDEFL_MAX_MATCH : left;
+                int niceMatch = (pref[level] < maxMatch)? pref[level] : maxMatch;
+                int run = 1, inc = 1, runInc = 0;
+
+                if (maxMatch > SDEFL_MIN_MATCH) sdefl_fnd(&m, s, maxChain, maxMatch, in, i);
+
+                if ((level >= 5) && (m.len >= SDEFL_MIN_MATCH) && (m.len < niceMatch))
+                {
+                    struct sdefl_match m2 = { 0 };
+                    sdefl_fnd(&m2, s, maxChain, m.len + 1, in, i + 1);
+                    m.len = (m2.len > m.len)? 0 : m.len;
+                }
+
+                if (m.len >= SDEFL_MIN_MATCH)
+                {
+                    if (litlen)
+                    {
+                        sdefl_seq(s, i - litlen, litlen);
+                        litlen = 0;
+                    }
+
+                    sdefl_seq(s, -m.off, m.len);
+                    sdefl_reg_match(s, m.off, m.len);
+
+                    if ((level < 2) && (m.len >= niceMatch)) inc = m.len;
+                    else run = m.len;
+                }
+                else
+                {
+                    s->freq.lit[in[i]]++;
+                    litlen++;
+                }
+
+                runInc = run*inc;
+
+                if ((compEnd - (i + runInc)) > SDEFL_MIN_MATCH)
+                {
+                    while (run-- > 0)
+                    {
+                        unsigned int h = sdefl_hash32(&in[i]);
+                        s->prv[i&SDEFL_WIN_MSK] = s->tbl[h];
+                        s->tbl[h] = i;
+                        i += inc;
+                    }
+                }
+                else i += runInc;
+            }
+
+            if (litlen)
+            {
+                sdefl_seq(s, i - litlen, litlen);
+                litlen = 0;
+            }
+
+            sdefl_flush(&q, s, last && (blockEnd == compEnd), in);
+
+        } while (i < compEnd);
+    }
+
+    if (!last)
+    {
+        // Stored block with one byte: [BFINAL: 0][BTYPE: 00], byte-align, [LEN: 1][NLEN: ~1][data]
+        sdefl_put(&q, s, 0x00, 3);
+        if (s->bitcnt > 0) sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+        sdefl_put(&q, s, 0x01, 8);
+        sdefl_put(&q, s, 0x00, 8);
+        sdefl_put(&q, s, 0xfe, 8);
+        sdefl_put(&q, s, 0xff, 8);
+        sdefl_put(&q, s, in[end - 1], 8);
+    }
+    else if (s->bitcnt > 0) sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+
+    return (int)(q - out);
+}
+
+#if defined(JOB_SYSTEM_THREADED)
+// Compress task chunks until all of them have been claimed
+static void CompressChunks(CompressionTask *task)
+{
+    struct sdefl *sdefl = NULL;
+
+    while (true)
+    {
+        JOB_MUTEX_LOCK(&task->mutex);
+        int chunk = (task->nextChunk < task->chunkCount)? task->nextChunk++ : -1;
+        JOB_MUTEX_UNLOCK(&task->mutex);
+
+        if (chunk < 0) break;
+
+        int start = chunk*COMPRESSION_CHUNK_SIZE;
+        int end = ((start + COMPRESSION_CHUNK_SIZE) < task->dataSize)? start + COMPRESSION_CHUNK_SIZE : task->dataSize;
+        int dictStart = (start > SDEFL_WIN_SIZ)? start - SDEFL_WIN_SIZ : 0;
+
+        if (sdefl == NULL) sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+        unsigned char *compData = (unsigned char *)RL_MALLOC(sdefl_bound(end - start) + 16);
+        int compSize = 0;
+
+        if ((sdefl != NULL) && (compData != NULL))
+        {
+            compSize = CompressDataBlocks(sdefl, compData, task->data + dictStart, start - dictStart, end - dictStart, task->level, chunk == (task->chunkCount - 1));
+        }
+        else
+        {
+            RL_FREE(compData);
+            compData = NULL;
+        }
+
+        JOB_MUTEX_LOCK(&task->mutex);
+        task->chunkData[chunk] = compData;
+        task->chunkSize[chunk] = compSize;
+        task->doneChunks++;
+        if (task->doneChunks == task->chunkCount) JOB_CONDITION_BROADCAST(&task->chunksDone);
+        JOB_MUTEX_UNLOCK(&task->mutex);
+    }
+
+    RL_FREE(sdefl);
+}
+
+// Compression task job work, compress chunks and release task
+static void CompressionTaskWork(void *data)
+{
+    CompressionTask *task = (CompressionTask *)data;
+
+    CompressChunks(task);
+    ReleaseCompressionTask(task);
+}
+
+// Release compression task reference, task data is freed by last thread using it
+static void ReleaseCompressionTask(CompressionTask *task)
+{
+    JOB_MUTEX_LOCK(&task->mutex);
+    int refCount = --task->refCount;
+    JOB_MUTEX_UNLOCK(&task->mutex);
+
+    if (refCount == 0)
+    {
+        JOB_CONDITION_DESTROY(&task->chunksDone);
+        JOB_MUTEX_DESTROY(&task->mutex);
+        RL_FREE(task->chunkData);
+        RL_FREE(task->chunkSize);
+        RL_FREE(task);
+    }
+}
+#endif  // JOB_SYSTEM_THREADED
+
+// Grow decompression output buffer (at least required size), keeps decompressed data
+// NOTE: Capacity is doubled up to MAX_DECOMPRESSION_SIZE, NULL is returned once limit is reached
+static void *DecompressGrowBuffer(void *data, int *capacity, int required)
+{
+    int maxCapacity = MAX_DECOMPRESSION_SIZE*1024*1024;
+
+    if ((required < 0) || (required > maxCapacity)) return NULL;
+
+    int newCapacity = (*capacity < maxCapacity/2)? *capacity*2 : maxCapacity;
+    if (newCapacity < required) newCapacity = required;
+
+    void *newData = RL_REALLOC(data, newCapacity);
+    if (newData != NULL) *capacity = newCapacity;
+
+    return newData;
+}
+#endif  // SUPPORT_COMPRESSION_API
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Initialize job system, if not already initialized
+// NOTE: Workers count is the number of available processors minus one (main thread),
+// initialization is guarded by a mutex, so jobs can be queued from any thread
+static void InitJobSystem(void)
+{
+#if defined(JOB_SYSTEM_THREADED)
+    JOB_MUTEX_LOCK(&jobSystemMutex);
+
+    if (CORE.Jobs.ready)
+    {
+        JOB_MUTEX_UNLOCK(&jobSystemMutex);
+        return;
+    }
+#else
+    if (CORE.Jobs.ready) return;
+#endif
+
+    if (CORE.Jobs.nextId == 0) CORE.Jobs.nextId = 1;
+    CORE.Jobs.finishBudget = JOB_FINISH_TIME_BUDGET;
+    CORE.Jobs.shouldClose = false;
+
+#if defined(JOB_SYSTEM_THREADED)
+    int processorCount = 1;
+    #if defined(_WIN32)
+    processorCount = (int)GetActiveProcessorCount(0xffff);  // ALL_PROCESSOR_GROUPS
+    #else
+    processorCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+
+    int workerCount = processorCount - 1;
+    if (workerCount < 1) workerCount = 1;
+    if (workerCount > MAX_JOB_WORKERS) workerCount = MAX_JOB_WORKERS;
+
+    JOB_MUTEX_INIT(&CORE.Jobs.mutex);
+    JOB_CONDITION_INIT(&CORE.Jobs.workAvailable);
+    JOB_CONDITION_INIT(&CORE.Jobs.workDone);
+
+    CORE.Jobs.workerCount = 0;
+
+    for (int i = 0; i < workerCount; i++)
+    {
+    #if defined(_WIN32)
+        CORE.Jobs.workers[i] = CreateThread(NULL, 0, JobWorkerThread, NULL, 0, NULL);
+        if (CORE.Jobs.workers[i] == NULL) break;
+    #else
+        if (pthread_create(&CORE.Jobs.workers[i], NULL, JobWorkerThread, NULL) != 0) break;
+    #endif
+        CORE.Jobs.workerCount++;
+    }
+
+    if (CORE.Jobs.workerCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "JOBS: Failed to create worker threads, jobs will run synchronously");
+
+        JOB_CONDITION_DESTROY(&CORE.Jobs.workDone);
+        JOB_CONDITION_DESTROY(&CORE.Jobs.workAvailable);
+        JOB_MUTEX_DESTROY(&CORE.Jobs.mutex);
+        JOB_MUTEX_UNLOCK(&jobSystemMutex);
+        return;
+    }
+
+    TRACELOG(LOG_INFO, "JOBS: Job system initialized successfully (%i workers)", CORE.Jobs.workerCount);
+#endif
+
+    CORE.Jobs.ready = true;
+
+#if defined(JOB_SYSTEM_THREADED)
+    JOB_MUTEX_UNLOCK(&jobSystemMutex);
+#endif
+}
+
+// Close job system
+// NOTE: Running jobs are completed, jobs still queued once workers exit are run on calling thread,
+// so all jobs data is released by their own work and finish steps
+static void CloseJobSystem(void)
+{
+    if (!CORE.Jobs.ready) return;
+
+#if defined(JOB_SYSTEM_THREADED)
+    JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+
+    CORE.Jobs.shouldClose = true;
+    JOB_CONDITION_BROADCAST(&CORE.Jobs.workAvailable);
+
+    JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+    for (int i = 0; i < CORE.Jobs.workerCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(CORE.Jobs.workers[i], 0xffffffff);     // INFINITE
+        CloseHandle(CORE.Jobs.workers[i]);
+    #else
+        pthread_join(CORE.Jobs.workers[i], NULL);
+    #endif
+    }
+
+    // Run jobs left in queue, their work could queue more jobs
+    JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+
+    if (CORE.Jobs.pendingCount > 0) TRACELOG(LOG_INFO, "JOBS: Running %i queued jobs on main thread", CORE.Jobs.pendingCount);
+
+    while (CORE.Jobs.pendingCount > 0)
+    {
+        unsigned int id = CORE.Jobs.pending[CORE.Jobs.pendingHead];
+        CORE.Jobs.pendingHead = (CORE.Jobs.pendingHead + 1)%MAX_JOB_QUEUE_SIZE;
+        CORE.Jobs.pendingCount--;
+
+        Job *job = &CORE.Jobs.jobs[id%MAX_JOB_QUEUE_SIZE];
+        job->state = JOB_STATE_RUNNING;
+        Job running = *job;
+
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+        if (running.work != NULL) running.work(running.data);
+        if (running.finish != NULL) running.finish(running.data);
+
+        JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+        job->state = JOB_STATE_FREE;
+    }
+
+    JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+    ProcessJobsFinish(-1.0);
+
+    JOB_MUTEX_LOCK(&jobSystemMutex);
+    JOB_CONDITION_DESTROY(&CORE.Jobs.workDone);
+    JOB_CONDITION_DESTROY(&CORE.Jobs.workAvailable);
+    JOB_MUTEX_DESTROY(&CORE.Jobs.mutex);
+#endif
+
+    memset(CORE.Jobs.jobs, 0, sizeof(CORE.Jobs.jobs));
+    CORE.Jobs.pendingCount = 0;
+    CORE.Jobs.finishedCount = 0;
+    CORE.Jobs.workerCount = 0;
+    CORE.Jobs.ready = false;
+
+#if defined(JOB_SYSTEM_THREADED)
+    JOB_MUTEX_UNLOCK(&jobSystemMutex);
+#endif
+
+    TRACELOG(LOG_INFO, "JOBS: Job system closed successfully");
+}
+
+// Run finished jobs finish steps on main thread
+// NOTE: Finish steps run in completion order until time budget is exhausted,
+// at least one finish step is run per call, negative budget means no limit
+static void ProcessJobsFinish(double budget)
+{
+#if defined(JOB_SYSTEM_THREADED)
+    double startTime = GetTime();
+
+    JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+
+    while (CORE.Jobs.finishedCount > 0)
+    {
+        unsigned int id = CORE.Jobs.finished[CORE.Jobs.finishedHead];
+        CORE.Jobs.finishedHead = (CORE.Jobs.finishedHead + 1)%MAX_JOB_QUEUE_SIZE;
+        CORE.Jobs.finishedCount--;
+
+        Job *job = &CORE.Jobs.jobs[id%MAX_JOB_QUEUE_SIZE];
+
+        // Job could have been already finished by WaitJob()
+        if ((job->id != id) || (job->state != JOB_STATE_FINISHING)) continue;
+
+        Job finished = *job;
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+        if (finished.finish != NULL) finished.finish(finished.data);
+
+        JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+        job->state = JOB_STATE_FREE;
+
+        if ((budget >= 0.0) && ((GetTime() - startTime) >= budget)) break;
+    }
+
+    JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+#endif
+}
+
+#if defined(JOB_SYSTEM_THREADED)
+// Job worker threads loop, runs queued jobs work until job system is closed
+static void RunJobWorker(void)
+{
+    LoadMemFrame();         // Load worker thread frame memory arena
+
+    JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+
+    while (!CORE.Jobs.shouldClose)
+    {
+        if (CORE.Jobs.pendingCount == 0)
+        {
+            JOB_CONDITION_WAIT(&CORE.Jobs.workAvailable, &CORE.Jobs.mutex);
+            continue;
+        }
+
+        unsigned int id = CORE.Jobs.pending[CORE.Jobs.pendingHead];
+        CORE.Jobs.pendingHead = (CORE.Jobs.pendingHead + 1)%MAX_JOB_QUEUE_SIZE;
+        CORE.Jobs.pendingCount--;
+
+        Job *job = &CORE.Jobs.jobs[id%MAX_JOB_QUEUE_SIZE];
+        job->state = JOB_STATE_RUNNING;
+        Job running = *job;
+
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+        PROFILE_ZONE_BEGIN("JobWork");
+        if (running.work != NULL) running.work(running.data);
+        PROFILE_ZONE_END();
+
+        ResetMemFrame();    // Job work frame memory allocations are freed after every job
+
+        JOB_MUTEX_LOCK(&CORE.Jobs.mutex);
+
+        if (running.finish != NULL)
+        {
+            job->state = JOB_STATE_FINISHING;
+            CORE.Jobs.finished[(CORE.Jobs.finishedHead + CORE.Jobs.finishedCount)%MAX_JOB_QUEUE_SIZE] = id;
+            CORE.Jobs.finishedCount++;
+        }
+        else job->state = JOB_STATE_FREE;
+
+        JOB_CONDITION_BROADCAST(&CORE.Jobs.workDone);
+    }
+
+    JOB_MUTEX_UNLOCK(&CORE.Jobs.mutex);
+
+    UnloadMemFrame();       // Unload worker thread frame memory arena
+}
+
+// Run task ranges until all of them have been claimed
+static void RunJobRangesTask(JobRangesTask *task)
+{
+    while (true)
+    {
+        JOB_MUTEX_LOCK(&task->mutex);
+        int range = (task->nextRange < task->rangeCount)? task->nextRange++ : -1;
+        JOB_MUTEX_UNLOCK(&task->mutex);
+
+        if (range < 0) break;
+
+        task->work(task->data, (int)((long long)task->count*range/task->rangeCount), (int)((long long)task->count*(range + 1)/task->rangeCount));
+
+        JOB_MUTEX_LOCK(&task->mutex);
+        task->doneRanges++;
+        if (task->doneRanges == task->rangeCount) JOB_CONDITION_BROADCAST(&task->rangesDone);
+        JOB_MUTEX_UNLOCK(&task->mutex);
+    }
+}
+
+// Job ranges task job work, run ranges and release task
+static void JobRangesTaskWork(void *data)
+{
+    JobRangesTask *task = (JobRangesTask *)data;
+
+    RunJobRangesTask(task);
+    ReleaseJobRangesTask(task);
+}
+
+// Release job ranges task reference, task data is freed by last thread using it
+static void ReleaseJobRangesTask(JobRangesTask *task)
+{
+    JOB_MUTEX_LOCK(&task->mutex);
+    int refCount = --task->refCount;
+    JOB_MUTEX_UNLOCK(&task->mutex);
+
+    if (refCount == 0)
+    {
+        JOB_CONDITION_DESTROY(&task->rangesDone);
+        JOB_MUTEX_DESTROY(&task->mutex);
+        RL_FREE(task);
+    }
+}
+
+#if defined(_WIN32)
+// Job worker thread (Win32)
+static unsigned long __stdcall JobWorkerThread(void *arg)
+{
+    RunJobWorker();
+    return 0;
+}
+#else
+// Job worker thread (POSIX)
+static void *JobWorkerThread(void *arg)
+{
+    RunJobWorker();
+    return NULL;
+}
+#endif
+#endif  // JOB_SYSTEM_THREADED
+#endif  // SUPPORT_JOB_SYSTEM
+
+#if defined(SUPPORT_PROFILER)
+// Get current thread profile zones buffer, registered on first use
+// NOTE: Registration is attempted once per thread and buffers generation, it fails if
+// MAX_PROFILE_THREADS threads are already registered, zones on that thread are not recorded
+static ProfileThreadBuffer *GetProfileThreadBuffer(void)
+{
+    long generation = PROFILER_ATOMIC_LOAD(&CORE.Profiler.generation);
+
+    if (profileGeneration != generation + 1)
+    {
+        profileGeneration = generation + 1;
+        profileBuffer = NULL;
+
+        long index = PROFILER_ATOMIC_INCREMENT(&CORE.Profiler.threadCount) - 1;
+
+        if (index < MAX_PROFILE_THREADS)
+        {
+            profileBuffer = (ProfileThreadBuffer *)RL_CALLOC(1, sizeof(ProfileThreadBuffer));
+            PROFILER_ATOMIC_STORE(&CORE.Profiler.threads[index], profileBuffer);
+        }
+        else TRACELOG(LOG_WARNING, "PROFILER: Maximum number of profiled threads reached (MAX_PROFILE_THREADS)");
+    }
+
+    return profileBuffer;
+}
+
+// Unload all threads profile zones buffers
+// NOTE: Job workers are stopped first, so no zone is being recorded while buffers are freed,
+// user created threads must stop recording zones before, they register a new buffer on next zone
+static void UnloadProfileBuffers(void)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (CORE.Jobs.ready) CloseJobSystem();
+#endif
+
+    // New generation is published before freeing, so threads stop using old buffers
+    PROFILER_ATOMIC_INCREMENT(&CORE.Profiler.generation);
+
+    for (int i = 0; i < MAX_PROFILE_THREADS; i++)
+    {
+        RL_FREE(CORE.Profiler.threads[i]);
+        PROFILER_ATOMIC_STORE(&CORE.Profiler.threads[i], NULL);
+    }
+
+    PROFILER_ATOMIC_STORE(&CORE.Profiler.threadCount, 0);
+
+    RL_FREE(CORE.Profiler.gpu);
+    CORE.Profiler.gpu = NULL;
+    CORE.Profiler.gpuCalibrationTime = 0.0;
+}
+
+// Record finished GPU timer zones into profile trace, zones are mapped to CPU time
+// NOTE: GPU to CPU time offset is calibrated once per second, GPU results are available some frames later
+static void UpdateProfileGpuZones(void)
+{
+    #define GPU_ZONES_BATCH_SIZE    64
+
+    rlGpuZone zones[GPU_ZONES_BATCH_SIZE] = { 0 };
+    int count = GPU_ZONES_BATCH_SIZE;
+
+    while (count == GPU_ZONES_BATCH_SIZE)
+    {
+        count = rlGetGpuZoneResults(zones, GPU_ZONES_BATCH_SIZE);
+        if (count == 0) break;
+
+        if (CORE.Profiler.gpu == NULL) CORE.Profiler.gpu = (ProfileThreadBuffer *)RL_CALLOC(1, sizeof(ProfileThreadBuffer));
+
+        double time = GetTime();
+        if ((CORE.Profiler.gpuCalibrationTime == 0.0) || ((time - CORE.Profiler.gpuCalibrationTime) > 1.0))
+        {
+            CORE.Profiler.gpuTimeOffset = time - rlGetGpuTimestamp();
+            CORE.Profiler.gpuCalibrationTime = time;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            ProfileZone *zone = &CORE.Profiler.gpu->zones[CORE.Profiler.gpu->zoneCount%MAX_PROFILE_ZONES];
+
+            zone->name = zones[i].name;
+            zone->start = zones[i].start + CORE.Profiler.gpuTimeOffset;
+            zone->duration = zones[i].duration;
+
+            CORE.Profiler.gpu->zoneCount++;
+        }
+    }
+}
+#endif
+
+// Request screen capture, current screen pixels are copied into a pixel buffer
+// and read back on a later frame, so rendering does not wait for the GPU
+// NOTE: If pixel buffers are not supported, pixels are read back synchronously
+static void RequestScreenCapture(int type, const char *fileName)
+{
+    Vector2 scale = GetWindowScaleDPI();
+    ScreenCapture capture = { 0 };
+
+    capture.type = type;
+    capture.frame = CORE.Time.frameCounter;
+    capture.width = (int)((float)CORE.Window.render.width*scale.x);
+    capture.height = (int)((float)CORE.Window.render.height*scale.y);
+
+    if ((capture.width <= 0) || (capture.height <= 0)) return;
+
+#if defined(SUPPORT_GIF_RECORDING)
+    // Recording state is snapshotted into frame, encoder jobs only read it from there
+    if (type == SCREEN_CAPTURE_RECORDING) capture.recording = CORE.Capture.recording;
+#endif
+
+    if (fileName != NULL)
+    {
+        capture.fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(capture.fileName, fileName);
+        capture.format = IsFileExtension(fileName, ".png")? SCREENSHOT_FORMAT_PNG : SCREENSHOT_FORMAT_OTHER;
+    }
+
+    // Look for a free readback slot, if all of them are in flight, oldest one is read back now
+    int slot = -1;
+    for (int i = 0; i < SCREEN_CAPTURE_BUFFERS; i++)
+    {
+        if (CORE.Capture.readbacks[i].width == 0) { slot = i; break; }
+        if ((slot == -1) || ((int)(CORE.Capture.readbacks[i].frame - CORE.Capture.readbacks[slot].frame) < 0)) slot = i;
+    }
+
+    if (CORE.Capture.readbacks[slot].width != 0) ReadbackScreenCapture(slot);
+
+    int size = capture.width*capture.height*4;
+    if (CORE.Capture.pixelBufferSizes[slot] < size)
+    {
+        if (CORE.Capture.pixelBuffers[slot] != 0) rlUnloadPixelBuffer(CORE.Capture.pixelBuffers[slot]);
+
+        CORE.Capture.pixelBuffers[slot] = rlLoadPixelBuffer(capture.width, capture.height);
+        CORE.Capture.pixelBufferSizes[slot] = (CORE.Capture.pixelBuffers[slot] != 0)? size : 0;
+    }
+
+    if (CORE.Capture.pixelBuffers[slot] != 0)
+    {
+        rlReadScreenPixelsToBuffer(CORE.Capture.pixelBuffers[slot], capture.width, capture.height);
+        CORE.Capture.readbacks[slot] = capture;
+    }
+    else
+    {
+        // NOTE: Pixels returned by rlReadScreenPixels() are already flipped, rows are top-down
+        capture.data = rlReadScreenPixels(capture.width, capture.height);
+        capture.pitch = capture.width*4;
+
+        DispatchScreenCapture(capture);
+    }
+}
+
+// Process screen captures in flight, oldest first
+// NOTE: Captures requested on current frame are only processed if all are required
+static void ProcessScreenCaptures(bool all)
+{
+    while (true)
+    {
+        int slot = -1;
+
+        for (int i = 0; i < SCREEN_CAPTURE_BUFFERS; i++)
+        {
+            ScreenCapture *capture = &CORE.Capture.readbacks[i];
+
+            if ((capture->width == 0) || (!all && (capture->frame == CORE.Time.frameCounter))) continue;
+            if ((slot == -1) || ((int)(capture->frame - CORE.Capture.readbacks[slot].frame) < 0)) slot = i;
+        }
+
+        if (slot == -1) break;
+
+        ReadbackScreenCapture(slot);
+    }
+}
+
+// Read back screen capture pixels from its pixel buffer, slot is freed
+static void ReadbackScreenCapture(int slot)
+{
+    ScreenCapture capture = CORE.Capture.readbacks[slot];
+    CORE.Capture.readbacks[slot].width = 0;
+
+    capture.data = (unsigned char *)RL_MALLOC(capture.width*capture.height*4);
+    capture.pitch = -capture.width*4;   // Pixel buffer rows are bottom-up
+
+    rlReadPixelBuffer(CORE.Capture.pixelBuffers[slot], capture.data, capture.width, capture.height);
+
+    DispatchScreenCapture(capture);
+}
+
+// Dispatch screen capture for encoding, capture data ownership is transferred
+static void DispatchScreenCapture(ScreenCapture capture)
+{
+    if (capture.type == SCREEN_CAPTURE_SCREENSHOT)
+    {
+        ScreenCapture *screenshot = (ScreenCapture *)RL_MALLOC(sizeof(ScreenCapture));
+        *screenshot = capture;
+
+        // Wait for the screenshot job previously using this slot, it limits screenshots in flight
+        unsigned int *job = &CORE.Capture.screenshotJobs[CORE.Capture.screenshotJobIndex%SCREEN_CAPTURE_QUEUE_SIZE];
+        if (*job != 0) WaitJob(*job);
+
+        *job = QueueJob(ScreenshotWork, ScreenshotFinish, screenshot);
+        CORE.Capture.screenshotJobIndex++;
+    }
+#if defined(SUPPORT_GIF_RECORDING)
+    else if (capture.recording != NULL) PushRecordingFrame(capture);
+#endif
+    else RL_FREE(capture.data);
+}
+
+// Screenshot job work: export screenshot image file
+static void ScreenshotWork(void *data)
+{
+    ScreenCapture *screenshot = (ScreenCapture *)data;
+    int stride = screenshot->width*4;
+
+    // Flip bottom-up rows in place
+    if (screenshot->pitch < 0)
+    {
+        unsigned char *row = (unsigned char *)RL_MALLOC(stride);
+
+        for (int y = 0; y < screenshot->height/2; y++)
+        {
+            unsigned char *top = screenshot->data + y*stride;
+            unsigned char *bottom = screenshot->data + (screenshot->height - 1 - y)*stride;
+
+            memcpy(row, top, stride);
+            memcpy(top, bottom, stride);
+            memcpy(bottom, row, stride);
+        }
+
+        RL_FREE(row);
+        screenshot->pitch = stride;
+    }
+
+    // Set alpha component value to 255 (no trasparent image retrieval)
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    for (int i = 3; i < screenshot->height*stride; i += 4) screenshot->data[i] = 255;
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    // NOTE: Only PNG is encoded here, ExportImage() is not thread-safe, it checks file extension
+    if (screenshot->format == SCREENSHOT_FORMAT_PNG)
+    {
+        Image image = { screenshot->data, screenshot->width, screenshot->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        int fileSize = 0;
+        unsigned char *fileData = ExportImageToMemory(image, ".png", &fileSize);   // WARNING: Module required: rtextures
+
+        if (fileData != NULL) SaveFileData(screenshot->fileName, fileData, fileSize);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", screenshot->fileName);
+
+        RL_FREE(fileData);
+    }
+#endif
+}
+
+// Screenshot job finish: notify screenshot taken and free screenshot data
+static void ScreenshotFinish(void *data)
+{
+    ScreenCapture *screenshot = (ScreenCapture *)data;
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    if (screenshot->format == SCREENSHOT_FORMAT_OTHER)
+    {
+        Image image = { screenshot->data, screenshot->width, screenshot->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        ExportImage(image, screenshot->fileName);   // WARNING: Module required: rtextures
+    }
+#endif
+
+#if defined(PLATFORM_WEB)
+    // Download file from MEMFS (emscripten memory filesystem)
+    // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(screenshot->fileName), GetFileName(screenshot->fileName)));
+#endif
+
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", screenshot->fileName);
+
+    RL_FREE(screenshot->fileName);
+    RL_FREE(screenshot->data);
+    RL_FREE(screenshot);
+}
+
+// Close screen capture: finish screen recording, pending screenshots and unload pixel buffers
+static void CloseScreenCapture(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    StopScreenRecording();
+#endif
+
+    ProcessScreenCaptures(true);
+
+    for (int i = 0; i < SCREEN_CAPTURE_QUEUE_SIZE; i++)
+    {
+        if (CORE.Capture.screenshotJobs[i] != 0) WaitJob(CORE.Capture.screenshotJobs[i]);
+        CORE.Capture.screenshotJobs[i] = 0;
+    }
+
+    for (int i = 0; i < SCREEN_CAPTURE_BUFFERS; i++)
+    {
+        if (CORE.Capture.pixelBuffers[i] != 0) rlUnloadPixelBuffer(CORE.Capture.pixelBuffers[i]);
+        CORE.Capture.pixelBuffers[i] = 0;
+        CORE.Capture.pixelBufferSizes[i] = 0;
+    }
+
+#if defined(SUPPORT_GIF_RECORDING) && defined(JOB_SYSTEM_THREADED)
+    if (CORE.Capture.mutexReady)
+    {
+        JOB_MUTEX_DESTROY(&CORE.Capture.mutex);
+        CORE.Capture.mutexReady = false;
+    }
+#endif
+}
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Push recording frame into encoding queue, encoder job is queued if not running
+// NOTE: If queue is full, frame is dropped, recording should not stall rendering
+static void PushRecordingFrame(ScreenCapture frame)
+{
+#if defined(JOB_SYSTEM_THREADED)
+    JOB_MUTEX_LOCK(&CORE.Capture.mutex);
+
+    bool queued = false;
+    if (CORE.Capture.framesCount < SCREEN_CAPTURE_QUEUE_SIZE)
+    {
+        CORE.Capture.frames[(CORE.Capture.framesHead + CORE.Capture.framesCount)%SCREEN_CAPTURE_QUEUE_SIZE] = frame;
+        CORE.Capture.framesCount++;
+        queued = true;
+    }
+
+    bool startEncoder = queued && !CORE.Capture.encoding;
+    if (startEncoder) CORE.Capture.encoding = true;
+
+    JOB_MUTEX_UNLOCK(&CORE.Capture.mutex);
+
+    if (!queued)
+    {
+        CORE.Capture.framesDropped++;
+        RL_FREE(frame.data);
+    }
+
+    if (startEncoder) CORE.Capture.encoderJob = QueueJob(RecordingEncoderWork, NULL, NULL);
+#else
+    // No worker threads available, frame is encoded right away
+    EncodeRecordingFrame(&frame);
+    RL_FREE(frame.data);
+#endif
+}
+
+#if defined(JOB_SYSTEM_THREADED)
+// Recording frames encoder job work, encodes queued frames until queue is empty
+static void RecordingEncoderWork(void *data)
+{
+    (void)data;
+
+    while (true)
+    {
+        JOB_MUTEX_LOCK(&CORE.Capture.mutex);
+
+        if (CORE.Capture.framesCount == 0)
+        {
+            CORE.Capture.encoding = false;
+            JOB_MUTEX_UNLOCK(&CORE.Capture.mutex);
+            break;
+        }
+
+        ScreenCapture frame = CORE.Capture.frames[CORE.Capture.framesHead];
+        CORE.Capture.framesHead = (CORE.Capture.framesHead + 1)%SCREEN_CAPTURE_QUEUE_SIZE;
+        CORE.Capture.framesCount--;
+
+        JOB_MUTEX_UNLOCK(&CORE.Capture.mutex);
+
+        EncodeRecordingFrame(&frame);
+        RL_FREE(frame.data);
+    }
+}
+#endif
+
+// Encode recording frame, GIF frame or raw RGBA video frame (rows top-down)
+// NOTE: Frames not matching recording size (i.e. window resized) are skipped
+// NOTE: Only frame data and its recording state are accessed, it runs on encoder jobs
+static void EncodeRecordingFrame(const ScreenCapture *frame)
+{
+    ScreenRecording *recording = frame->recording;
+
+    if ((frame->width != recording->width) || (frame->height != recording->height)) return;
+
+    if (recording->file != NULL)
+    {
+        int stride = frame->width*4;
+
+        for (int y = 0; y < frame->height; y++)
+        {
+            const unsigned char *row = (frame->pitch < 0)? frame->data + (frame->height - 1 - y)*stride : frame->data + y*stride;
+            fwrite(row, 1, stride, recording->file);
+        }
+    }
+    else msf_gif_frame(&recording->gifState, frame->data, 10, 16, frame->pitch);
+}
+#endif
+
+// Add path to file paths builder, grows arena if required
+static void AddFilePath(FilePathBuilder *builder, const char *path)
+{
+    unsigned int length = (unsigned int)strlen(path) + 1;
+
+    if (builder->count >= builder->capacity)
+    {
+        unsigned int capacity = (builder->capacity == 0)? 64 : builder->capacity*2;
+        unsigned int *offsets = (unsigned int *)RL_REALLOC(builder->offsets, capacity*sizeof(unsigned int));
+
+        if (offsets == NULL) { TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for file paths"); return; }
+
+        builder->offsets = offsets;
+        builder->capacity = capacity;
+    }
+
+    if ((builder->bufferSize + length) > builder->bufferCapacity)
+    {
+        unsigned int capacity = (builder->bufferCapacity == 0)? 4096 : builder->bufferCapacity;
+        while (capacity < (builder->bufferSize + length)) capacity *= 2;
+
+        char *buffer = (char *)RL_REALLOC(builder->buffer, capacity);
+
+        if (buffer == NULL) { TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for file paths"); return; }
+
+        builder->buffer = buffer;
+        builder->bufferCapacity = capacity;
+    }
 
-#if defined(PLATFORM_ANDROID)
-    // Register previous keys states
-    // NOTE: Android supports up to 260 keys
-    for (int i = 0; i < 260; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+    memcpy(builder->buffer + builder->bufferSize, path, length);
+    builder->offsets[builder->count] = builder->bufferSize;
+    builder->bufferSize += length;
+    builder->count++;
+}
 
-    // Android ALooper_pollAll() variables
-    int pollResult = 0;
-    int pollEvents = 0;
+// Build file paths list from builder, builder is unloaded
+// NOTE: Paths pointers array and paths strings are packed together in one allocation,
+// so the list can be unloaded with a single RL_FREE(files.paths)
+static FilePathList BuildFilePathList(FilePathBuilder *builder)
+{
+    FilePathList files = { 0 };
 
-    // Poll Events (registered events)
-    // NOTE: Activity is paused if not enabled (CORE.Android.appEnabled)
-    while ((pollResult = ALooper_pollAll(CORE.Android.appEnabled? 0 : -1, NULL, &pollEvents, (void**)&CORE.Android.source)) >= 0)
+    if (builder->count > 0)
     {
-        // Process this event
-        if (CORE.Android.source != NULL) CORE.Android.source->process(CORE.Android.app, CORE.Android.source);
+        files.paths = (char **)RL_MALLOC(builder->count*sizeof(char *) + builder->bufferSize);
 
-        // NOTE: Never close window, native activity is controlled by the system!
-        if (CORE.Android.app->destroyRequested != 0)
+        if (files.paths != NULL)
         {
-            //CORE.Window.shouldClose = true;
-            //ANativeActivity_finish(CORE.Android.app->activity);
+            char *strings = (char *)(files.paths + builder->count);
+            memcpy(strings, builder->buffer, builder->bufferSize);
+
+            for (unsigned int i = 0; i < builder->count; i++) files.paths[i] = strings + builder->offsets[i];
+
+            files.count = builder->count;
+            files.capacity = builder->count;
         }
+        else TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for file paths");
     }
-#endif
-
-#if (defined(PLATFORM_RPI) || defined(PLATFORM_DRM)) && defined(SUPPORT_SSH_KEYBOARD_RPI)
-    // NOTE: Keyboard reading could be done using input_event(s) or just read from stdin, both methods are used here.
-    // stdin reading is still used for legacy purposes, it allows keyboard input trough SSH console
 
-    if (!CORE.Input.Keyboard.evtMode) ProcessKeyboard();
+    RL_FREE(builder->buffer);
+    RL_FREE(builder->offsets);
+    *builder = (FilePathBuilder){ 0 };
 
-    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
-    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
-#endif
+    return files;
 }
 
 // Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const char *filter)
+// NOTE: Paths not fitting in MAX_FILEPATH_LENGTH are skipped
+static void ScanDirectoryFiles(const char *basePath, FilePathBuilder *builder, const char *filter)
 {
-    static char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
 
     struct dirent *dp = NULL;
     DIR *dir = opendir(basePath);
@@ -5309,21 +7510,13 @@ static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const
             if ((strcmp(dp->d_name, ".") != 0) &&
                 (strcmp(dp->d_name, "..") != 0))
             {
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-
-                if (filter != NULL)
-                {
-                    if (IsFileExtension(path, filter))
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
-                }
-                else
+                if (snprintf(path, MAX_FILEPATH_LENGTH, "%s/%s", basePath, dp->d_name) >= MAX_FILEPATH_LENGTH)
                 {
-                    strcpy(files->paths[files->count], path);
-                    files->count++;
+                    TRACELOG(LOG_WARNING, "FILEIO: Filepath too long, skipped (%s/%s)", basePath, dp->d_name);
+                    continue;
                 }
+
+                if ((filter == NULL) || IsFileExtension(path, filter)) AddFilePath(builder, path);
             }
         }
 
@@ -5332,53 +7525,117 @@ static void ScanDirectoryFiles(const char *basePath, FilePathList *files, const
     else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
 }
 
-// Scan all files and directories recursively from a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *files, const char *filter)
+// Scan all files recursively from a base path
+// NOTE: Directories are walked with an explicit stack of open directories instead of function recursion,
+// files are listed in same order as a recursive scan (readdir() order, subdirectory files listed when found);
+// readdir() entry type is used when available to avoid one stat() call per entry
+static void ScanDirectoryFilesRecursively(const char *basePath, FilePathBuilder *builder, const char *filter)
 {
-    char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    char path[MAX_FILEPATH_LENGTH] = { 0 };     // Current directory path, entries paths are built on it
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    if (snprintf(path, MAX_FILEPATH_LENGTH, "%s", basePath) >= MAX_FILEPATH_LENGTH)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Directory path too long (%s)", basePath);
+        return;
+    }
 
-    if (dir != NULL)
+    DIR **dirs = NULL;                  // Open directories stack
+    int *dirPathLengths = NULL;         // Open directories path lengths, current path is restored to parent on pop
+    int depth = 0;
+    int capacity = 0;
+
+    DIR *dir = opendir(path);
+
+    if (dir == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", path);
+        return;
+    }
+
+    while (dir != NULL)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
+        // Push directory into stack
+        if (depth >= capacity)
         {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
+            int newCapacity = (capacity == 0)? 16 : capacity*2;
+            DIR **newDirs = (DIR **)RL_REALLOC(dirs, newCapacity*sizeof(DIR *));
+            int *newLengths = (newDirs != NULL)? (int *)RL_REALLOC(dirPathLengths, newCapacity*sizeof(int)) : NULL;
+
+            if (newDirs != NULL) dirs = newDirs;
+            if (newLengths == NULL)
             {
-                // Construct new path from our base path
-                sprintf(path, "%s/%s", basePath, dp->d_name);
+                TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for directories scan");
+                closedir(dir);
+                break;
+            }
 
-                if (IsPathFile(path))
-                {
-                    if (filter != NULL)
-                    {
-                        if (IsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+            dirPathLengths = newLengths;
+            capacity = newCapacity;
+        }
 
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
-                }
-                else ScanDirectoryFilesRecursively(path, files, filter);
+        dirs[depth] = dir;
+        dirPathLengths[depth] = (int)strlen(path);
+        depth++;
+        dir = NULL;
+
+        // Read entries until a subdirectory is found (pushed on next iteration) or all directories are done
+        while ((dir == NULL) && (depth > 0))
+        {
+            struct dirent *dp = readdir(dirs[depth - 1]);
+            int dirPathLength = dirPathLengths[depth - 1];
+
+            if (dp == NULL)
+            {
+                // Directory done, pop it and restore parent directory path
+                closedir(dirs[depth - 1]);
+                depth--;
+                if (depth > 0) path[dirPathLengths[depth - 1]] = '\0';
+                continue;
             }
-        }
 
-        closedir(dir);
+            if ((strcmp(dp->d_name, ".") == 0) || (strcmp(dp->d_name, "..") == 0)) continue;
+
+            // Construct entry path from current directory path
+            path[dirPathLength] = '\0';
+
+            if (snprintf(path + dirPathLength, MAX_FILEPATH_LENGTH - dirPathLength, "/%s", dp->d_name) >= (MAX_FILEPATH_LENGTH - dirPathLength))
+            {
+                path[dirPathLength] = '\0';
+                TRACELOG(LOG_WARNING, "FILEIO: Filepath too long, skipped (%s/%s)", path, dp->d_name);
+                continue;
+            }
+
+#if defined(DT_DIR)
+            bool isFile = (dp->d_type == DT_REG);
+            bool isDir = (dp->d_type == DT_DIR);
+
+            // Entry type not provided by filesystem or symbolic link, stat() required
+            if ((dp->d_type == DT_UNKNOWN) || (dp->d_type == DT_LNK))
+            {
+                isFile = IsPathFile(path);
+                isDir = !isFile;
+            }
+#else
+            bool isFile = IsPathFile(path);
+            bool isDir = !isFile;
+#endif
+            if (isFile)
+            {
+                if ((filter == NULL) || IsFileExtension(path, filter)) AddFilePath(builder, path);
+            }
+            else if (isDir)
+            {
+                dir = opendir(path);
+                if (dir == NULL) TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", path);
+            }
+        }
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    // Close directories left open on allocation failure
+    while (depth > 0) closedir(dirs[--depth]);
+
+    RL_FREE(dirs);
+    RL_FREE(dirPathLengths);
 }
 
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
@@ -5479,33 +7736,11 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_GIF_RECORDING)
         if (mods == GLFW_MOD_CONTROL)
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-            #if defined(PLATFORM_WEB)
-                // Download file from MEMFS (emscripten memory filesystem)
-                // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
-                emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", TextFormat("screenrec%03i.gif", screenshotCounter - 1), TextFormat("screenrec%03i.gif", screenshotCounter - 1)));
-            #endif
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
+            if (gifRecording) StopScreenRecording();
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
-                Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+                StartScreenRecording(TextFormat("screenrec%03i.gif", screenshotCounter));
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
             }
         }
         else
@@ -5520,17 +7755,17 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     if ((key == GLFW_KEY_F11) && (action == GLFW_PRESS))
     {
-        eventsRecording = !eventsRecording;
-
         // On finish recording, we export events into a file
-        if (!eventsRecording) ExportAutomationEvents("eventsrec.rep");
+        if (CORE.Automation.recording)
+        {
+            StopAutomationEventRecording();
+            ExportAutomationEvents(TextFormat("%s/eventsrec.rep", CORE.Storage.basePath));
+        }
+        else StartAutomationEventRecording();
     }
     else if ((key == GLFW_KEY_F9) && (action == GLFW_PRESS))
     {
-        LoadAutomationEvents("eventsrec.rep");
-        eventsPlaying = true;
-
-        TRACELOG(LOG_WARNING, "eventsPlaying enabled!");
+        if (LoadAutomationEvents(TextFormat("%s/eventsrec.rep", CORE.Storage.basePath))) PlayAutomationEvents(0.0f);
     }
 #endif
 }
@@ -6980,370 +9215,417 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 }
 #endif
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-// NOTE: Loading happens over AutomationEvent *events
-// TODO: This system should probably be redesigned
-static void LoadAutomationEvents(const char *fileName)
+// Record or play automation events for current frame
+// NOTE: Called after input events polling, played input state replaces polled input state
+static void UpdateAutomationEvents(void)
 {
-    // Load events file (binary)
-    /*
-    FILE *repFile = fopen(fileName, "rb");
-    unsigned char fileId[4] = { 0 };
-
-    fread(fileId, 1, 4, repFile);
-
-    if ((fileId[0] == 'r') && (fileId[1] == 'E') && (fileId[2] == 'P') && (fileId[1] == ' '))
-    {
-        fread(&eventCount, sizeof(int), 1, repFile);
-        TRACELOG(LOG_WARNING, "Events loaded: %i\n", eventCount);
-        fread(events, sizeof(AutomationEvent), eventCount, repFile);
-    }
-
-    fclose(repFile);
-    */
-
-    // Load events file (text)
-    FILE *repFile = fopen(fileName, "rt");
-
-    if (repFile != NULL)
+    if (CORE.Automation.recording) RecordAutomationFrame();
+    else if (CORE.Automation.playing)
     {
-        unsigned int count = 0;
-        char buffer[256] = { 0 };
-
-        fgets(buffer, 256, repFile);
-
-        while (!feof(repFile))
+        if (CORE.Automation.readFrame < CORE.Automation.frameCount) PlayAutomationFrame();
+        else
         {
-            if (buffer[0] == 'c') sscanf(buffer, "c %i", &eventCount);
-            else if (buffer[0] == 'e')
-            {
-                sscanf(buffer, "e %d %d %d %d %d", &events[count].frame, &events[count].type,
-                       &events[count].params[0], &events[count].params[1], &events[count].params[2]);
-
-                count++;
-            }
-
-            fgets(buffer, 256, repFile);
+            ReleaseAutomationInput();
+            CORE.Automation.playing = false;
+            TRACELOG(LOG_INFO, "SYSTEM: Automation events playing finished (%i frames)", CORE.Automation.frameCount);
         }
-
-        if (count != eventCount) TRACELOG(LOG_WARNING, "Events count provided is different than count");
-
-        fclose(repFile);
     }
-
-    TRACELOG(LOG_WARNING, "Events loaded: %i", eventCount);
 }
 
-// Export recorded events into a file
-static void ExportAutomationEvents(const char *fileName)
+// Record current frame input state changes into events stream
+// Frame data: frame time (microseconds), events (type + parameters), EVENT_NONE
+static void RecordAutomationFrame(void)
 {
-    unsigned char fileId[4] = "rEP ";
+    AutomationInputState *state = &CORE.Automation.state;
+    unsigned int eventCount = CORE.Automation.eventCount;
 
-    // Save as binary
-    /*
-    FILE *repFile = fopen(fileName, "wb");
-    fwrite(fileId, sizeof(unsigned char), 4, repFile);
-    fwrite(&eventCount, sizeof(int), 1, repFile);
-    fwrite(events, sizeof(AutomationEvent), eventCount, repFile);
-    fclose(repFile);
-    */
+    #define RECORD_EVENT(type) { WriteAutomationValue(type); CORE.Automation.eventCount++; }
 
-    // Export events as text
-    FILE *repFile = fopen(fileName, "wt");
+    WriteAutomationValue((unsigned int)(CORE.Time.frame*1000000.0));
 
-    if (repFile != NULL)
+    // Keyboard keys state changes
+    if (memcmp(state->keys, CORE.Input.Keyboard.currentKeyState, MAX_KEYBOARD_KEYS) != 0)
     {
-        fprintf(repFile, "# Automation events list\n");
-        fprintf(repFile, "#    c <events_count>\n");
-        fprintf(repFile, "#    e <frame> <event_type> <param0> <param1> <param2> // <event_type_name>\n");
-
-        fprintf(repFile, "c %i\n", eventCount);
-        for (int i = 0; i < eventCount; i++)
+        for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
         {
-            fprintf(repFile, "e %i %i %i %i %i // %s\n", events[i].frame, events[i].type,
-                    events[i].params[0], events[i].params[1], events[i].params[2], autoEventTypeName[events[i].type]);
+            if (state->keys[key] != CORE.Input.Keyboard.currentKeyState[key])
+            {
+                state->keys[key] = CORE.Input.Keyboard.currentKeyState[key];
+                RECORD_EVENT(state->keys[key]? INPUT_KEY_DOWN : INPUT_KEY_UP);
+                WriteAutomationValue(key);
+            }
         }
-
-        fclose(repFile);
     }
-}
 
-// EndDrawing() -> After PollInputEvents()
-// Check event in current frame and save into the events[i] array
-static void RecordAutomationEvent(unsigned int frame)
-{
-    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
+    // Keys and chars pressed queues
+    for (int i = 0; i < CORE.Input.Keyboard.keyPressedQueueCount; i++)
     {
-        // INPUT_KEY_UP (only saved once)
-        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_UP;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        RECORD_EVENT(INPUT_KEY_PRESSED);
+        WriteAutomationValue(CORE.Input.Keyboard.keyPressedQueue[i]);
+    }
 
-        // INPUT_KEY_DOWN
-        if (CORE.Input.Keyboard.currentKeyState[key])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_DOWN;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+    for (int i = 0; i < CORE.Input.Keyboard.charPressedQueueCount; i++)
+    {
+        RECORD_EVENT(INPUT_CHAR_PRESSED);
+        WriteAutomationValue(CORE.Input.Keyboard.charPressedQueue[i]);
     }
 
+    // Mouse buttons state changes
     for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
     {
-        // INPUT_MOUSE_BUTTON_UP
-        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button])
+        if (state->mouseButtons[button] != CORE.Input.Mouse.currentButtonState[button])
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_UP;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
-
-        // INPUT_MOUSE_BUTTON_DOWN
-        if (CORE.Input.Mouse.currentButtonState[button])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_DOWN;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            state->mouseButtons[button] = CORE.Input.Mouse.currentButtonState[button];
+            RECORD_EVENT(state->mouseButtons[button]? INPUT_MOUSE_BUTTON_DOWN : INPUT_MOUSE_BUTTON_UP);
+            WriteAutomationValue(button);
         }
     }
 
-    // INPUT_MOUSE_POSITION (only saved if changed)
-    if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
-        ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
-    {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_POSITION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentPosition.x;
-        events[eventCount].params[1] = (int)CORE.Input.Mouse.currentPosition.y;
-        events[eventCount].params[2] = 0;
+    // Mouse position, delta from previous recorded position
+    int mouseX = (int)roundf(CORE.Input.Mouse.currentPosition.x*AUTOMATION_FIXED_SCALE);
+    int mouseY = (int)roundf(CORE.Input.Mouse.currentPosition.y*AUTOMATION_FIXED_SCALE);
 
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+    if ((mouseX != state->mousePosition[0]) || (mouseY != state->mousePosition[1]))
+    {
+        RECORD_EVENT(INPUT_MOUSE_POSITION);
+        WriteAutomationSigned(mouseX - state->mousePosition[0]);
+        WriteAutomationSigned(mouseY - state->mousePosition[1]);
+        state->mousePosition[0] = mouseX;
+        state->mousePosition[1] = mouseY;
     }
 
-    // INPUT_MOUSE_WHEEL_MOTION
-    if (((int)CORE.Input.Mouse.currentWheelMove.x != (int)CORE.Input.Mouse.previousWheelMove.x) ||
-        ((int)CORE.Input.Mouse.currentWheelMove.y != (int)CORE.Input.Mouse.previousWheelMove.y))
+    // Mouse wheel move
+    int wheelX = (int)roundf(CORE.Input.Mouse.currentWheelMove.x*AUTOMATION_FIXED_SCALE);
+    int wheelY = (int)roundf(CORE.Input.Mouse.currentWheelMove.y*AUTOMATION_FIXED_SCALE);
+
+    if ((wheelX != state->mouseWheel[0]) || (wheelY != state->mouseWheel[1]))
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_WHEEL_MOTION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentWheelMove.x;
-        events[eventCount].params[1] = (int)CORE.Input.Mouse.currentWheelMove.y;;
-        events[eventCount].params[2] = 0;
+        RECORD_EVENT(INPUT_MOUSE_WHEEL_MOTION);
+        WriteAutomationSigned(wheelX);
+        WriteAutomationSigned(wheelY);
+        state->mouseWheel[0] = wheelX;
+        state->mouseWheel[1] = wheelY;
+    }
 
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_WHEEL_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+    // Touch points state and position changes
+    if (state->touchPointCount != CORE.Input.Touch.pointCount)
+    {
+        state->touchPointCount = CORE.Input.Touch.pointCount;
+        RECORD_EVENT(INPUT_TOUCH_COUNT);
+        WriteAutomationValue(state->touchPointCount);
     }
 
     for (int id = 0; id < MAX_TOUCH_POINTS; id++)
     {
-        // INPUT_TOUCH_UP
-        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id])
+        if (state->touchState[id] != CORE.Input.Touch.currentTouchState[id])
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_UP;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            state->touchState[id] = CORE.Input.Touch.currentTouchState[id];
+            RECORD_EVENT(state->touchState[id]? INPUT_TOUCH_DOWN : INPUT_TOUCH_UP);
+            WriteAutomationValue(id);
         }
 
-        // INPUT_TOUCH_DOWN
-        if (CORE.Input.Touch.currentTouchState[id])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_DOWN;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        int touchX = (int)roundf(CORE.Input.Touch.position[id].x*AUTOMATION_FIXED_SCALE);
+        int touchY = (int)roundf(CORE.Input.Touch.position[id].y*AUTOMATION_FIXED_SCALE);
 
-        // INPUT_TOUCH_POSITION
-        // TODO: It requires the id!
-        /*
-        if (((int)CORE.Input.Touch.currentPosition[id].x != (int)CORE.Input.Touch.previousPosition[id].x) ||
-            ((int)CORE.Input.Touch.currentPosition[id].y != (int)CORE.Input.Touch.previousPosition[id].y))
+        if ((touchX != state->touchPosition[id][0]) || (touchY != state->touchPosition[id][1]))
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_POSITION;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = (int)CORE.Input.Touch.currentPosition[id].x;
-            events[eventCount].params[2] = (int)CORE.Input.Touch.currentPosition[id].y;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            RECORD_EVENT(INPUT_TOUCH_POSITION);
+            WriteAutomationValue(id);
+            WriteAutomationSigned(touchX - state->touchPosition[id][0]);
+            WriteAutomationSigned(touchY - state->touchPosition[id][1]);
+            state->touchPosition[id][0] = touchX;
+            state->touchPosition[id][1] = touchY;
         }
-        */
     }
 
+    // Gamepads state changes
     for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
     {
-        // INPUT_GAMEPAD_CONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (CORE.Input.Gamepad.currentState[gamepad] == true)) // Check if changed to ready
+        if (state->gamepadReady[gamepad] != CORE.Input.Gamepad.ready[gamepad])
         {
-            // TODO: Save gamepad connect event
+            state->gamepadReady[gamepad] = CORE.Input.Gamepad.ready[gamepad];
+            RECORD_EVENT(state->gamepadReady[gamepad]? INPUT_GAMEPAD_CONNECT : INPUT_GAMEPAD_DISCONNECT);
+            WriteAutomationValue(gamepad);
         }
-        */
 
-        // INPUT_GAMEPAD_DISCONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (CORE.Input.Gamepad.currentState[gamepad] == false)) // Check if changed to not-ready
-        {
-            // TODO: Save gamepad disconnect event
-        }
-        */
+        if (!state->gamepadReady[gamepad]) continue;
 
         for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++)
         {
-            // INPUT_GAMEPAD_BUTTON_UP
-            if (CORE.Input.Gamepad.previousButtonState[gamepad][button] && !CORE.Input.Gamepad.currentButtonState[gamepad][button])
+            if (state->gamepadButtons[gamepad][button] != CORE.Input.Gamepad.currentButtonState[gamepad][button])
             {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_UP;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
+                state->gamepadButtons[gamepad][button] = CORE.Input.Gamepad.currentButtonState[gamepad][button];
+                RECORD_EVENT(state->gamepadButtons[gamepad][button]? INPUT_GAMEPAD_BUTTON_DOWN : INPUT_GAMEPAD_BUTTON_UP);
+                WriteAutomationValue(gamepad);
+                WriteAutomationValue(button);
             }
+        }
+
+        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
+        {
+            int value = (int)roundf(CORE.Input.Gamepad.axisState[gamepad][axis]*AUTOMATION_FIXED_SCALE);
 
-            // INPUT_GAMEPAD_BUTTON_DOWN
-            if (CORE.Input.Gamepad.currentButtonState[gamepad][button])
+            if (state->gamepadAxis[gamepad][axis] != value)
             {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_DOWN;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
+                state->gamepadAxis[gamepad][axis] = value;
+                RECORD_EVENT(INPUT_GAMEPAD_AXIS_MOTION);
+                WriteAutomationValue(gamepad);
+                WriteAutomationValue(axis);
+                WriteAutomationSigned(value);
             }
         }
+    }
 
-        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    if (state->gesture != GESTURES.current)
+    {
+        state->gesture = GESTURES.current;
+        RECORD_EVENT(INPUT_GESTURE);
+        WriteAutomationValue(state->gesture);
+    }
+#endif
+
+    WriteAutomationValue(EVENT_NONE);
+    CORE.Automation.frameCount++;
+
+    if (CORE.Automation.eventCount > eventCount) TRACELOGD("SYSTEM: [%i] Automation events recorded: %i", CORE.Automation.frameCount - 1, CORE.Automation.eventCount - eventCount);
+}
+
+// Play next frame events from events stream, played input state replaces current input state
+static void PlayAutomationFrame(void)
+{
+    AutomationInputState *state = &CORE.Automation.state;
+
+    unsigned int frameTime = ReadAutomationValue();
+    CORE.Time.frame = (CORE.Automation.timeStep > 0.0f)? (double)CORE.Automation.timeStep : (double)frameTime/1000000.0;
+
+    // Polled keys/chars pressed are discarded, only played ones are registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    unsigned int type = ReadAutomationValue();
+
+    while (type != EVENT_NONE)
+    {
+        // NOTE: Parameters are read before being used, order of evaluation in expressions is not defined
+        switch (type)
         {
-            // INPUT_GAMEPAD_AXIS_MOTION
-            if (CORE.Input.Gamepad.axisState[gamepad][axis] > 0.1f)
+            case INPUT_KEY_UP:
+            case INPUT_KEY_DOWN:
+            {
+                unsigned int key = ReadAutomationValue();
+                if (key < MAX_KEYBOARD_KEYS) state->keys[key] = (type == INPUT_KEY_DOWN);
+            } break;
+            case INPUT_KEY_PRESSED:
+            {
+                int key = (int)ReadAutomationValue();
+                if (CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE) CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount++] = key;
+            } break;
+            case INPUT_CHAR_PRESSED:
+            {
+                int codepoint = (int)ReadAutomationValue();
+                if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE) CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount++] = codepoint;
+            } break;
+            case INPUT_MOUSE_BUTTON_UP:
+            case INPUT_MOUSE_BUTTON_DOWN:
+            {
+                unsigned int button = ReadAutomationValue();
+                if (button < MAX_MOUSE_BUTTONS) state->mouseButtons[button] = (type == INPUT_MOUSE_BUTTON_DOWN);
+            } break;
+            case INPUT_MOUSE_POSITION:
+            {
+                state->mousePosition[0] += ReadAutomationSigned();
+                state->mousePosition[1] += ReadAutomationSigned();
+            } break;
+            case INPUT_MOUSE_WHEEL_MOTION:
+            {
+                state->mouseWheel[0] = ReadAutomationSigned();
+                state->mouseWheel[1] = ReadAutomationSigned();
+            } break;
+            case INPUT_GAMEPAD_CONNECT:
+            case INPUT_GAMEPAD_DISCONNECT:
+            {
+                unsigned int gamepad = ReadAutomationValue();
+                if (gamepad < MAX_GAMEPADS) state->gamepadReady[gamepad] = (type == INPUT_GAMEPAD_CONNECT);
+            } break;
+            case INPUT_GAMEPAD_BUTTON_UP:
+            case INPUT_GAMEPAD_BUTTON_DOWN:
+            {
+                unsigned int gamepad = ReadAutomationValue();
+                unsigned int button = ReadAutomationValue();
+                if ((gamepad < MAX_GAMEPADS) && (button < MAX_GAMEPAD_BUTTONS)) state->gamepadButtons[gamepad][button] = (type == INPUT_GAMEPAD_BUTTON_DOWN);
+            } break;
+            case INPUT_GAMEPAD_AXIS_MOTION:
             {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_AXIS_MOTION;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = axis;
-                events[eventCount].params[2] = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_AXIS_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
+                unsigned int gamepad = ReadAutomationValue();
+                unsigned int axis = ReadAutomationValue();
+                int value = ReadAutomationSigned();
+                if ((gamepad < MAX_GAMEPADS) && (axis < MAX_GAMEPAD_AXIS)) state->gamepadAxis[gamepad][axis] = value;
+            } break;
+            case INPUT_TOUCH_UP:
+            case INPUT_TOUCH_DOWN:
+            {
+                unsigned int id = ReadAutomationValue();
+                if (id < MAX_TOUCH_POINTS) state->touchState[id] = (type == INPUT_TOUCH_DOWN);
+            } break;
+            case INPUT_TOUCH_POSITION:
+            {
+                unsigned int id = ReadAutomationValue();
+                int dx = ReadAutomationSigned();
+                int dy = ReadAutomationSigned();
+                if (id < MAX_TOUCH_POINTS) { state->touchPosition[id][0] += dx; state->touchPosition[id][1] += dy; }
+            } break;
+            case INPUT_TOUCH_COUNT: state->touchPointCount = (int)ReadAutomationValue(); break;
+            case INPUT_GESTURE: state->gesture = ReadAutomationValue(); break;
+            default:
+            {
+                TRACELOG(LOG_WARNING, "SYSTEM: [%i] Automation events stream corrupted, playing stopped", CORE.Automation.readFrame);
+                ReleaseAutomationInput();
+                CORE.Automation.playing = false;
+                return;
             }
         }
+
+        type = ReadAutomationValue();
+    }
+
+    // Played input state replaces current input state
+    memcpy(CORE.Input.Keyboard.currentKeyState, state->keys, MAX_KEYBOARD_KEYS);
+    memcpy(CORE.Input.Mouse.currentButtonState, state->mouseButtons, MAX_MOUSE_BUTTONS);
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)state->mousePosition[0]/AUTOMATION_FIXED_SCALE, (float)state->mousePosition[1]/AUTOMATION_FIXED_SCALE };
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ (float)state->mouseWheel[0]/AUTOMATION_FIXED_SCALE, (float)state->mouseWheel[1]/AUTOMATION_FIXED_SCALE };
+
+    CORE.Input.Touch.pointCount = state->touchPointCount;
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++)
+    {
+        CORE.Input.Touch.currentTouchState[id] = state->touchState[id];
+        CORE.Input.Touch.position[id] = (Vector2){ (float)state->touchPosition[id][0]/AUTOMATION_FIXED_SCALE, (float)state->touchPosition[id][1]/AUTOMATION_FIXED_SCALE };
+    }
+
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
+    {
+        CORE.Input.Gamepad.ready[gamepad] = state->gamepadReady[gamepad];
+        memcpy(CORE.Input.Gamepad.currentButtonState[gamepad], state->gamepadButtons[gamepad], MAX_GAMEPAD_BUTTONS);
+        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++) CORE.Input.Gamepad.axisState[gamepad][axis] = (float)state->gamepadAxis[gamepad][axis]/AUTOMATION_FIXED_SCALE;
     }
 
-    // INPUT_GESTURE
-    if (GESTURES.current != GESTURE_NONE)
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    GESTURES.current = state->gesture;
+#endif
+
+    CORE.Automation.readFrame++;
+}
+
+// Release keys, buttons and touch points held by played events, so they are not kept down once playing stops
+// NOTE: Released input is reported as released on next frame, as if user had released it
+static void ReleaseAutomationInput(void)
+{
+    AutomationInputState *state = &CORE.Automation.state;
+
+    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++) if (state->keys[key]) CORE.Input.Keyboard.currentKeyState[key] = 0;
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++) if (state->mouseButtons[button]) CORE.Input.Mouse.currentButtonState[button] = 0;
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++) if (state->touchState[id]) CORE.Input.Touch.currentTouchState[id] = 0;
+    if (state->touchPointCount > 0) CORE.Input.Touch.pointCount = 0;
+
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
     {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_GESTURE;
-        events[eventCount].params[0] = GESTURES.current;
-        events[eventCount].params[1] = 0;
-        events[eventCount].params[2] = 0;
+        for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++) if (state->gamepadButtons[gamepad][button]) CORE.Input.Gamepad.currentButtonState[gamepad][button] = 0;
+    }
+
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+
+    memset(state, 0, sizeof(AutomationInputState));
+}
+
+// Unload automation events stream chunks
+static void UnloadAutomationEvents(void)
+{
+    if (CORE.Automation.playing) ReleaseAutomationInput();
+
+    AutomationChunk *chunk = CORE.Automation.first;
 
-        TRACELOG(LOG_INFO, "[%i] INPUT_GESTURE: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+    while (chunk != NULL)
+    {
+        AutomationChunk *next = chunk->next;
+        RL_FREE(chunk->data);
+        RL_FREE(chunk);
+        chunk = next;
     }
+
+    CORE.Automation.first = NULL;
+    CORE.Automation.last = NULL;
+    CORE.Automation.frameCount = 0;
+    CORE.Automation.eventCount = 0;
+    CORE.Automation.recording = false;
+    CORE.Automation.playing = false;
 }
 
-// Play automation event
-static void PlayAutomationEvent(unsigned int frame)
+// Write unsigned value into events stream, 7 bits per byte, high bit set if more bytes follow
+// NOTE: Stream grows by chunks, recording has no events limit
+static void WriteAutomationValue(unsigned int value)
 {
-    for (unsigned int i = 0; i < eventCount; i++)
+    do
     {
-        if (events[i].frame == frame)
+        AutomationChunk *chunk = CORE.Automation.last;
+
+        if ((chunk == NULL) || (chunk->size == chunk->capacity))
         {
-            switch (events[i].type)
-            {
-                // Input events
-                case INPUT_KEY_UP: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = false; break;             // param[0]: key
-                case INPUT_KEY_DOWN: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = true; break;            // param[0]: key
-                case INPUT_MOUSE_BUTTON_UP: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = false; break;    // param[0]: key
-                case INPUT_MOUSE_BUTTON_DOWN: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = true; break;   // param[0]: key
-                case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
-                {
-                    CORE.Input.Mouse.currentPosition.x = (float)events[i].params[0];
-                    CORE.Input.Mouse.currentPosition.y = (float)events[i].params[1];
-                } break;
-                case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta
-                {
-                    CORE.Input.Mouse.currentWheelMove.x = (float)events[i].params[0]; break;
-                    CORE.Input.Mouse.currentWheelMove.y = (float)events[i].params[1]; break;
-                } break;
-                case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[events[i].params[0]] = false; break;            // param[0]: id
-                case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[events[i].params[0]] = true; break;           // param[0]: id
-                case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
-                {
-                    CORE.Input.Touch.position[events[i].params[0]].x = (float)events[i].params[1];
-                    CORE.Input.Touch.position[events[i].params[0]].y = (float)events[i].params[2];
-                } break;
-                case INPUT_GAMEPAD_CONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = true; break;                // param[0]: gamepad
-                case INPUT_GAMEPAD_DISCONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = false; break;            // param[0]: gamepad
-                case INPUT_GAMEPAD_BUTTON_UP: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = false; break;    // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_BUTTON_DOWN: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = true; break;   // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
-                {
-                    CORE.Input.Gamepad.axisState[events[i].params[0]][events[i].params[1]] = ((float)events[i].params[2]/32768.0f);
-                } break;
-                case INPUT_GESTURE: GESTURES.current = events[i].params[0]; break;     // param[0]: gesture (enum Gesture) -> rgestures.h: GESTURES.current
-
-                // Window events
-                case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
-                case WINDOW_MAXIMIZE: MaximizeWindow(); break;
-                case WINDOW_MINIMIZE: MinimizeWindow(); break;
-                case WINDOW_RESIZE: SetWindowSize(events[i].params[0], events[i].params[1]); break;
-
-                // Custom events
-                case ACTION_TAKE_SCREENSHOT:
-                {
-                    TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
-                    screenshotCounter++;
-                } break;
-                case ACTION_SETTARGETFPS: SetTargetFPS(events[i].params[0]); break;
-                default: break;
-            }
+            chunk = (AutomationChunk *)RL_CALLOC(1, sizeof(AutomationChunk));
+            chunk->data = (unsigned char *)RL_MALLOC(AUTOMATION_EVENTS_CHUNK_SIZE);
+            chunk->capacity = AUTOMATION_EVENTS_CHUNK_SIZE;
+
+            if (CORE.Automation.last != NULL) CORE.Automation.last->next = chunk;
+            else CORE.Automation.first = chunk;
+            CORE.Automation.last = chunk;
+        }
+
+        unsigned char byte = value & 0x7f;
+        value >>= 7;
+        if (value > 0) byte |= 0x80;
+
+        chunk->data[chunk->size++] = byte;
+
+    } while (value > 0);
+}
+
+// Write signed value into events stream, zigzag encoded so small negative values use few bytes
+static void WriteAutomationSigned(int value)
+{
+    WriteAutomationValue(((unsigned int)value << 1) ^ (unsigned int)(value >> 31));
+}
+
+// Read unsigned value from events stream, returns 0 (EVENT_NONE) at end of stream
+static unsigned int ReadAutomationValue(void)
+{
+    unsigned int value = 0;
+    int shift = 0;
+
+    while (CORE.Automation.readChunk != NULL)
+    {
+        if (CORE.Automation.readOffset >= CORE.Automation.readChunk->size)
+        {
+            CORE.Automation.readChunk = CORE.Automation.readChunk->next;
+            CORE.Automation.readOffset = 0;
+            continue;
         }
+
+        unsigned char byte = CORE.Automation.readChunk->data[CORE.Automation.readOffset++];
+        if (shift < 32) value |= (unsigned int)(byte & 0x7f) << shift;
+        shift += 7;
+
+        if ((byte & 0x80) == 0) break;
     }
+
+    return value;
+}
+
+// Read signed value from events stream (zigzag encoded)
+static int ReadAutomationSigned(void)
+{
+    unsigned int value = ReadAutomationValue();
+
+    return (int)(value >> 1) ^ -(int)(value & 1);
 }
-#endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
@@ -56,6 +56,8 @@
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_GPU_ZONES                    128    // Maximum number of GPU timer zones waiting for results
+*       #define RL_MAX_GPU_ZONE_DEPTH                16    // Maximum GPU timer zones nesting depth
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -129,6 +131,12 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+// Support profile zones macros
+#ifndef PROFILE_ZONE_BEGIN
+    #define PROFILE_ZONE_BEGIN(name) (void)0
+    #define PROFILE_ZONE_END() (void)0
+#endif
+
 // Allow custom memory allocators
 #ifndef RL_MALLOC
     #define RL_MALLOC(sz)     malloc(sz)
@@ -227,6 +235,14 @@
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// GPU timer zones limits
+#ifndef RL_MAX_GPU_ZONES
+    #define RL_MAX_GPU_ZONES                       128      // Maximum number of GPU timer zones waiting for results (two timestamp queries each)
+#endif
+#ifndef RL_MAX_GPU_ZONE_DEPTH
+    #define RL_MAX_GPU_ZONE_DEPTH                   16      // Maximum GPU timer zones nesting depth
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.01      // Default near cull distance
@@ -383,6 +399,38 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Display list draw call
+typedef struct rlDisplayListDraw {
+    int mode;                   // Drawing mode: LINES, TRIANGLES (recorded QUADS are converted to TRIANGLES)
+    int vertexOffset;           // First vertex of the draw
+    int vertexCount;            // Number of vertex of the draw
+    unsigned int textureId;     // Texture id to be used on the draw
+} rlDisplayListDraw;
+
+// rlDisplayList type, render batch output recorded into static vertex buffers
+typedef struct rlDisplayList {
+    int vertexCount;            // Number of vertex recorded
+    int vertexCapacity;         // Number of vertex allocated on CPU arrays (only used while recording)
+
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+
+    rlDisplayListDraw *draws;   // Draw calls array, a new draw is registered on mode or texture change
+    int drawCount;              // Draw calls counter
+    int drawCapacity;           // Draw calls allocated
+
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[3];      // OpenGL Vertex Buffer Objects id (3 types of vertex data)
+} rlDisplayList;
+
+// GPU timer zone result
+typedef struct rlGpuZone {
+    const char *name;           // Zone name
+    double start;               // Zone start GPU timestamp (in seconds)
+    double duration;            // Zone GPU execution time (in seconds)
+} rlGpuZone;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -661,6 +709,8 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id (set by rlSetShader(), default shader otherwise)
+RLAPI int *rlGetShaderLocsCurrent(void);                // Get current shader locations
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -674,6 +724,13 @@ RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // C
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Display lists management
+// NOTE: Display lists record the render batch output once and replay it from static vertex buffers
+RLAPI void rlBeginDisplayList(void);                                        // Begin display list recording (render batch is recorded instead of drawn)
+RLAPI rlDisplayList rlEndDisplayList(void);                                 // End display list recording and load vertex data into GPU
+RLAPI void rlUnloadDisplayList(rlDisplayList list);                         // Unload display list vertex data from GPU memory
+RLAPI void rlDrawDisplayList(rlDisplayList list, float r, float g, float b, float a); // Draw display list with current shader, matrices and tint color
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -682,6 +739,7 @@ RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic);     // Load a new attributes element buffer
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset);     // Update GPU buffer with new data
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset);   // Update vertex buffer elements with new data
+RLAPI void rlOrphanVertexBuffer(unsigned int bufferId, int size);        // Orphan vertex buffer data store, new data store allocated (no sync with pending draws)
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer);
@@ -704,6 +762,12 @@ RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int forma
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
 
+// Pixel buffers management (asynchronous screen pixels reading)
+RLAPI unsigned int rlLoadPixelBuffer(int width, int height);              // Load pixel pack buffer to read screen pixels (RGBA), returns 0 if not supported
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                          // Unload pixel pack buffer
+RLAPI void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height);  // Read screen pixels into pixel buffer (copied on GPU, does not wait)
+RLAPI void rlReadPixelBuffer(unsigned int id, void *dest, int width, int height);   // Read pixel buffer data (GPU->CPU), rows are bottom-up
+
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
 RLAPI void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel);  // Attach texture/renderbuffer to a framebuffer
@@ -725,6 +789,7 @@ RLAPI void rlSetShader(unsigned int id, int *locs);
 // Compute shader management
 RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
 RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ);  // Dispatch compute shader (equivalent to *draw* for graphics pipeline)
+RLAPI void rlComputeShaderBarrier(void);                                       // Wait for compute shader buffers writes to be visible (storage buffers, vertex attributes)
 
 // Shader buffer storage object management (ssbo)
 RLAPI unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint); // Load shader storage buffer object (SSBO)
@@ -738,6 +803,14 @@ RLAPI unsigned int rlGetShaderBufferSize(unsigned int id);
 // Buffer management
 RLAPI void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly);  // Bind image texture
 
+// GPU timer zones management (timestamp queries)
+RLAPI void rlEnableGpuZones(void);                                        // Enable GPU timer zones recording
+RLAPI void rlDisableGpuZones(void);                                       // Disable GPU timer zones recording
+RLAPI void rlBeginGpuZone(const char *name);                              // Begin GPU timer zone, zones can be nested (name must be a static string)
+RLAPI void rlEndGpuZone(void);                                            // End last GPU timer zone
+RLAPI int rlGetGpuZoneResults(rlGpuZone *zones, int maxCount);            // Get finished GPU timer zones (oldest first, does not wait), returns zones count
+RLAPI double rlGetGpuTimestamp(void);                                     // Get current GPU timestamp (in seconds), 0 if not supported
+
 // Matrix state management
 RLAPI Matrix rlGetMatrixModelview(void);                                  // Get internal modelview matrix
 RLAPI Matrix rlGetMatrixProjection(void);                                 // Get internal projection matrix
@@ -820,7 +893,7 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcpy()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
 //----------------------------------------------------------------------------------
@@ -998,6 +1071,9 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        bool displayListRecording;          // Display list recording flag (render batch is recorded instead of drawn)
+        rlDisplayList displayList;          // Display list being recorded
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1015,11 +1091,24 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool timerQuery;                    // Timer queries support (GL_ARB_timer_query)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        bool enabled;                       // GPU timer zones recording enabled
+        unsigned int queries[2*RL_MAX_GPU_ZONES];   // Timestamp queries, zone slot uses begin/end pair
+        const char *names[RL_MAX_GPU_ZONES];        // Zones names, per zone slot
+        bool ended[RL_MAX_GPU_ZONES];       // Zones end timestamp issued, per zone slot
+        unsigned int epochs[RL_MAX_GPU_ZONES];  // Results requests count when zone began, per zone slot
+        unsigned int epoch;                 // Results requests count (rlGetGpuZoneResults() calls)
+        int head;                           // Oldest zone waiting for results slot
+        int count;                          // Zones waiting for results count
+        int stack[RL_MAX_GPU_ZONE_DEPTH];   // Open zones slots stack (-1 for not recorded zones)
+        int depth;                          // Open zones count
+    } GpuZones;         // GPU timer zones (ring buffer of timestamp queries)
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1051,6 +1140,7 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlRecordRenderBatch(rlRenderBatch *batch);  // Record render batch vertex data and draw calls into display list
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -2159,6 +2249,10 @@ void rlglClose(void)
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.GpuZones.queries[0] != 0) glDeleteQueries(2*RL_MAX_GPU_ZONES, RLGL.GpuZones.queries);
+#endif
 }
 
 // Load OpenGL extensions
@@ -2193,6 +2287,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = GLAD_GL_EXT_texture_filter_anisotropic;
     RLGL.ExtSupported.texMirrorClamp = GLAD_GL_EXT_texture_mirror_clamp;
+    RLGL.ExtSupported.timerQuery = GLAD_GL_ARB_timer_query;
 #else
     // Register supported extensions flags
     // OpenGL 3.3 extensions supported by default (core)
@@ -2204,6 +2299,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.timerQuery = true;
 #endif
 
     // Optional OpenGL 3.3 extensions
@@ -2516,6 +2612,26 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
+// Get current shader locs
+int *rlGetShaderLocsCurrent(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    locs = RLGL.State.currentShaderLocs;
+#endif
+    return locs;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
@@ -2691,11 +2807,21 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    PROFILE_ZONE_BEGIN("rlDrawRenderBatch");
+
+    // NOTE: GPU timer zone only measures batches with vertex data, empty batches are flushed frequently
+    bool gpuZone = (RLGL.State.vertexCounter > 0) && !RLGL.State.displayListRecording;
+    if (gpuZone) rlBeginGpuZone("rlDrawRenderBatch");
+
+    // Record batch vertex data into display list, batch is not drawn while recording
+    bool recording = RLGL.State.displayListRecording;
+    if (recording && (RLGL.State.vertexCounter > 0)) rlRecordRenderBatch(batch);
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    if ((RLGL.State.vertexCounter > 0) && !recording)
     {
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
@@ -2741,7 +2867,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     Matrix matModelView = RLGL.State.modelview;
 
     int eyeCount = 1;
-    if (RLGL.State.stereoRender) eyeCount = 2;
+    if (RLGL.State.stereoRender && !recording) eyeCount = 2;
 
     for (int eye = 0; eye < eyeCount; eye++)
     {
@@ -2757,7 +2883,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         }
 
         // Draw buffers
-        if (RLGL.State.vertexCounter > 0)
+        if ((RLGL.State.vertexCounter > 0) && !recording)
         {
             // Set current shader and upload current MVP matrix
             glUseProgram(RLGL.State.currentShaderId);
@@ -2882,6 +3008,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+    if (gpuZone) rlEndGpuZone();
+
+    PROFILE_ZONE_END();
 #endif
 }
 
@@ -2931,6 +3061,183 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Display lists management
+//-----------------------------------------------------------------------------------------
+// Begin display list recording
+// NOTE: Render batch output (vertex data, draw modes and textures) is recorded instead of drawn
+// until rlEndDisplayList(), other state changes (shader, blending, scissor, matrices) are not recorded
+void rlBeginDisplayList(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.displayListRecording)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Display list already recording, nested display lists not supported");
+        return;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Draw batched vertex data before recording
+
+    RLGL.State.displayList = (rlDisplayList){ 0 };
+    RLGL.State.displayListRecording = true;
+#endif
+}
+
+// End display list recording and load recorded vertex data into GPU
+// NOTE: Recorded vertex data is freed from CPU memory once uploaded
+rlDisplayList rlEndDisplayList(void)
+{
+    rlDisplayList list = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.displayListRecording) return list;
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Record remaining batched vertex data
+
+    list = RLGL.State.displayList;
+    RLGL.State.displayList = (rlDisplayList){ 0 };
+    RLGL.State.displayListRecording = false;
+
+    if (list.vertexCount > 0)
+    {
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &list.vaoId);
+            glBindVertexArray(list.vaoId);
+        }
+
+        // Vertex position buffer (shader-location = 0)
+        glGenBuffers(1, &list.vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, list.vertexCount*3*sizeof(float), list.vertices, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+        // Vertex texcoord buffer (shader-location = 1)
+        glGenBuffers(1, &list.vboId[1]);
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, list.vertexCount*2*sizeof(float), list.texcoords, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+        // Vertex color buffer (shader-location = 3)
+        glGenBuffers(1, &list.vboId[2]);
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, list.vertexCount*4*sizeof(unsigned char), list.colors, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+        glVertexAttribPointer(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+
+        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        TRACELOG(RL_LOG_INFO, "RLGL: Display list loaded successfully in VRAM (GPU) (%i vertices, %i draws)", list.vertexCount, list.drawCount);
+    }
+
+    RL_FREE(list.vertices);
+    RL_FREE(list.texcoords);
+    RL_FREE(list.colors);
+    list.vertices = NULL;
+    list.texcoords = NULL;
+    list.colors = NULL;
+    list.vertexCapacity = 0;
+#endif
+
+    return list;
+}
+
+// Unload display list vertex data from GPU memory
+void rlUnloadDisplayList(rlDisplayList list)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao && (list.vaoId > 0)) glDeleteVertexArrays(1, &list.vaoId);
+
+    for (int i = 0; i < 3; i++) if (list.vboId[i] > 0) glDeleteBuffers(1, &list.vboId[i]);
+
+    RL_FREE(list.vertices);
+    RL_FREE(list.texcoords);
+    RL_FREE(list.colors);
+    RL_FREE(list.draws);
+#endif
+}
+
+// Draw display list with current shader, matrices and tint color
+// NOTE: Current transform matrix (rlTranslatef(), rlRotatef(), rlScalef()) is applied on shader,
+// one draw call is issued per recorded texture or mode change
+void rlDrawDisplayList(rlDisplayList list, float r, float g, float b, float a)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((list.vertexCount == 0) || (list.vboId[0] == 0)) return;
+
+    if (RLGL.State.displayListRecording)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Display list can not be drawn while recording a display list");
+        return;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Draw batched vertex data before display list
+
+    glUseProgram(RLGL.State.currentShaderId);
+
+    Matrix matModelView = RLGL.State.modelview;
+    if (RLGL.State.transformRequired) matModelView = rlMatrixMultiply(RLGL.State.transform, RLGL.State.modelview);
+
+    // Create modelview-projection matrix and upload to shader
+    Matrix matMVP = rlMatrixMultiply(matModelView, RLGL.State.projection);
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
+    glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+
+    // Tint color is applied as diffuse color
+    glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], r, g, b, a);
+    glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(list.vaoId);
+    else
+    {
+        // Bind vertex attrib: position (shader-location = 0)
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+        // Bind vertex attrib: texcoord (shader-location = 1)
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[1]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        // Bind vertex attrib: color (shader-location = 3)
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[2]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+
+    glActiveTexture(GL_TEXTURE0);
+
+    for (int i = 0; i < list.drawCount; i++)
+    {
+        glBindTexture(GL_TEXTURE_2D, list.draws[i].textureId);
+        glDrawArrays(list.draws[i].mode, list.draws[i].vertexOffset, list.draws[i].vertexCount);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+    else
+    {
+        // Disable display list vertex attributes, next draw calls set their own attributes
+        glDisableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glDisableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glDisableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    glUseProgram(0);    // Unbind shader program
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3423,6 +3730,62 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel pack buffer to read screen pixels asynchronously (RGBA, 8 bit per channel)
+// NOTE: Pixel pack buffers are only supported on OpenGL 2.1+ (desktop), returns 0 if not supported
+unsigned int rlLoadPixelBuffer(int width, int height)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, width*height*4, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Unload pixel pack buffer
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Read screen pixels into pixel buffer
+// NOTE: Pixels are copied on GPU side once previous commands are done, function does not wait for them
+void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);    // Buffer offset 0
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Read pixel buffer data (GPU->CPU)
+// NOTE 1: Rows are bottom-up, (0,0) is the bottom left corner of the framebuffer, alpha channel is not modified
+// NOTE 2: Function waits for pending pixels copy, read pixel buffer at least one frame later to avoid stalls
+void rlReadPixelBuffer(unsigned int id, void *dest, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+
+    void *pixels = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+
+    if (pixels != NULL)
+    {
+        memcpy(dest, pixels, width*height*4);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    else TRACELOG(RL_LOG_WARNING, "PBO: [ID %i] Failed to map pixel buffer", id);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3611,6 +3974,17 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #endif
 }
 
+// Orphan vertex buffer data store, a new data store is allocated with same size (data undefined)
+// NOTE: Previous data store is released by driver once pending draws using it are done,
+// so buffer can be updated without waiting for GPU (streaming buffers)
+void rlOrphanVertexBuffer(unsigned int id, int size)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+#endif
+}
+
 // Update vertex buffer elements with new data
 // NOTE: dataSize and offset must be provided in bytes
 void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
@@ -4134,6 +4508,15 @@ void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned
 #endif
 }
 
+// Wait for compute shader buffers writes to be visible
+// NOTE: Required before reading storage buffers written by a compute shader, in a dispatch or as vertex attributes
+void rlComputeShaderBarrier(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+#endif
+}
+
 // Load shader storage buffer object (SSBO)
 unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
 {
@@ -4218,6 +4601,157 @@ void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool re
 #endif
 }
 
+// GPU timer zones management
+//-----------------------------------------------------------------------------------------
+// Enable GPU timer zones recording
+// NOTE: Timestamp queries are loaded on first enable, they are only available on OpenGL 3.3+ (or GL_ARB_timer_query)
+void rlEnableGpuZones(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.timerQuery)
+    {
+        if (RLGL.GpuZones.queries[0] == 0) glGenQueries(2*RL_MAX_GPU_ZONES, RLGL.GpuZones.queries);
+        RLGL.GpuZones.enabled = true;
+    }
+    else TRACELOG(RL_LOG_WARNING, "GL: GPU timer zones not supported (GL_ARB_timer_query)");
+#endif
+}
+
+// Disable GPU timer zones recording
+// NOTE: Zones already recorded can still be retrieved with rlGetGpuZoneResults()
+void rlDisableGpuZones(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    RLGL.GpuZones.enabled = false;
+#endif
+}
+
+// Begin GPU timer zone, a timestamp query is issued at current GPU commands point
+// NOTE: If there are already RL_MAX_GPU_ZONES zones waiting for results, zone is not recorded (no GPU stall)
+void rlBeginGpuZone(const char *name)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    int slot = -1;
+
+    if (RLGL.GpuZones.enabled && (RLGL.GpuZones.count < RL_MAX_GPU_ZONES) && (RLGL.GpuZones.depth < RL_MAX_GPU_ZONE_DEPTH))
+    {
+        slot = (RLGL.GpuZones.head + RLGL.GpuZones.count)%RL_MAX_GPU_ZONES;
+
+        glQueryCounter(RLGL.GpuZones.queries[2*slot], GL_TIMESTAMP);
+        RLGL.GpuZones.names[slot] = name;
+        RLGL.GpuZones.ended[slot] = false;
+        RLGL.GpuZones.epochs[slot] = RLGL.GpuZones.epoch;
+        RLGL.GpuZones.count++;
+    }
+
+    // NOTE: Zones nested deeper than RL_MAX_GPU_ZONE_DEPTH are counted but not recorded
+    if (RLGL.GpuZones.depth < RL_MAX_GPU_ZONE_DEPTH) RLGL.GpuZones.stack[RLGL.GpuZones.depth] = slot;
+    RLGL.GpuZones.depth++;
+#endif
+}
+
+// End last GPU timer zone
+void rlEndGpuZone(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.GpuZones.depth > 0)
+    {
+        RLGL.GpuZones.depth--;
+
+        if (RLGL.GpuZones.depth < RL_MAX_GPU_ZONE_DEPTH)
+        {
+            int slot = RLGL.GpuZones.stack[RLGL.GpuZones.depth];
+
+            if (slot >= 0)
+            {
+                glQueryCounter(RLGL.GpuZones.queries[2*slot + 1], GL_TIMESTAMP);
+                RLGL.GpuZones.ended[slot] = true;
+            }
+        }
+    }
+#endif
+}
+
+// Get finished GPU timer zones, zones are returned in begin order
+// NOTE: Results are usually available a few frames later, function never waits for GPU
+// NOTE: Zones must be ended before the second results request after they began (usually next frame),
+// zones still open at that point are stale (rlEndGpuZone() missing), they are closed and removed
+// from open zones stack, so they do not block later zones results
+int rlGetGpuZoneResults(rlGpuZone *zones, int maxCount)
+{
+    int zoneCount = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    RLGL.GpuZones.epoch++;
+
+    // Close stale zones, remaining open zones are compacted in stack
+    int stackSize = (RLGL.GpuZones.depth < RL_MAX_GPU_ZONE_DEPTH)? RLGL.GpuZones.depth : RL_MAX_GPU_ZONE_DEPTH;
+    int openCount = 0;
+
+    for (int i = 0; i < stackSize; i++)
+    {
+        int slot = RLGL.GpuZones.stack[i];
+
+        if ((slot >= 0) && ((RLGL.GpuZones.epoch - RLGL.GpuZones.epochs[slot]) > 1))
+        {
+            TRACELOG(RL_LOG_WARNING, "GL: GPU timer zone [%s] not ended, zone closed", RLGL.GpuZones.names[slot]);
+
+            glQueryCounter(RLGL.GpuZones.queries[2*slot + 1], GL_TIMESTAMP);
+            RLGL.GpuZones.ended[slot] = true;
+        }
+        else RLGL.GpuZones.stack[openCount++] = slot;
+    }
+
+    RLGL.GpuZones.depth -= (stackSize - openCount);
+
+    while ((zoneCount < maxCount) && (RLGL.GpuZones.count > 0))
+    {
+        int slot = RLGL.GpuZones.head;
+
+        if (!RLGL.GpuZones.ended[slot]) break;
+
+        // NOTE: Timestamp queries complete in order, end query availability implies begin availability
+        GLint available = 0;
+        glGetQueryObjectiv(RLGL.GpuZones.queries[2*slot + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        GLint64 begin = 0;
+        GLint64 end = 0;
+        glGetQueryObjecti64v(RLGL.GpuZones.queries[2*slot], GL_QUERY_RESULT, &begin);
+        glGetQueryObjecti64v(RLGL.GpuZones.queries[2*slot + 1], GL_QUERY_RESULT, &end);
+
+        zones[zoneCount].name = RLGL.GpuZones.names[slot];
+        zones[zoneCount].start = (double)begin/1000000000.0;
+        zones[zoneCount].duration = (double)(end - begin)/1000000000.0;
+        zoneCount++;
+
+        RLGL.GpuZones.head = (RLGL.GpuZones.head + 1)%RL_MAX_GPU_ZONES;
+        RLGL.GpuZones.count--;
+    }
+#endif
+
+    return zoneCount;
+}
+
+// Get current GPU timestamp (in seconds), returns 0 if not supported (OpenGL 3.3 required)
+// NOTE: Useful to map GPU timer zones into CPU time, timestamp is taken once previous commands reached the GPU
+double rlGetGpuTimestamp(void)
+{
+    double timestamp = 0.0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // NOTE: glGetInteger64v() requires OpenGL 3.2, it is not available on OpenGL 2.1 (GL_ARB_timer_query)
+    if (RLGL.ExtSupported.timerQuery)
+    {
+        GLint64 value = 0;
+        glGetInteger64v(GL_TIMESTAMP, &value);
+        timestamp = (double)value/1000000000.0;
+    }
+#endif
+
+    return timestamp;
+}
+
 // Matrix state management
 //-----------------------------------------------------------------------------------------
 // Get internal modelview matrix
@@ -4624,6 +5158,98 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Record render batch vertex data and draw calls into display list being recorded
+// NOTE: QUADS draws are converted to TRIANGLES (same vertex order as batch indices),
+// so display lists do not require an index buffer
+static void rlRecordRenderBatch(rlRenderBatch *batch)
+{
+    rlDisplayList *list = &RLGL.State.displayList;
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    const int quadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        int mode = (batch->draws[i].mode == RL_LINES)? RL_LINES : RL_TRIANGLES;
+        int vertexCount = (batch->draws[i].mode == RL_QUADS)? batch->draws[i].vertexCount/4*6 : batch->draws[i].vertexCount;
+
+        if (vertexCount > 0)
+        {
+            // Grow recorded vertex data arrays if required
+            if ((list->vertexCount + vertexCount) > list->vertexCapacity)
+            {
+                int capacity = (list->vertexCapacity > 0)? list->vertexCapacity : 1024;
+                while (capacity < (list->vertexCount + vertexCount)) capacity *= 2;
+
+                // NOTE: Arrays successfully grown are kept, capacity is only updated when all of them grew
+                float *vertices = (float *)RL_REALLOC(list->vertices, capacity*3*sizeof(float));
+                if (vertices != NULL) list->vertices = vertices;
+                float *texcoords = (float *)RL_REALLOC(list->texcoords, capacity*2*sizeof(float));
+                if (texcoords != NULL) list->texcoords = texcoords;
+                unsigned char *colors = (unsigned char *)RL_REALLOC(list->colors, capacity*4*sizeof(unsigned char));
+                if (colors != NULL) list->colors = colors;
+
+                if ((vertices == NULL) || (texcoords == NULL) || (colors == NULL))
+                {
+                    TRACELOG(RL_LOG_WARNING, "RLGL: Failed to grow display list vertex data, batch not recorded");
+                    return;
+                }
+
+                list->vertexCapacity = capacity;
+            }
+
+            // Register a new draw call on mode or texture change
+            if ((list->drawCount == 0) || (list->draws[list->drawCount - 1].mode != mode) ||
+                (list->draws[list->drawCount - 1].textureId != batch->draws[i].textureId))
+            {
+                if (list->drawCount >= list->drawCapacity)
+                {
+                    int drawCapacity = (list->drawCapacity > 0)? list->drawCapacity*2 : 32;
+                    rlDisplayListDraw *draws = (rlDisplayListDraw *)RL_REALLOC(list->draws, drawCapacity*sizeof(rlDisplayListDraw));
+
+                    if (draws == NULL)
+                    {
+                        TRACELOG(RL_LOG_WARNING, "RLGL: Failed to grow display list draw calls, batch not recorded");
+                        return;
+                    }
+
+                    list->draws = draws;
+                    list->drawCapacity = drawCapacity;
+                }
+
+                list->draws[list->drawCount].mode = mode;
+                list->draws[list->drawCount].vertexOffset = list->vertexCount;
+                list->draws[list->drawCount].vertexCount = 0;
+                list->draws[list->drawCount].textureId = batch->draws[i].textureId;
+                list->drawCount++;
+            }
+
+            if (batch->draws[i].mode == RL_QUADS)
+            {
+                for (int j = 0; j < vertexCount; j++)
+                {
+                    int index = vertexOffset + j/6*4 + quadIndices[j%6];
+                    int k = list->vertexCount + j;
+
+                    memcpy(&list->vertices[3*k], &buffer->vertices[3*index], 3*sizeof(float));
+                    memcpy(&list->texcoords[2*k], &buffer->texcoords[2*index], 2*sizeof(float));
+                    memcpy(&list->colors[4*k], &buffer->colors[4*index], 4*sizeof(unsigned char));
+                }
+            }
+            else
+            {
+                memcpy(&list->vertices[3*list->vertexCount], &buffer->vertices[3*vertexOffset], vertexCount*3*sizeof(float));
+                memcpy(&list->texcoords[2*list->vertexCount], &buffer->texcoords[2*vertexOffset], vertexCount*2*sizeof(float));
+                memcpy(&list->colors[4*list->vertexCount], &buffer->colors[4*vertexOffset], vertexCount*4*sizeof(unsigned char));
+            }
+
+            list->draws[list->drawCount - 1].vertexCount += vertexCount;
+            list->vertexCount += vertexCount;
+        }
+
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static char *rlGetCompressedFormatName(int format)
@@ -53,10 +53,14 @@
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 #include "raymath.h"        // Required for: Vector3, Quaternion and Matrix functionality
 
+#define BOUNDS_IMPLEMENTATION
+#include "rbounds.h"        // Required for: BoundsTree, box tree
+
 #include <stdio.h>          // Required for: sprintf()
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -134,10 +138,146 @@
     #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
 #endif
 
+#define MESH_TANGENTS_JOB_SIZE   65536    // Mesh tangents generation job range (triangles or vertices), smaller meshes are computed on calling thread
+#define MESH_TANGENTS_MAX_JOBS      16    // Mesh tangents generation maximum ranges per pass
+
+// NOTE: Voxel chunk worst case (alternating voxels) generates 3 quads per voxel,
+// chunk size must keep chunk meshes vertex count under 65536 (16bit indices)
+#define VOXELMAP_CHUNK_SIZE         16    // Voxel map chunk size (voxels per axis)
+#define VOXELMAP_CHUNK_PADDED       (VOXELMAP_CHUNK_SIZE + 2)   // Voxel map chunk size including neighbour voxels border
+
+// NOTE: Jobs queue is shared with other modules (MAX_JOB_QUEUE_SIZE), remaining dirty chunks are queued on next draws
+#ifndef VOXELMAP_MAX_CHUNK_JOBS
+    #define VOXELMAP_MAX_CHUNK_JOBS    64    // Voxel map maximum chunk meshing jobs queued per draw
+#endif
+
+// Voxel map chunk voxels index (including neighbour voxels border), chunk coordinates in [-1..VOXELMAP_CHUNK_SIZE] range
+#define VOXEL_CHUNK_INDEX(x, y, z)  ((((z) + 1)*VOXELMAP_CHUNK_PADDED + ((y) + 1))*VOXELMAP_CHUNK_PADDED + ((x) + 1))
+
+#define TERRAIN_PATCH_SIZE          32    // Terrain LOD node grid size (quads per side), leaf nodes grid matches heightmap samples
+#define TERRAIN_MAX_LOD_LEVELS      12    // Terrain LOD quadtree maximum levels
+#define TERRAIN_LOD_RANGE         2.5f    // Terrain LOD level range (multiple of LOD level node size)
+#define TERRAIN_MORPH_START       0.7f    // Terrain LOD level morph start (fraction of LOD level range)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Box tree box
+typedef struct BoxTreeBox {
+    BoundingBox bounds;             // Box bounds
+    int userId;                     // Box user id, reported in queries
+    int node;                       // Box leaf node, next free box if removed
+    bool active;                    // Box is in use
+} BoxTreeBox;
+
+// Box tree internal state
+typedef struct BoxTreeState {
+    float margin;                   // Leaves bounds margin
+
+    BoxTreeBox *boxes;              // Boxes array
+    int boxCount;                   // Boxes array used entries (including removed boxes)
+    int boxCapacity;                // Boxes array capacity
+    int freeBox;                    // First removed box (free list), -1 if none
+
+    BoundsTree tree;                // Boxes tree, leaves bounds are boxes bounds enlarged by margin
+} BoxTreeState;
+
+// Voxel map chunk, chunk voxels drawn from a greedy meshed mesh
+typedef struct VoxelChunk {
+    Mesh mesh;                      // Chunk mesh (vertexCount is 0 for empty chunks)
+    unsigned int jobId;             // Chunk last meshing job id
+    bool pending;                   // Chunk meshing job in flight, mesh is replaced on job finish
+    bool dirty;                     // Chunk requires remesh (voxels changed)
+} VoxelChunk;
+
+// Voxel map internal state
+typedef struct VoxelMapState {
+    int chunkCountX;                // Chunks count along X axis
+    int chunkCountY;                // Chunks count along Y axis
+    int chunkCountZ;                // Chunks count along Z axis
+    VoxelChunk *chunks;             // Chunks array, indexed as chunks[(z*chunkCountY + y)*chunkCountX + x]
+    Material material;              // Chunks drawing material (default material, tint applied as diffuse color)
+} VoxelMapState;
+
+// Voxel chunk meshing job, chunk voxels are copied so voxel map can be edited while job runs
+typedef struct VoxelChunkJob {
+    VoxelChunk *chunk;              // Destination chunk, mesh replaced on job finish
+    Vector3 origin;                 // Chunk origin (voxel map space, world units)
+    float voxelSize;                // Voxel size (world units)
+    Color palette[256];             // Voxels colors palette
+    unsigned char voxels[VOXELMAP_CHUNK_PADDED*VOXELMAP_CHUNK_PADDED*VOXELMAP_CHUNK_PADDED];  // Chunk voxels including neighbour voxels border
+    Mesh mesh;                      // Generated chunk mesh (worker thread)
+} VoxelChunkJob;
+
+// Terrain tile loading state
+typedef enum {
+    TERRAIN_TILE_UNLOADED = 0,      // Tile not loaded
+    TERRAIN_TILE_LOADING,           // Tile loading job in flight
+    TERRAIN_TILE_READY,             // Tile loaded, heights uploaded to GPU
+    TERRAIN_TILE_MISSING            // Tile failed to load, not reloaded
+} TerrainTileState;
+
+// Terrain tile, tile heightmap and LOD quadtree nodes height bounds
+typedef struct TerrainTile {
+    int state;                      // Tile loading state (TerrainTileState)
+    unsigned int jobId;             // Tile loading job id (streamed terrain)
+    unsigned int textureId;         // Tile heights texture id (32bit float)
+    int width;                      // Tile heightmap width (samples)
+    int height;                     // Tile heightmap height (samples)
+    float *heights;                 // Tile heights (width*height), [0..1] range
+    int levels;                     // Tile quadtree levels, level 0 nodes are TERRAIN_PATCH_SIZE samples wide
+    int levelOffsets[TERRAIN_MAX_LOD_LEVELS];   // Tile quadtree levels offsets into bounds array
+    float *bounds;                  // Tile quadtree nodes heights min and max, levels nodes by rows
+} TerrainTile;
+
+// Terrain internal state
+typedef struct TerrainState {
+    TerrainTile *tiles;             // Tiles array, indexed as tiles[z*tileCountX + x]
+    char *fileNameFormat;           // Tiles file name format (streamed terrain), NULL for single tile terrain
+
+    unsigned int shaderId;          // Terrain shader id (heights sampled in vertex shader)
+    int locs[8];                    // Terrain shader uniforms locations
+    unsigned int vaoId;             // LOD node grid vertex array id (VAO)
+    unsigned int vboId;             // LOD node grid vertex buffer id, grid positions [0..1]
+    unsigned int eboId;             // LOD node grid index buffer id
+} TerrainState;
+
+// Terrain tile loading job, tile data is set on job finish
+typedef struct TerrainTileJob {
+    TerrainTile *tile;              // Destination tile
+    TerrainTile data;               // Loaded tile data (worker thread)
+    char *fileName;                 // Tile file name (copied after job data)
+} TerrainTileJob;
+
+// Terrain drawing context, used by LOD nodes selection
+typedef struct TerrainDrawContext {
+    TerrainState *state;            // Terrain internal state
+    Vector3 viewPosition;           // Camera position (terrain space)
+    Vector4 planes[6];              // View frustum planes (terrain space)
+    Vector3 origin;                 // Current tile origin (terrain space)
+    Vector3 scale;                  // Current tile samples to world scale (heights scaled by y)
+    float ranges[TERRAIN_MAX_LOD_LEVELS];   // LOD levels ranges (world units)
+} TerrainDrawContext;
+
+// Mesh tangents generation data, shared by job ranges of triangles or vertices
+typedef struct MeshTangentsJob {
+    const Mesh *mesh;               // Mesh to compute tangents (tangents array is written)
+    int triangleCount;              // Mesh triangles count
+    Vector3 *faceTangents;          // Triangles tangent and bitangent directions (2 per triangle)
+    const int *vertexFaces;         // Vertices triangles lists (indexed meshes only)
+    const int *vertexFaceOffsets;   // Vertices triangles lists offsets (vertexCount + 1)
+} MeshTangentsJob;
+
+// Voxel quad, merged voxel faces with same palette index
+typedef struct VoxelQuad {
+    unsigned char face;             // Quad face direction: +X, -X, +Y, -Y, +Z, -Z
+    unsigned char slice;            // Quad slice along face normal axis (chunk voxels)
+    unsigned char u;                // Quad start along first face axis
+    unsigned char v;                // Quad start along second face axis
+    unsigned char width;            // Quad size along first face axis (voxels)
+    unsigned char height;           // Quad size along second face axis (voxels)
+    unsigned char voxel;            // Quad voxels palette index
+} VoxelQuad;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -169,6 +309,37 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, unsigned int
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
 
+static void MeshTangentsFacesWork(void *data, int start, int end);      // Mesh tangents job range work, compute triangles tangent directions
+static void MeshTangentsVerticesWork(void *data, int start, int end);   // Mesh tangents job range work, accumulate vertices tangents from triangles
+
+#if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_MESH_GENERATION)
+static void WeldMeshVertices(Mesh *mesh);                               // Weld unindexed mesh vertices with equal attributes, generates mesh indices
+#endif
+
+static int GetInstanceFormatSize(int format);                           // Get instance data size for instance format (bytes)
+static void UploadInstanceData(InstanceBuffer buffer, const void *data, int offset, int count);  // Upload instances data converted to buffer format
+
+static inline BoundingBox GetBoxTreeNodeBounds(const BoundsTreeNode *node);    // Get box tree node bounds
+static RayCollision CastBoxTreeRay(BoxTreeState *state, Ray ray, int *userId);  // Get closest box hit by ray
+
+static Mesh GenMeshVoxelChunk(const unsigned char *voxels, const Color *palette, Vector3 origin, float voxelSize);  // Generate voxel chunk mesh, greedy quads merging
+static void SetVoxelChunkDirty(VoxelMapState *state, int chunkX, int chunkY, int chunkZ);  // Set voxel map chunk to be remeshed
+static void QueueVoxelChunkJob(VoxelMap map, int chunkX, int chunkY, int chunkZ);  // Queue voxel map chunk meshing job
+static void VoxelChunkJobWork(void *data);                              // Voxel chunk meshing job work, generate chunk mesh (worker thread)
+static void VoxelChunkJobFinish(void *data);                            // Voxel chunk meshing job finish, upload chunk mesh (main thread)
+static bool LoadTerrainTileData(TerrainTile *tile, Image image);        // Load terrain tile heights and quadtree bounds from image
+static void UploadTerrainTile(TerrainTile *tile);                       // Upload terrain tile heights texture
+static void UnloadTerrainTile(TerrainTile *tile);                       // Unload terrain tile data (RAM and VRAM)
+static void LoadTerrainDrawing(TerrainState *state);                    // Load terrain shader and LOD node grid
+static void QueueTerrainTileJob(TerrainState *state, TerrainTile *tile, int tileX, int tileZ);  // Queue terrain tile loading job
+static void TerrainTileJobWork(void *data);                             // Terrain tile loading job work, load tile file (worker thread)
+static void TerrainTileJobFinish(void *data);                           // Terrain tile loading job finish, upload tile (main thread)
+#if defined(GRAPHICS_API_OPENGL_33)
+static bool SelectTerrainNode(TerrainDrawContext *context, TerrainTile *tile, int level, int x, int z);  // Select and draw terrain LOD nodes, returns false if node out of LOD range
+static bool GetTerrainNodeBox(TerrainDrawContext *context, TerrainTile *tile, int level, int x, int z, BoundingBox *box);  // Get terrain LOD node bounds
+static void DrawTerrainNode(TerrainDrawContext *context, int level, int x, int z);  // Draw terrain LOD node grid
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -1032,6 +1203,8 @@ void DrawGrid(int slices, float spacing)
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
 {
+    PROFILE_ZONE_BEGIN("LoadModel");
+
     Model model = { 0 };
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
@@ -1081,6 +1254,8 @@ Model LoadModel(const char *fileName)
         if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
     }
 
+    PROFILE_ZONE_END();
+
     return model;
 }
 
@@ -1532,12 +1707,55 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 }
 
 // Draw multiple mesh instances with material and different transforms
+// NOTE: Transforms are uploaded to a temporary buffer on every call,
+// use an InstanceBuffer (DrawMeshInstancedBuffer()) to keep instances data on GPU
 void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    // Create instances buffer, filled with instances transformations as float16 arrays
+    float16 *instanceTransforms = (float16 *)MemAllocFrame(instances*sizeof(float16));
+    if (instanceTransforms == NULL) return;
+
+    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+
+    InstanceBuffer buffer = { 0 };
+    buffer.id = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    buffer.format = INSTANCE_FORMAT_MATRIX;
+    buffer.capacity = instances;
+
+    MemFreeFrame(instanceTransforms);
+
+    DrawMeshInstancedBuffer(mesh, material, buffer, 0, instances);
+
+    // Remove instance transforms buffer
+    rlUnloadVertexBuffer(buffer.id);
+#endif
+}
+
+// Draw multiple mesh instances with material and instance buffer data
+// NOTE: Instances [first, first + count) are drawn, instance data is read by shader from attribute
+// location SHADER_LOC_MATRIX_MODEL, declared as matrix type depending on buffer format:
+// INSTANCE_FORMAT_MATRIX: mat4 (model matrix)
+// INSTANCE_FORMAT_MATRIX_3X4: mat3x4 (model matrix rows, world position: vec4(vertexPosition, 1.0)*instanceTransform)
+// INSTANCE_FORMAT_TRANSFORM: mat2x4 (translation + scale, rotation quaternion)
+void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int first, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.id == 0) || (first < 0) || (count <= 0)) return;
+    if ((first + count) > buffer.capacity) count = buffer.capacity - first;
+    if (count <= 0) return;
+
+    int instanceLocation = material.shader.locs[SHADER_LOC_MATRIX_MODEL];
+    int instanceAttributes = (buffer.format == INSTANCE_FORMAT_MATRIX)? 4 : ((buffer.format == INSTANCE_FORMAT_MATRIX_3X4)? 3 : 2);
+    int instanceSize = GetInstanceFormatSize(buffer.format);
+
+    if (instanceLocation == -1)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Instanced drawing shader does not provide instance transform attribute (SHADER_LOC_MATRIX_MODEL)");
+        return;
+    }
+
+    rlBeginGpuZone("DrawMeshInstanced");
 
     // Bind shader program
     rlEnableShader(material.shader.id);
@@ -1584,27 +1802,17 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
-
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
-
-    // Enable mesh VAO to attach new buffer
+    // Enable mesh VAO to attach instances buffer
     rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(buffer.id);
 
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData().
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
-
-    // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
-    for (unsigned int i = 0; i < 4; i++)
+    // Instances data is sent to shader attribute location: SHADER_LOC_MATRIX_MODEL (one vec4 per matrix column)
+    // NOTE: Attributes point to first instance to draw, so no base instance support is required
+    for (int i = 0; i < instanceAttributes; i++)
     {
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(i*sizeof(Vector4)));
-        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
+        rlEnableVertexAttribute(instanceLocation + i);
+        rlSetVertexAttribute(instanceLocation + i, 4, RL_FLOAT, 0, instanceSize, (void *)((size_t)first*instanceSize + i*sizeof(Vector4)));
+        rlSetVertexAttributeDivisor(instanceLocation + i, 1);
     }
 
     rlDisableVertexBuffer();
@@ -1718,8 +1926,8 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
-        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
+        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, count);
+        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, count);
     }
 
     // Unbind all bound texture maps
@@ -1738,6 +1946,13 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         }
     }
 
+    // Disable instances attributes, mesh vertex array could be drawn later without instancing
+    for (int i = 0; i < instanceAttributes; i++)
+    {
+        rlSetVertexAttributeDivisor(instanceLocation + i, 0);
+        rlDisableVertexAttribute(instanceLocation + i);
+    }
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1746,12 +1961,87 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     // Disable shader program
     rlDisableShader();
 
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+    rlEndGpuZone();
 #endif
 }
 
+// Load instance buffer for instanced drawing, instances data must be set with
+// UpdateInstanceBuffer() or StreamInstanceBuffer() before drawing
+InstanceBuffer LoadInstanceBuffer(int capacity, int format)
+{
+    InstanceBuffer buffer = { 0 };
+
+    int instanceSize = GetInstanceFormatSize(format);
+
+    if ((capacity <= 0) || (instanceSize == 0))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Failed to load instance buffer, invalid capacity or format");
+        return buffer;
+    }
+
+    buffer.id = rlLoadVertexBuffer(NULL, capacity*instanceSize, true);
+
+    if (buffer.id > 0)
+    {
+        buffer.format = format;
+        buffer.capacity = capacity;
+
+        TRACELOG(LOG_INFO, "MODEL: [ID %i] Instance buffer loaded successfully (%i instances, %i bytes per instance)", buffer.id, capacity, instanceSize);
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: Failed to load instance buffer");
+
+    return buffer;
+}
+
+// Unload instance buffer from GPU memory (VRAM)
+void UnloadInstanceBuffer(InstanceBuffer buffer)
+{
+    if (buffer.id > 0) rlUnloadVertexBuffer(buffer.id);
+}
+
+// Update instance buffer instances [offset, offset + count)
+// NOTE: Data must be a Matrix array (INSTANCE_FORMAT_MATRIX, INSTANCE_FORMAT_MATRIX_3X4)
+// or a Transform array (INSTANCE_FORMAT_TRANSFORM), only updated instances are uploaded
+void UpdateInstanceBuffer(InstanceBuffer buffer, const void *data, int offset, int count)
+{
+    if ((buffer.id == 0) || (data == NULL) || (count <= 0)) return;
+
+    if ((offset < 0) || ((offset + count) > buffer.capacity))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [ID %i] Instance buffer update out of bounds", buffer.id);
+        return;
+    }
+
+    UploadInstanceData(buffer, data, offset, count);
+}
+
+// Stream instances into instance buffer, returns first instance written (to be drawn)
+// NOTE: Instances are written after previously streamed instances, buffer data store is orphaned
+// once it is full, so instances streamed many times per frame never wait for pending draws
+int StreamInstanceBuffer(InstanceBuffer *buffer, const void *data, int count)
+{
+    if ((buffer == NULL) || (buffer->id == 0) || (data == NULL) || (count <= 0)) return 0;
+
+    if (count > buffer->capacity)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [ID %i] Instance buffer capacity exceeded, %i instances not streamed", buffer->id, count - buffer->capacity);
+        count = buffer->capacity;
+    }
+
+    if ((buffer->head + count) > buffer->capacity)
+    {
+        rlOrphanVertexBuffer(buffer->id, buffer->capacity*GetInstanceFormatSize(buffer->format));
+        buffer->head = 0;
+    }
+
+    int first = buffer->head;
+
+    UploadInstanceData(*buffer, data, first, count);
+    buffer->head += count;
+
+    return first;
+}
+
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
@@ -2004,8 +2294,41 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
+        if (model.bindPose == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation(): Model has no bind pose, animation can not be applied");
+            return;
+        }
+
+        PROFILE_ZONE_BEGIN("UpdateModelAnimation");
+
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
+        // NOTE: Only bones available in both model and animation are used
+        int boneCount = (model.boneCount < anim.boneCount)? model.boneCount : anim.boneCount;
+        if (boneCount < 0) boneCount = 0;
+
+        // Compute bones skinning transforms once for all meshes vertices:
+        // vertex is moved to bone bind space, scaled, rotated and moved to bone pose space
+        Matrix *boneMatrices = (Matrix *)RL_MALLOC(boneCount*sizeof(Matrix));
+        Matrix *bindMatrices = (Matrix *)RL_MALLOC(boneCount*sizeof(Matrix));
+        Quaternion *boneRotations = (Quaternion *)RL_MALLOC(boneCount*sizeof(Quaternion));
+
+        for (int b = 0; b < boneCount; b++)
+        {
+            Vector3 inTranslation = model.bindPose[b].translation;
+            Quaternion inRotation = model.bindPose[b].rotation;
+            Vector3 outTranslation = anim.framePoses[frame][b].translation;
+            Quaternion outRotation = anim.framePoses[frame][b].rotation;
+            Vector3 outScale = anim.framePoses[frame][b].scale;
+
+            boneRotations[b] = QuaternionMultiply(outRotation, QuaternionInvert(inRotation));
+            bindMatrices[b] = MatrixMultiply(MatrixTranslate(-inTranslation.x, -inTranslation.y, -inTranslation.z), MatrixScale(outScale.x, outScale.y, outScale.z));
+            boneMatrices[b] = MatrixMultiply(QuaternionToMatrix(boneRotations[b]), MatrixTranslate(outTranslation.x, outTranslation.y, outTranslation.z));
+        }
+
+        MatrixMultiplyArray(boneMatrices, bindMatrices, boneMatrices, boneCount);
+
         for (int m = 0; m < model.meshCount; m++)
         {
             Mesh mesh = model.meshes[m];
@@ -2020,14 +2343,6 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
             Vector3 animVertex = { 0 };
             Vector3 animNormal = { 0 };
 
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // Vector3 inScale = { 0 };
-
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
-
             int boneId = 0;
             int boneCounter = 0;
             float boneWeight = 0.0;
@@ -2055,22 +2370,12 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                     if (boneWeight == 0.0f) continue;
 
                     boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
+                    if (boneId >= boneCount) continue;
 
                     // Vertices processing
                     // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
                     animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
+                    animVertex = Vector3Transform(animVertex, boneMatrices[boneId]);
                     mesh.animVertices[vCounter] += animVertex.x*boneWeight;
                     mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
                     mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
@@ -2081,7 +2386,7 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                     if (mesh.normals != NULL)
                     {
                         animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
+                        animNormal = Vector3RotateByQuaternion(animNormal, boneRotations[boneId]);
                         mesh.animNormals[vCounter] += animNormal.x*boneWeight;
                         mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
                         mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
@@ -2097,6 +2402,12 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                 rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
             }
         }
+
+        RL_FREE(boneMatrices);
+        RL_FREE(bindMatrices);
+        RL_FREE(boneRotations);
+
+        PROFILE_ZONE_END();
     }
 }
 
@@ -2197,6 +2508,8 @@ Mesh GenMeshPoly(int sides, float radius)
     RL_FREE(normals);
     RL_FREE(texcoords);
 
+    WeldMeshVertices(&mesh);        // Weld triangles vertices into indexed mesh
+
     // Upload vertex data to GPU (static mesh)
     // NOTE: mesh.vboId array is allocated inside UploadMesh()
     UploadMesh(&mesh, false);
@@ -2329,6 +2642,8 @@ Mesh GenMeshPlane(float width, float length, int resX, int resZ)
     }
 
     par_shapes_free_mesh(plane);
+
+    WeldMeshVertices(&mesh);        // Weld triangles vertices into indexed mesh
 #endif
 
     // Upload vertex data to GPU (static mesh)
@@ -2494,6 +2809,8 @@ par_shapes_mesh* par_shapes_create_icosahedron();       // 20 sides polyhedron
     }
 
     par_shapes_free_mesh(cube);
+
+    WeldMeshVertices(&mesh);        // Weld triangles vertices into indexed mesh
 #endif
 
     // Upload vertex data to GPU (static mesh)
@@ -2536,6 +2853,8 @@ Mesh GenMeshSphere(float radius, int rings, int slices)
 
         par_shapes_free_mesh(sphere);
 
+        WeldMeshVertices(&mesh);    // Weld triangles vertices into indexed mesh
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2580,6 +2899,8 @@ Mesh GenMeshHemiSphere(float radius, int rings, int slices)
 
         par_shapes_free_mesh(sphere);
 
+        WeldMeshVertices(&mesh);    // Weld triangles vertices into indexed mesh
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2644,6 +2965,8 @@ Mesh GenMeshCylinder(float radius, float height, int slices)
 
         par_shapes_free_mesh(cylinder);
 
+        WeldMeshVertices(&mesh);    // Weld triangles vertices into indexed mesh
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2699,6 +3022,8 @@ Mesh GenMeshCone(float radius, float height, int slices)
 
         par_shapes_free_mesh(cone);
 
+        WeldMeshVertices(&mesh);    // Weld triangles vertices into indexed mesh
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2745,6 +3070,8 @@ Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
 
         par_shapes_free_mesh(torus);
 
+        WeldMeshVertices(&mesh);    // Weld triangles vertices into indexed mesh
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2789,6 +3116,8 @@ Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
 
         par_shapes_free_mesh(knot);
 
+        WeldMeshVertices(&mesh);    // Weld triangles vertices into indexed mesh
+
         // Upload vertex data to GPU (static mesh)
         UploadMesh(&mesh, false);
     }
@@ -2798,7 +3127,8 @@ Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
 }
 
 // Generate a mesh from heightmap
-// NOTE: Vertex data is uploaded to GPU
+// NOTE: Vertex data is uploaded to GPU, normals are smoothed from neighbour pixels heights,
+// heightmaps up to 65536 pixels are welded into an indexed mesh (one vertex per pixel)
 Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
 {
     #define GRAY_VALUE(c) ((float)(c.r + c.g + c.b)/3.0f)
@@ -2826,9 +3156,6 @@ Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
 
     Vector3 scaleFactor = { size.x/(mapX - 1), size.y/255.0f, size.z/(mapZ - 1) };
 
-    Vector3 vA = { 0 };
-    Vector3 vB = { 0 };
-    Vector3 vC = { 0 };
     Vector3 vN = { 0 };
 
     for (int z = 0; z < mapZ-1; z++)
@@ -2887,34 +3214,30 @@ Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
             tcCounter += 12;    // 6 texcoords, 12 floats
 
             // Fill normals array with data
+            // NOTE: Normals are smoothed from neighbour pixels heights, so vertices shared by triangles are equal
             //--------------------------------------------------------------
-            for (int i = 0; i < 18; i += 9)
-            {
-                vA.x = mesh.vertices[nCounter + i];
-                vA.y = mesh.vertices[nCounter + i + 1];
-                vA.z = mesh.vertices[nCounter + i + 2];
-
-                vB.x = mesh.vertices[nCounter + i + 3];
-                vB.y = mesh.vertices[nCounter + i + 4];
-                vB.z = mesh.vertices[nCounter + i + 5];
-
-                vC.x = mesh.vertices[nCounter + i + 6];
-                vC.y = mesh.vertices[nCounter + i + 7];
-                vC.z = mesh.vertices[nCounter + i + 8];
+            int corners[6][2] = { { x, z }, { x, z + 1 }, { x + 1, z }, { x + 1, z }, { x, z + 1 }, { x + 1, z + 1 } };
 
-                vN = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(vB, vA), Vector3Subtract(vC, vA)));
-
-                mesh.normals[nCounter + i] = vN.x;
-                mesh.normals[nCounter + i + 1] = vN.y;
-                mesh.normals[nCounter + i + 2] = vN.z;
-
-                mesh.normals[nCounter + i + 3] = vN.x;
-                mesh.normals[nCounter + i + 4] = vN.y;
-                mesh.normals[nCounter + i + 5] = vN.z;
-
-                mesh.normals[nCounter + i + 6] = vN.x;
-                mesh.normals[nCounter + i + 7] = vN.y;
-                mesh.normals[nCounter + i + 8] = vN.z;
+            for (int i = 0; i < 6; i++)
+            {
+                int cx = corners[i][0];
+                int cz = corners[i][1];
+                int x0 = (cx > 0)? cx - 1 : cx;
+                int x1 = (cx < mapX - 1)? cx + 1 : cx;
+                int z0 = (cz > 0)? cz - 1 : cz;
+                int z1 = (cz < mapZ - 1)? cz + 1 : cz;
+
+                // Normal from heightmap central differences: cross product of z and x tangents
+                float stepX = (x1 - x0)*scaleFactor.x;
+                float stepZ = (z1 - z0)*scaleFactor.z;
+                float diffX = (GRAY_VALUE(pixels[x1 + cz*mapX]) - GRAY_VALUE(pixels[x0 + cz*mapX]))*scaleFactor.y;
+                float diffZ = (GRAY_VALUE(pixels[cx + z1*mapX]) - GRAY_VALUE(pixels[cx + z0*mapX]))*scaleFactor.y;
+
+                vN = Vector3Normalize((Vector3){ -diffX*stepZ, stepX*stepZ, -diffZ*stepX });
+
+                mesh.normals[nCounter + i*3] = vN.x;
+                mesh.normals[nCounter + i*3 + 1] = vN.y;
+                mesh.normals[nCounter + i*3 + 2] = vN.z;
             }
 
             nCounter += 18;     // 6 vertex, 18 floats
@@ -2923,6 +3246,10 @@ Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
 
     UnloadImageColors(pixels);  // Unload pixels color data
 
+    // NOTE: Welded to one vertex per pixel, heightmaps over 65536 pixels can not be addressed
+    // with 16bit indices, so they are kept unindexed without trying to weld them
+    if ((mapX*mapZ) <= 65536) WeldMeshVertices(&mesh);
+
     // Upload vertex data to GPU (static mesh)
     UploadMesh(&mesh, false);
 
@@ -2950,9 +3277,14 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
     float h = cubeSize.z;
     float h2 = cubeSize.y;
 
-    Vector3 *mapVertices = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
-    Vector2 *mapTexcoords = (Vector2 *)RL_MALLOC(maxTriangles*3*sizeof(Vector2));
-    Vector3 *mapNormals = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
+    // NOTE: Vertex data is generated directly into mesh arrays, arrays are shrunk to generated vertex count
+    mesh.vertices = (float *)RL_MALLOC(maxTriangles*3*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(maxTriangles*3*2*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(maxTriangles*3*3*sizeof(float));
+
+    Vector3 *mapVertices = (Vector3 *)mesh.vertices;
+    Vector2 *mapTexcoords = (Vector2 *)mesh.texcoords;
+    Vector3 *mapNormals = (Vector3 *)mesh.normals;
 
     // Define the 6 normals of the cube, we will combine them accordingly later...
     Vector3 n1 = { 1.0f, 0.0f, 0.0f };
@@ -3224,53 +3556,19 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
         }
     }
 
-    // Move data from mapVertices temp arrays to vertices float array
     mesh.vertexCount = vCounter;
     mesh.triangleCount = vCounter/3;
 
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.colors = NULL;
-
-    int fCounter = 0;
-
-    // Move vertices data
-    for (int i = 0; i < vCounter; i++)
-    {
-        mesh.vertices[fCounter] = mapVertices[i].x;
-        mesh.vertices[fCounter + 1] = mapVertices[i].y;
-        mesh.vertices[fCounter + 2] = mapVertices[i].z;
-        fCounter += 3;
-    }
-
-    fCounter = 0;
-
-    // Move normals data
-    for (int i = 0; i < nCounter; i++)
-    {
-        mesh.normals[fCounter] = mapNormals[i].x;
-        mesh.normals[fCounter + 1] = mapNormals[i].y;
-        mesh.normals[fCounter + 2] = mapNormals[i].z;
-        fCounter += 3;
-    }
-
-    fCounter = 0;
-
-    // Move texcoords data
-    for (int i = 0; i < tcCounter; i++)
-    {
-        mesh.texcoords[fCounter] = mapTexcoords[i].x;
-        mesh.texcoords[fCounter + 1] = mapTexcoords[i].y;
-        fCounter += 2;
-    }
-
-    RL_FREE(mapVertices);
-    RL_FREE(mapNormals);
-    RL_FREE(mapTexcoords);
+    // Shrink vertex data arrays to generated vertex count
+    mesh.vertices = (float *)RL_REALLOC(mesh.vertices, mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_REALLOC(mesh.texcoords, mesh.vertexCount*2*sizeof(float));
+    mesh.normals = (float *)RL_REALLOC(mesh.normals, mesh.vertexCount*3*sizeof(float));
 
     UnloadImageColors(pixels);   // Unload pixels color data
 
+    // NOTE: Faces vertices are welded, vertices shared by faces of different cubes keep their own texcoords
+    WeldMeshVertices(&mesh);
+
     // Upload vertex data to GPU (static mesh)
     UploadMesh(&mesh, false);
 
@@ -3283,37 +3581,26 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
 BoundingBox GetMeshBoundingBox(Mesh mesh)
 {
     // Get min and max vertex to construct bounds (AABB)
-    Vector3 minVertex = { 0 };
-    Vector3 maxVertex = { 0 };
-
-    if (mesh.vertices != NULL)
-    {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-
-        for (int i = 1; i < mesh.vertexCount; i++)
-        {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-        }
-    }
-
-    // Create the bounding box
     BoundingBox box = { 0 };
-    box.min = minVertex;
-    box.max = maxVertex;
+
+    if (mesh.vertices != NULL) Vector3BoundsArray((const Vector3 *)mesh.vertices, mesh.vertexCount, &box.min, &box.max);
 
     return box;
 }
 
 // Compute mesh tangents
-// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
+// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions, normals and texture coordinates,
+// tangents of indexed meshes are accumulated from all triangles sharing each vertex
 // Implementation based on: https://answers.unity.com/questions/7789/calculating-tangents-vector4.html
+// NOTE: Big meshes are computed in parallel by job workers and calling thread, vertex tangents are accumulated
+// in triangles order so results do not depend on jobs split; define COMPUTE_TANGENTS_MIKKTSPACE to weight
+// triangles tangents by corner angles (MikkTSpace-like, vertices are not split)
+// WARNING: Tangents of meshes already uploaded to GPU are uploaded too, it must be called from main thread in that case
 void GenMeshTangents(Mesh *mesh)
 {
-    if ((mesh->vertices == NULL) || (mesh->texcoords == NULL))
+    if ((mesh->vertices == NULL) || (mesh->texcoords == NULL) || (mesh->normals == NULL))
     {
-        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires texcoord vertex attribute data");
+        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires normal and texcoord vertex attribute data");
         return;
     }
 
@@ -3324,73 +3611,39 @@ void GenMeshTangents(Mesh *mesh)
         mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
     }
 
-    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
-    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
-
-    for (int i = 0; i < mesh->vertexCount; i += 3)
-    {
-        // Get triangle vertices
-        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
-        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
-        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
-
-        // Get triangle texcoords
-        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
-        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
-        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
-
-        float x1 = v2.x - v1.x;
-        float y1 = v2.y - v1.y;
-        float z1 = v2.z - v1.z;
-        float x2 = v3.x - v1.x;
-        float y2 = v3.y - v1.y;
-        float z2 = v3.z - v1.z;
+    int triangleCount = (mesh->indices != NULL)? mesh->triangleCount : mesh->vertexCount/3;
 
-        float s1 = uv2.x - uv1.x;
-        float t1 = uv2.y - uv1.y;
-        float s2 = uv3.x - uv1.x;
-        float t2 = uv3.y - uv1.y;
+    MeshTangentsJob job = { 0 };
+    job.mesh = mesh;
+    job.triangleCount = triangleCount;
+    job.faceTangents = (Vector3 *)RL_MALLOC(triangleCount*2*sizeof(Vector3));
 
-        float div = s1*t2 - s2*t1;
-        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+    if (mesh->indices != NULL)
+    {
+        // Get vertices triangles lists, triangles are sorted in every list
+        int *vertexFaceOffsets = (int *)RL_CALLOC(mesh->vertexCount + 1, sizeof(int));
+        int *vertexFaces = (int *)RL_MALLOC(triangleCount*3*sizeof(int));
 
-        Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
-        Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+        for (int i = 0; i < triangleCount*3; i++) vertexFaceOffsets[mesh->indices[i] + 1]++;
+        for (int i = 0; i < mesh->vertexCount; i++) vertexFaceOffsets[i + 1] += vertexFaceOffsets[i];
 
-        tan1[i + 0] = sdir;
-        tan1[i + 1] = sdir;
-        tan1[i + 2] = sdir;
+        // NOTE: Offsets are used as insert positions, so they move to next list start and are shifted back
+        for (int i = 0; i < triangleCount*3; i++) vertexFaces[vertexFaceOffsets[mesh->indices[i]]++] = i/3;
+        for (int i = mesh->vertexCount; i > 0; i--) vertexFaceOffsets[i] = vertexFaceOffsets[i - 1];
+        vertexFaceOffsets[0] = 0;
 
-        tan2[i + 0] = tdir;
-        tan2[i + 1] = tdir;
-        tan2[i + 2] = tdir;
+        job.vertexFaces = vertexFaces;
+        job.vertexFaceOffsets = vertexFaceOffsets;
     }
 
-    // Compute tangents considering normals
-    for (int i = 0; i < mesh->vertexCount; i++)
-    {
-        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        Vector3 tangent = tan1[i];
-
-        // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
-#if defined(COMPUTE_TANGENTS_METHOD_01)
-        Vector3 tmp = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
-        tmp = Vector3Normalize(tmp);
-        mesh->tangents[i*4 + 0] = tmp.x;
-        mesh->tangents[i*4 + 1] = tmp.y;
-        mesh->tangents[i*4 + 2] = tmp.z;
-        mesh->tangents[i*4 + 3] = 1.0f;
-#else
-        Vector3OrthoNormalize(&normal, &tangent);
-        mesh->tangents[i*4 + 0] = tangent.x;
-        mesh->tangents[i*4 + 1] = tangent.y;
-        mesh->tangents[i*4 + 2] = tangent.z;
-        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
-#endif
-    }
+    // Compute triangles tangent directions and accumulate them into vertex tangents
+    // NOTE: Calling thread runs ranges too, it never waits for queued jobs to start
+    RunJobRanges(MeshTangentsFacesWork, &job, triangleCount, MESH_TANGENTS_JOB_SIZE, MESH_TANGENTS_MAX_JOBS);
+    RunJobRanges(MeshTangentsVerticesWork, &job, mesh->vertexCount, MESH_TANGENTS_JOB_SIZE, MESH_TANGENTS_MAX_JOBS);
 
-    RL_FREE(tan1);
-    RL_FREE(tan2);
+    RL_FREE(job.faceTangents);
+    RL_FREE((int *)job.vertexFaces);
+    RL_FREE((int *)job.vertexFaceOffsets);
 
     if (mesh->vboId != NULL)
     {
@@ -3870,2091 +4123,3642 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 }
 
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Functions Definition - Box tree (dynamic bounding volume hierarchy)
 //----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+
+// Load box tree for boxes overlap and ray queries
+// NOTE: Boxes are stored enlarged by margin, boxes moving inside their margin do not update tree
+BoxTree LoadBoxTree(float margin)
 {
-    for (int i = 0; i < boneCount; i++)
+    BoxTree tree = { 0 };
+
+    BoxTreeState *state = (BoxTreeState *)RL_CALLOC(1, sizeof(BoxTreeState));
+    state->margin = (margin > 0.0f)? margin : 0.0f;
+    state->freeBox = -1;
+    state->tree = LoadBoundsTree(3);
+
+    tree.margin = state->margin;
+    tree.state = state;
+
+    return tree;
+}
+
+// Unload box tree
+void UnloadBoxTree(BoxTree tree)
+{
+    BoxTreeState *state = (BoxTreeState *)tree.state;
+
+    if (state != NULL)
     {
-        if (bones[i].parent >= 0)
+        RL_FREE(state->boxes);
+        UnloadBoundsTree(&state->tree);
+        RL_FREE(state);
+    }
+}
+
+// Add box to tree, returns box id (-1 on failure)
+// NOTE: userId is reported in queries, usually an index into user models array
+int AddBoxTreeBox(BoxTree tree, BoundingBox box, int userId)
+{
+    BoxTreeState *state = (BoxTreeState *)tree.state;
+    if (state == NULL) return -1;
+
+    int id = state->freeBox;
+
+    if (id != -1) state->freeBox = state->boxes[id].node;
+    else
+    {
+        if (state->boxCount == state->boxCapacity)
         {
-            if (bones[i].parent > i)
+            int capacity = (state->boxCapacity > 0)? state->boxCapacity*2 : 64;
+            BoxTreeBox *boxes = (BoxTreeBox *)RL_REALLOC(state->boxes, capacity*sizeof(BoxTreeBox));
+
+            if (boxes == NULL)
             {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
+                TRACELOG(LOG_WARNING, "MODEL: Failed to grow box tree boxes");
+                return -1;
             }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+
+            state->boxes = boxes;
+            state->boxCapacity = capacity;
         }
+
+        id = state->boxCount++;
+    }
+
+    float min[3] = { box.min.x - state->margin, box.min.y - state->margin, box.min.z - state->margin };
+    float max[3] = { box.max.x + state->margin, box.max.y + state->margin, box.max.z + state->margin };
+    int leaf = AddBoundsTreeLeaf(&state->tree, min, max, id);
+
+    // Tree nodes could not be allocated, box is removed
+    if (leaf == -1)
+    {
+        state->boxes[id].node = state->freeBox;
+        state->boxes[id].active = false;
+        state->freeBox = id;
+        return -1;
     }
+
+    state->boxes[id].bounds = box;
+    state->boxes[id].userId = userId;
+    state->boxes[id].node = leaf;
+    state->boxes[id].active = true;
+
+    return id;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-// Load OBJ mesh data
-//
-// Keep the following information in mind when reading this
-//  - A mesh is created for every material present in the obj file
-//  - the model.meshCount is therefore the materialCount returned from tinyobj
-//  - the mesh is automatically triangulated by tinyobj
-static Model LoadOBJ(const char *fileName)
+// Update box bounds, tree is only refit if box leaves its enlarged bounds
+void UpdateBoxTreeBox(BoxTree tree, int boxId, BoundingBox box)
 {
-    Model model = { 0 };
+    BoxTreeState *state = (BoxTreeState *)tree.state;
+    if ((state == NULL) || (boxId < 0) || (boxId >= state->boxCount) || !state->boxes[boxId].active) return;
 
-    tinyobj_attrib_t attrib = { 0 };
-    tinyobj_shape_t *meshes = NULL;
-    unsigned int meshCount = 0;
+    state->boxes[boxId].bounds = box;
 
-    tinyobj_material_t *materials = NULL;
-    unsigned int materialCount = 0;
+    int leaf = state->boxes[boxId].node;
+    BoundingBox bounds = GetBoxTreeNodeBounds(&state->tree.nodes[leaf]);
 
-    char *fileText = LoadFileText(fileName);
+    if ((box.min.x >= bounds.min.x) && (box.min.y >= bounds.min.y) && (box.min.z >= bounds.min.z) &&
+        (box.max.x <= bounds.max.x) && (box.max.y <= bounds.max.y) && (box.max.z <= bounds.max.z)) return;
 
-    if (fileText != NULL)
-    {
-        unsigned int dataSize = (unsigned int)strlen(fileText);
-        char currentDir[1024] = { 0 };
-        strcpy(currentDir, GetWorkingDirectory());
-        const char *workingDir = GetDirectoryPath(fileName);
-        if (CHDIR(workingDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
-        }
+    float min[3] = { box.min.x - state->margin, box.min.y - state->margin, box.min.z - state->margin };
+    float max[3] = { box.max.x + state->margin, box.max.y + state->margin, box.max.z + state->margin };
 
-        unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
+    MoveBoundsTreeLeaf(&state->tree, leaf, min, max);
+}
 
-        if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
-        else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
+// Remove box from tree, box id can be reused by next added box
+void RemoveBoxTreeBox(BoxTree tree, int boxId)
+{
+    BoxTreeState *state = (BoxTreeState *)tree.state;
+    if ((state == NULL) || (boxId < 0) || (boxId >= state->boxCount) || !state->boxes[boxId].active) return;
 
-        model.meshCount = materialCount;
+    RemoveBoundsTreeLeaf(&state->tree, state->boxes[boxId].node);
 
-        // Init model materials array
-        if (materialCount > 0)
+    state->boxes[boxId].active = false;
+    state->boxes[boxId].node = state->freeBox;
+    state->freeBox = boxId;
+}
+
+// Get boxes overlapping a box, returns boxes count (up to maxCount user ids registered)
+// NOTE: Overlap is checked as CheckCollisionBoxes()
+int GetBoxTreeBoxes(BoxTree tree, BoundingBox box, int *userIds, int maxCount)
+{
+    BoxTreeState *state = (BoxTreeState *)tree.state;
+    if ((state == NULL) || (state->tree.root == -1)) return 0;
+
+    int count = 0;
+    int *stack = state->tree.stack;
+    int stackSize = 0;
+    stack[stackSize++] = state->tree.root;
+
+    while (stackSize > 0)
+    {
+        BoundsTreeNode *node = &state->tree.nodes[stack[--stackSize]];
+
+        if (!CheckCollisionBoxes(GetBoxTreeNodeBounds(node), box)) continue;
+
+        if (node->child1 == -1)
         {
-            model.materialCount = materialCount;
-            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", materialCount);
+            if (CheckCollisionBoxes(state->boxes[node->item].bounds, box))
+            {
+                if (count < maxCount) userIds[count] = state->boxes[node->item].userId;
+                count++;
+            }
         }
         else
         {
-            model.meshCount = 1;
-            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
+            stack[stackSize++] = node->child1;
+            stack[stackSize++] = node->child2;
         }
+    }
 
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    return count;
+}
 
-        // Count the faces for each material
-        int *matFaces = RL_CALLOC(model.meshCount, sizeof(int));
+// Get boxes overlapping a sphere, returns boxes count (up to maxCount user ids registered)
+int GetBoxTreeBoxesSphere(BoxTree tree, Vector3 center, float radius, int *userIds, int maxCount)
+{
+    BoxTreeState *state = (BoxTreeState *)tree.state;
+    if ((state == NULL) || (state->tree.root == -1)) return 0;
 
-        // if no materials are present use all faces on one mesh
-        if (materialCount > 0)
+    int count = 0;
+    int *stack = state->tree.stack;
+    int stackSize = 0;
+    stack[stackSize++] = state->tree.root;
+
+    while (stackSize > 0)
+    {
+        BoundsTreeNode *node = &state->tree.nodes[stack[--stackSize]];
+
+        if (!CheckCollisionBoxSphere(GetBoxTreeNodeBounds(node), center, radius)) continue;
+
+        if (node->child1 == -1)
         {
-            for (unsigned int fi = 0; fi < attrib.num_faces; fi++)
+            if (CheckCollisionBoxSphere(state->boxes[node->item].bounds, center, radius))
             {
-                //tinyobj_vertex_index_t face = attrib.faces[fi];
-                int idx = attrib.material_ids[fi];
-                matFaces[idx]++;
+                if (count < maxCount) userIds[count] = state->boxes[node->item].userId;
+                count++;
             }
-
         }
         else
         {
-            matFaces[0] = attrib.num_faces;
+            stack[stackSize++] = node->child1;
+            stack[stackSize++] = node->child2;
         }
+    }
 
-        //--------------------------------------
-        // Create the material meshes
+    return count;
+}
 
-        // Running counts/indexes for each material mesh as we are
-        // building them at the same time
-        int *vCount = RL_CALLOC(model.meshCount, sizeof(int));
-        int *vtCount = RL_CALLOC(model.meshCount, sizeof(int));
-        int *vnCount = RL_CALLOC(model.meshCount, sizeof(int));
-        int *faceCount = RL_CALLOC(model.meshCount, sizeof(int));
+// Get collision info between ray and closest tree box, hit box user id is returned by reference (optional)
+// NOTE: Collision info matches GetRayCollisionBox() for the hit box
+RayCollision GetRayCollisionBoxTree(BoxTree tree, Ray ray, int *userId)
+{
+    RayCollision collision = { 0 };
+    BoxTreeState *state = (BoxTreeState *)tree.state;
 
-        // Allocate space for each of the material meshes
-        for (int mi = 0; mi < model.meshCount; mi++)
-        {
-            model.meshes[mi].vertexCount = matFaces[mi]*3;
-            model.meshes[mi].triangleCount = matFaces[mi];
-            model.meshes[mi].vertices = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
-            model.meshes[mi].texcoords = (float *)RL_CALLOC(model.meshes[mi].vertexCount*2, sizeof(float));
-            model.meshes[mi].normals = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
-            model.meshMaterial[mi] = mi;
-        }
+    if (userId != NULL) *userId = -1;
+    if (state != NULL) collision = CastBoxTreeRay(state, ray, userId);
 
-        // Scan through the combined sub meshes and pick out each material mesh
-        for (unsigned int af = 0; af < attrib.num_faces; af++)
-        {
-            int mm = attrib.material_ids[af];   // mesh material for this face
-            if (mm == -1) { mm = 0; }           // no material object..
+    return collision;
+}
 
-            // Get indices for the face
-            tinyobj_vertex_index_t idx0 = attrib.faces[3*af + 0];
-            tinyobj_vertex_index_t idx1 = attrib.faces[3*af + 1];
-            tinyobj_vertex_index_t idx2 = attrib.faces[3*af + 2];
+// Get collision info between rays and closest tree boxes, hit boxes user ids are returned by reference (optional)
+// NOTE: collisions array (and userIds array if provided) must hold rayCount elements, returns hitting rays count
+int GetRayCollisionBoxTreeArray(BoxTree tree, const Ray *rays, int rayCount, RayCollision *collisions, int *userIds)
+{
+    BoxTreeState *state = (BoxTreeState *)tree.state;
+    int hitCount = 0;
 
-            // Fill vertices buffer (float) using vertex index of the face
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx0.v_idx*3 + v]; } vCount[mm] +=3;
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx1.v_idx*3 + v]; } vCount[mm] +=3;
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx2.v_idx*3 + v]; } vCount[mm] +=3;
+    for (int i = 0; i < rayCount; i++)
+    {
+        if (userIds != NULL) userIds[i] = -1;
 
-            if (attrib.num_texcoords > 0)
-            {
-                // Fill texcoords buffer (float) using vertex index of the face
-                // NOTE: Y-coordinate must be flipped upside-down to account for
-                // raylib's upside down textures...
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx0.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx0.vt_idx*2 + 1]; vtCount[mm] += 2;
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx1.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx1.vt_idx*2 + 1]; vtCount[mm] += 2;
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx2.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx2.vt_idx*2 + 1]; vtCount[mm] += 2;
-            }
+        if (state != NULL) collisions[i] = CastBoxTreeRay(state, rays[i], (userIds != NULL)? &userIds[i] : NULL);
+        else collisions[i] = (RayCollision){ 0 };
 
-            if (attrib.num_normals > 0)
-            {
-                // Fill normals buffer (float) using vertex index of the face
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx0.vn_idx*3 + v]; } vnCount[mm] +=3;
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx1.vn_idx*3 + v]; } vnCount[mm] +=3;
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx2.vn_idx*3 + v]; } vnCount[mm] +=3;
-            }
-        }
+        if (collisions[i].hit) hitCount++;
+    }
 
-        // Init model materials
-        ProcessMaterialsOBJ(model.materials, materials, materialCount);
+    return hitCount;
+}
 
-        tinyobj_attrib_free(&attrib);
-        tinyobj_shapes_free(meshes, meshCount);
-        tinyobj_materials_free(materials, materialCount);
+//------------------------------------------------------------------------------------
+// Voxel map functions
+//------------------------------------------------------------------------------------
+// Load voxel map, all voxels empty and palette colors initialized to white
+VoxelMap LoadVoxelMap(int width, int height, int length, float voxelSize)
+{
+    VoxelMap map = { 0 };
 
-        UnloadFileText(fileText);
+    if ((width <= 0) || (height <= 0) || (length <= 0) || (voxelSize <= 0.0f))
+    {
+        TRACELOG(LOG_WARNING, "VOXEL: Failed to load voxel map, invalid map or voxel size");
+        return map;
+    }
 
-        RL_FREE(matFaces);
-        RL_FREE(vCount);
-        RL_FREE(vtCount);
-        RL_FREE(vnCount);
-        RL_FREE(faceCount);
+    VoxelMapState *state = (VoxelMapState *)RL_CALLOC(1, sizeof(VoxelMapState));
+    unsigned char *voxels = (unsigned char *)RL_CALLOC(width*height*length, sizeof(unsigned char));
+    Color *palette = (Color *)RL_MALLOC(256*sizeof(Color));
 
-        if (CHDIR(currentDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
-        }
+    if ((state != NULL) && (voxels != NULL) && (palette != NULL))
+    {
+        state->chunkCountX = (width + VOXELMAP_CHUNK_SIZE - 1)/VOXELMAP_CHUNK_SIZE;
+        state->chunkCountY = (height + VOXELMAP_CHUNK_SIZE - 1)/VOXELMAP_CHUNK_SIZE;
+        state->chunkCountZ = (length + VOXELMAP_CHUNK_SIZE - 1)/VOXELMAP_CHUNK_SIZE;
+        state->chunks = (VoxelChunk *)RL_CALLOC(state->chunkCountX*state->chunkCountY*state->chunkCountZ, sizeof(VoxelChunk));
     }
 
-    return model;
+    if ((state == NULL) || (voxels == NULL) || (palette == NULL) || (state->chunks == NULL))
+    {
+        if (state != NULL) RL_FREE(state->chunks);
+        RL_FREE(state);
+        RL_FREE(voxels);
+        RL_FREE(palette);
+
+        TRACELOG(LOG_WARNING, "VOXEL: Failed to allocate voxel map");
+        return map;
+    }
+
+    for (int i = 0; i < 256; i++) palette[i] = WHITE;
+
+    state->material = LoadMaterialDefault();
+
+    map.width = width;
+    map.height = height;
+    map.length = length;
+    map.voxelSize = voxelSize;
+    map.voxels = voxels;
+    map.palette = palette;
+    map.state = state;
+
+    TRACELOG(LOG_INFO, "VOXEL: Voxel map loaded successfully (%i x %i x %i voxels, %i chunks)", width, height, length, state->chunkCountX*state->chunkCountY*state->chunkCountZ);
+
+    return map;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_IQM)
-// Load IQM mesh data
-static Model LoadIQM(const char *fileName)
+// Unload voxel map voxels and chunks meshes
+// NOTE: Chunks meshing jobs in flight are waited for
+void UnloadVoxelMap(VoxelMap map)
 {
-    #define IQM_MAGIC     "INTERQUAKEMODEL" // IQM file magic number
-    #define IQM_VERSION          2          // only IQM version 2 supported
+    VoxelMapState *state = (VoxelMapState *)map.state;
 
-    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
-    #define MESH_NAME_LENGTH    32          // Mesh name string length
-    #define MATERIAL_NAME_LENGTH 32         // Material name string length
+    if (state != NULL)
+    {
+        for (int i = 0; i < state->chunkCountX*state->chunkCountY*state->chunkCountZ; i++)
+        {
+            if (state->chunks[i].pending) WaitJob(state->chunks[i].jobId);
+            if (state->chunks[i].mesh.vertexCount > 0) UnloadMesh(state->chunks[i].mesh);
+        }
 
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
-    unsigned char *fileDataPtr = fileData;
+        UnloadMaterial(state->material);
 
-    // IQM file structs
-    //-----------------------------------------------------------------------------------
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int filesize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+        RL_FREE(state->chunks);
+        RL_FREE(state);
+    }
 
-    typedef struct IQMMesh {
-        unsigned int name;
-        unsigned int material;
-        unsigned int first_vertex, num_vertexes;
-        unsigned int first_triangle, num_triangles;
-    } IQMMesh;
+    RL_FREE(map.voxels);
+    RL_FREE(map.palette);
+}
 
-    typedef struct IQMTriangle {
-        unsigned int vertex[3];
-    } IQMTriangle;
+// Set voxel map voxel (palette index, 0 for empty voxel)
+// NOTE: Voxel chunk is marked to be remeshed, neighbour chunks too if voxel lies on chunk border
+void SetVoxelMapVoxel(VoxelMap map, int x, int y, int z, unsigned char voxel)
+{
+    VoxelMapState *state = (VoxelMapState *)map.state;
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+    if ((state == NULL) || (x < 0) || (y < 0) || (z < 0) || (x >= map.width) || (y >= map.height) || (z >= map.length)) return;
 
-    typedef struct IQMVertexArray {
-        unsigned int type;
-        unsigned int flags;
-        unsigned int format;
-        unsigned int size;
-        unsigned int offset;
-    } IQMVertexArray;
+    int index = (z*map.height + y)*map.width + x;
+    if (map.voxels[index] == voxel) return;
 
-    // NOTE: Below IQM structures are not used but listed for reference
-    /*
-    typedef struct IQMAdjacency {
-        unsigned int triangle[3];
-    } IQMAdjacency;
+    map.voxels[index] = voxel;
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+    int chunkX = x/VOXELMAP_CHUNK_SIZE;
+    int chunkY = y/VOXELMAP_CHUNK_SIZE;
+    int chunkZ = z/VOXELMAP_CHUNK_SIZE;
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+    SetVoxelChunkDirty(state, chunkX, chunkY, chunkZ);
 
-    typedef struct IQMBounds {
-        float bbmin[3], bbmax[3];
-        float xyradius, radius;
-    } IQMBounds;
-    */
-    //-----------------------------------------------------------------------------------
+    // Neighbour chunks faces culling depends on border voxels
+    if (x%VOXELMAP_CHUNK_SIZE == 0) SetVoxelChunkDirty(state, chunkX - 1, chunkY, chunkZ);
+    if (x%VOXELMAP_CHUNK_SIZE == VOXELMAP_CHUNK_SIZE - 1) SetVoxelChunkDirty(state, chunkX + 1, chunkY, chunkZ);
+    if (y%VOXELMAP_CHUNK_SIZE == 0) SetVoxelChunkDirty(state, chunkX, chunkY - 1, chunkZ);
+    if (y%VOXELMAP_CHUNK_SIZE == VOXELMAP_CHUNK_SIZE - 1) SetVoxelChunkDirty(state, chunkX, chunkY + 1, chunkZ);
+    if (z%VOXELMAP_CHUNK_SIZE == 0) SetVoxelChunkDirty(state, chunkX, chunkY, chunkZ - 1);
+    if (z%VOXELMAP_CHUNK_SIZE == VOXELMAP_CHUNK_SIZE - 1) SetVoxelChunkDirty(state, chunkX, chunkY, chunkZ + 1);
+}
 
-    // IQM vertex data types
-    enum {
-        IQM_POSITION     = 0,
-        IQM_TEXCOORD     = 1,
-        IQM_NORMAL       = 2,
-        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
-        IQM_BLENDINDEXES = 4,
-        IQM_BLENDWEIGHTS = 5,
-        IQM_COLOR        = 6,
-        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
-    };
+// Get voxel map voxel (palette index, 0 for empty or out of bounds voxel)
+unsigned char GetVoxelMapVoxel(VoxelMap map, int x, int y, int z)
+{
+    if ((map.voxels == NULL) || (x < 0) || (y < 0) || (z < 0) || (x >= map.width) || (y >= map.height) || (z >= map.length)) return 0;
 
-    Model model = { 0 };
+    return map.voxels[(z*map.height + y)*map.width + x];
+}
 
-    IQMMesh *imesh = NULL;
-    IQMTriangle *tri = NULL;
-    IQMVertexArray *va = NULL;
-    IQMJoint *ijoint = NULL;
+// Draw voxel map chunks, changed chunks are remeshed asynchronously
+// NOTE: Changed chunks meshing jobs are queued on draw (up to VOXELMAP_MAX_CHUNK_JOBS per call), chunks keep
+// drawing their previous mesh until job finishes (EndDrawing()), palette changes only apply to remeshed chunks
+void DrawVoxelMap(VoxelMap map, Vector3 position, Color tint)
+{
+    VoxelMapState *state = (VoxelMapState *)map.state;
+    if (state == NULL) return;
 
-    float *vertex = NULL;
-    float *normal = NULL;
-    float *text = NULL;
-    char *blendi = NULL;
-    unsigned char *blendw = NULL;
-    unsigned char *color = NULL;
+    int jobCount = 0;
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return model;
+    for (int z = 0; (z < state->chunkCountZ) && (jobCount < VOXELMAP_MAX_CHUNK_JOBS); z++)
+    {
+        for (int y = 0; (y < state->chunkCountY) && (jobCount < VOXELMAP_MAX_CHUNK_JOBS); y++)
+        {
+            for (int x = 0; (x < state->chunkCountX) && (jobCount < VOXELMAP_MAX_CHUNK_JOBS); x++)
+            {
+                VoxelChunk *chunk = &state->chunks[(z*state->chunkCountY + y)*state->chunkCountX + x];
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+                if (chunk->dirty && !chunk->pending)
+                {
+                    QueueVoxelChunkJob(map, x, y, z);
+                    jobCount++;
+                }
+            }
+        }
+    }
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    state->material.maps[MATERIAL_MAP_DIFFUSE].color = tint;
+    Matrix transform = MatrixTranslate(position.x, position.y, position.z);
+
+    for (int i = 0; i < state->chunkCountX*state->chunkCountY*state->chunkCountZ; i++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        return model;
+        if (state->chunks[i].mesh.vertexCount > 0) DrawMesh(state->chunks[i].mesh, state->material, transform);
     }
+}
 
-    if (iqmHeader->version != IQM_VERSION)
+//------------------------------------------------------------------------------------
+// Terrain functions
+//------------------------------------------------------------------------------------
+// Load terrain from heightmap image (single tile), heights are image grayscale values scaled by size.y
+// NOTE: Terrain is drawn with chunked LOD, heights are sampled in vertex shader (requires OpenGL 3.3)
+Terrain LoadTerrain(Image heightmap, Vector3 size)
+{
+    Terrain terrain = { 0 };
+
+    TerrainState *state = (TerrainState *)RL_CALLOC(1, sizeof(TerrainState));
+    if (state == NULL) return terrain;
+
+    state->tiles = (TerrainTile *)RL_CALLOC(1, sizeof(TerrainTile));
+
+    Image image = ImageCopy(heightmap);
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R32);
+
+    if ((state->tiles == NULL) || !LoadTerrainTileData(&state->tiles[0], image))
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        return model;
+        UnloadImage(image);
+        RL_FREE(state->tiles);
+        RL_FREE(state);
+
+        TRACELOG(LOG_WARNING, "TERRAIN: Failed to load terrain heightmap");
+        return terrain;
     }
 
-    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
+    LoadTerrainDrawing(state);
+    UploadTerrainTile(&state->tiles[0]);
 
-    // Meshes data processing
-    imesh = RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
-    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
-    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
-    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
+    terrain.tileSize = size;
+    terrain.tileCountX = 1;
+    terrain.tileCountZ = 1;
+    terrain.state = state;
 
-    model.meshCount = iqmHeader->num_meshes;
-    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+    TRACELOG(LOG_INFO, "TERRAIN: Terrain loaded successfully (%i x %i samples, %i LOD levels)", state->tiles[0].width, state->tiles[0].height, state->tiles[0].levels);
 
-    model.materialCount = model.meshCount;
-    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    return terrain;
+}
 
-    char name[MESH_NAME_LENGTH] = { 0 };
-    char material[MATERIAL_NAME_LENGTH] = { 0 };
+// Load terrain streamed from heightmap tiles files, tiles are loaded when camera gets closer than stream distance
+// NOTE: File name format must include tile x and z indices, i.e. "terrain/tile_%i_%i.png",
+// neighbour tiles must share border samples and all tiles must have same size to avoid seams
+// NOTE: Tiles files are read on job worker threads, a custom LoadFileData callback must be thread-safe
+Terrain LoadTerrainTiles(const char *fileNameFormat, int tileCountX, int tileCountZ, Vector3 tileSize)
+{
+    Terrain terrain = { 0 };
 
-    for (int i = 0; i < model.meshCount; i++)
+    if ((fileNameFormat == NULL) || (tileCountX <= 0) || (tileCountZ <= 0))
     {
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].name, SEEK_SET);
-        //fread(name, sizeof(char), MESH_NAME_LENGTH, iqmFile);
-        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
+        TRACELOG(LOG_WARNING, "TERRAIN: Failed to load terrain tiles, invalid tiles count");
+        return terrain;
+    }
 
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].material, SEEK_SET);
-        //fread(material, sizeof(char), MATERIAL_NAME_LENGTH, iqmFile);
-        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
+    TerrainState *state = (TerrainState *)RL_CALLOC(1, sizeof(TerrainState));
+    if (state == NULL) return terrain;
 
-        model.materials[i] = LoadMaterialDefault();
+    int formatSize = (int)strlen(fileNameFormat) + 1;
 
-        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
+    state->tiles = (TerrainTile *)RL_CALLOC(tileCountX*tileCountZ, sizeof(TerrainTile));
+    state->fileNameFormat = (char *)RL_MALLOC(formatSize);
 
-        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+    if ((state->tiles == NULL) || (state->fileNameFormat == NULL))
+    {
+        RL_FREE(state->tiles);
+        RL_FREE(state->fileNameFormat);
+        RL_FREE(state);
 
-        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
-        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
-        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+        TRACELOG(LOG_WARNING, "TERRAIN: Failed to allocate terrain tiles");
+        return terrain;
+    }
 
-        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
-        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
+    memcpy(state->fileNameFormat, fileNameFormat, formatSize);
 
-        model.meshes[i].triangleCount = imesh[i].num_triangles;
-        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+    LoadTerrainDrawing(state);
 
-        // Animated verted data, what we actually process for rendering
-        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
-        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
-        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
-    }
+    terrain.tileSize = tileSize;
+    terrain.tileCountX = tileCountX;
+    terrain.tileCountZ = tileCountZ;
+    terrain.streamDistance = 2.0f*fmaxf(tileSize.x, tileSize.z);
+    terrain.state = state;
 
-    // Triangles data processing
-    tri = RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
-    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
-    //fread(tri, sizeof(IQMTriangle), iqmHeader->num_triangles, iqmFile);
-    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
+    TRACELOG(LOG_INFO, "TERRAIN: Terrain tiles loaded successfully (%i x %i tiles, streamed)", tileCountX, tileCountZ);
 
-    for (int m = 0; m < model.meshCount; m++)
-    {
-        int tcounter = 0;
+    return terrain;
+}
 
-        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
-        {
-            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
-            // expecting they point to the counter-clockwise vertex triangle, so we need to reverse triangle indexes
-            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
-            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
-            tcounter += 3;
-        }
+// Unload terrain tiles from memory (RAM and VRAM)
+// NOTE: Tiles loading jobs in flight are waited for
+void UnloadTerrain(Terrain terrain)
+{
+    TerrainState *state = (TerrainState *)terrain.state;
+    if (state == NULL) return;
+
+    for (int i = 0; i < terrain.tileCountX*terrain.tileCountZ; i++)
+    {
+        if (state->tiles[i].state == TERRAIN_TILE_LOADING) WaitJob(state->tiles[i].jobId);
+        UnloadTerrainTile(&state->tiles[i]);
     }
 
-    // Vertex arrays data processing
-    va = RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
-    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
-    //fread(va, sizeof(IQMVertexArray), iqmHeader->num_vertexarrays, iqmFile);
-    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+    if (state->vaoId > 0) rlUnloadVertexArray(state->vaoId);
+    if (state->vboId > 0) rlUnloadVertexBuffer(state->vboId);
+    if (state->eboId > 0) rlUnloadVertexBuffer(state->eboId);
+    if (state->shaderId > 0) rlUnloadShaderProgram(state->shaderId);
 
-    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
+    RL_FREE(state->tiles);
+    RL_FREE(state->fileNameFormat);
+    RL_FREE(state);
+}
+
+// Draw terrain visible chunks with LOD, tiles are streamed around camera
+// NOTE: Terrain LOD nodes are selected by camera distance (CDLOD), nodes grid vertices morph into
+// next LOD level grid approaching LOD range limit to avoid cracks, nodes are culled against view frustum
+void DrawTerrain(Terrain terrain, Camera camera, Vector3 position, Color tint)
+{
+    TerrainState *state = (TerrainState *)terrain.state;
+    if (state == NULL) return;
+
+    Vector3 viewPosition = Vector3Subtract(camera.position, position);
+
+    // Stream tiles around camera, tiles unload distance is larger to avoid reloading tiles on stream distance limit
+    if ((state->fileNameFormat != NULL) && (terrain.streamDistance > 0.0f))
     {
-        switch (va[i].type)
+        for (int z = 0; z < terrain.tileCountZ; z++)
         {
-            case IQM_POSITION:
+            for (int x = 0; x < terrain.tileCountX; x++)
             {
-                vertex = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+                TerrainTile *tile = &state->tiles[z*terrain.tileCountX + x];
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].vertices[vCounter] = vertex[i];
-                        model.meshes[m].animVertices[vCounter] = vertex[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-            case IQM_NORMAL:
-            {
-                normal = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+                float dx = fmaxf(fmaxf(x*terrain.tileSize.x - viewPosition.x, viewPosition.x - (x + 1)*terrain.tileSize.x), 0.0f);
+                float dz = fmaxf(fmaxf(z*terrain.tileSize.z - viewPosition.z, viewPosition.z - (z + 1)*terrain.tileSize.z), 0.0f);
+                float distance = sqrtf(dx*dx + dz*dz);
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].normals[vCounter] = normal[i];
-                        model.meshes[m].animNormals[vCounter] = normal[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-            case IQM_TEXCOORD:
-            {
-                text = RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
-                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
+                if ((tile->state == TERRAIN_TILE_UNLOADED) && (distance < terrain.streamDistance)) QueueTerrainTileJob(state, tile, x, z);
+                else if ((tile->state == TERRAIN_TILE_READY) && (distance > 1.25f*terrain.streamDistance)) UnloadTerrainTile(tile);
+            }
+        }
+    }
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
-                    {
-                        model.meshes[m].texcoords[vCounter] = text[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-            case IQM_BLENDINDEXES:
-            {
-                blendi = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
-                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (state->shaderId == 0) return;
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneIds[boneCounter] = blendi[i];
-                        boneCounter++;
-                    }
-                }
-            } break;
-            case IQM_BLENDWEIGHTS:
-            {
-                blendw = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+    rlDrawRenderBatchActive();      // Draw shapes batched before terrain
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
-                        boneCounter++;
-                    }
-                }
-            } break;
-            case IQM_COLOR:
-            {
-                color = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+    Matrix matModelView = MatrixMultiply(MatrixMultiply(MatrixTranslate(position.x, position.y, position.z), rlGetMatrixTransform()), rlGetMatrixModelview());
+    Matrix mvp = MatrixMultiply(matModelView, rlGetMatrixProjection());
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    model.meshes[m].colors = RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
+    TerrainDrawContext context = { 0 };
+    context.state = state;
+    context.viewPosition = viewPosition;
 
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
-                    {
-                        model.meshes[m].colors[vCounter] = color[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-        }
-    }
+    // Get view frustum planes from model-view-projection matrix rows, planes point inside frustum
+    context.planes[0] = (Vector4){ mvp.m3 + mvp.m0, mvp.m7 + mvp.m4, mvp.m11 + mvp.m8, mvp.m15 + mvp.m12 };    // Left plane
+    context.planes[1] = (Vector4){ mvp.m3 - mvp.m0, mvp.m7 - mvp.m4, mvp.m11 - mvp.m8, mvp.m15 - mvp.m12 };    // Right plane
+    context.planes[2] = (Vector4){ mvp.m3 + mvp.m1, mvp.m7 + mvp.m5, mvp.m11 + mvp.m9, mvp.m15 + mvp.m13 };    // Bottom plane
+    context.planes[3] = (Vector4){ mvp.m3 - mvp.m1, mvp.m7 - mvp.m5, mvp.m11 - mvp.m9, mvp.m15 - mvp.m13 };    // Top plane
+    context.planes[4] = (Vector4){ mvp.m3 + mvp.m2, mvp.m7 + mvp.m6, mvp.m11 + mvp.m10, mvp.m15 + mvp.m14 };   // Near plane
+    context.planes[5] = (Vector4){ mvp.m3 - mvp.m2, mvp.m7 - mvp.m6, mvp.m11 - mvp.m10, mvp.m15 - mvp.m14 };   // Far plane
 
-    // Bones (joints) data processing
-    ijoint = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
-    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
-    //fread(ijoint, sizeof(IQMJoint), iqmHeader->num_joints, iqmFile);
-    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+    rlEnableShader(state->shaderId);
+    rlSetUniformMatrix(state->locs[0], mvp);
 
-    model.boneCount = iqmHeader->num_joints;
-    model.bones = RL_MALLOC(iqmHeader->num_joints*sizeof(BoneInfo));
-    model.bindPose = RL_MALLOC(iqmHeader->num_joints*sizeof(Transform));
+    float color[4] = { (float)tint.r/255.0f, (float)tint.g/255.0f, (float)tint.b/255.0f, (float)tint.a/255.0f };
+    rlSetUniform(state->locs[1], color, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(state->locs[2], &viewPosition, RL_SHADER_UNIFORM_VEC3, 1);
 
-    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
-    {
-        // Bones
-        model.bones[i].parent = ijoint[i].parent;
-        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[i].name, SEEK_SET);
-        //fread(model.bones[i].name, sizeof(char), BONE_NAME_LENGTH, iqmFile);
-        memcpy(model.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
+    int textureSlot = 0;
+    rlSetUniform(state->locs[7], &textureSlot, RL_SHADER_UNIFORM_SAMPLER2D, 1);
+    rlActiveTextureSlot(0);
 
-        // Bind pose (base pose)
-        model.bindPose[i].translation.x = ijoint[i].translate[0];
-        model.bindPose[i].translation.y = ijoint[i].translate[1];
-        model.bindPose[i].translation.z = ijoint[i].translate[2];
+    rlEnableVertexArray(state->vaoId);
 
-        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
-        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
-        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
-        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
+    for (int z = 0; z < terrain.tileCountZ; z++)
+    {
+        for (int x = 0; x < terrain.tileCountX; x++)
+        {
+            TerrainTile *tile = &state->tiles[z*terrain.tileCountX + x];
+            if (tile->state != TERRAIN_TILE_READY) continue;
 
-        model.bindPose[i].scale.x = ijoint[i].scale[0];
-        model.bindPose[i].scale.y = ijoint[i].scale[1];
-        model.bindPose[i].scale.z = ijoint[i].scale[2];
-    }
+            context.origin = (Vector3){ x*terrain.tileSize.x, 0.0f, z*terrain.tileSize.z };
+            context.scale = (Vector3){ terrain.tileSize.x/(tile->width - 1), terrain.tileSize.y, terrain.tileSize.z/(tile->height - 1) };
 
-    BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
+            // LOD levels ranges double every level, level 0 nodes grid matches heightmap samples
+            float nodeSize = TERRAIN_PATCH_SIZE*fmaxf(context.scale.x, context.scale.z);
+            for (int i = 0; i < tile->levels; i++) context.ranges[i] = TERRAIN_LOD_RANGE*nodeSize*(float)(1 << i);
 
-    RL_FREE(fileData);
+            rlSetUniform(state->locs[3], &context.origin, RL_SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(state->locs[4], &context.scale, RL_SHADER_UNIFORM_VEC3, 1);
+            rlEnableTexture(tile->textureId);
 
-    RL_FREE(imesh);
-    RL_FREE(tri);
-    RL_FREE(va);
-    RL_FREE(vertex);
-    RL_FREE(normal);
-    RL_FREE(text);
-    RL_FREE(blendi);
-    RL_FREE(blendw);
-    RL_FREE(ijoint);
-    RL_FREE(color);
+            // Root node out of its LOD range is drawn at coarsest level
+            if (!SelectTerrainNode(&context, tile, tile->levels - 1, 0, 0)) DrawTerrainNode(&context, tile->levels - 1, 0, 0);
+        }
+    }
 
-    return model;
+    rlDisableVertexArray();
+    rlDisableTexture();
+    rlDisableShader();
+#endif
 }
 
-// Load IQM animation data
-static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount)
+// Get terrain height at position (terrain space), heights are interpolated between tile samples
+// NOTE: Returns 0.0f for positions out of terrain or tiles not loaded
+float GetTerrainHeight(Terrain terrain, float x, float z)
 {
-    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
-    #define IQM_VERSION     2                   // only IQM version 2 supported
-
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
-    unsigned char *fileDataPtr = fileData;
+    TerrainState *state = (TerrainState *)terrain.state;
+    if ((state == NULL) || (x < 0.0f) || (z < 0.0f)) return 0.0f;
 
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int filesize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+    int tileX = (int)(x/terrain.tileSize.x);
+    int tileZ = (int)(z/terrain.tileSize.z);
+    if ((tileX >= terrain.tileCountX) || (tileZ >= terrain.tileCountZ)) return 0.0f;
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+    TerrainTile *tile = &state->tiles[tileZ*terrain.tileCountX + tileX];
+    if (tile->state != TERRAIN_TILE_READY) return 0.0f;
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+    // Get tile samples position
+    float sampleX = (x - tileX*terrain.tileSize.x)/terrain.tileSize.x*(tile->width - 1);
+    float sampleZ = (z - tileZ*terrain.tileSize.z)/terrain.tileSize.z*(tile->height - 1);
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+    int x0 = (int)sampleX;
+    int z0 = (int)sampleZ;
+    int x1 = (x0 + 1 < tile->width)? x0 + 1 : x0;
+    int z1 = (z0 + 1 < tile->height)? z0 + 1 : z0;
+    float fx = sampleX - x0;
+    float fz = sampleZ - z0;
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return NULL;
+    float h0 = Lerp(tile->heights[z0*tile->width + x0], tile->heights[z0*tile->width + x1], fx);
+    float h1 = Lerp(tile->heights[z1*tile->width + x0], tile->heights[z1*tile->width + x1], fx);
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    return Lerp(h0, h1, fz)*terrain.tileSize.y;
+}
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        return NULL;
-    }
-
-    if (iqmHeader->version != IQM_VERSION)
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF)
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        return NULL;
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+        }
     }
+}
+#endif
 
-    // Get bones data
-    IQMPose *poses = RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
-    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
-    //fread(poses, sizeof(IQMPose), iqmHeader->num_poses, iqmFile);
-    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
-
-    // Get animations data
-    *animCount = iqmHeader->num_anims;
-    IQMAnim *anim = RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
-    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
-    //fread(anim, sizeof(IQMAnim), iqmHeader->num_anims, iqmFile);
-    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+// Load OBJ mesh data
+//
+// Keep the following information in mind when reading this
+//  - A mesh is created for every material present in the obj file
+//  - the model.meshCount is therefore the materialCount returned from tinyobj
+//  - the mesh is automatically triangulated by tinyobj
+static Model LoadOBJ(const char *fileName)
+{
+    Model model = { 0 };
 
-    ModelAnimation *animations = RL_MALLOC(iqmHeader->num_anims*sizeof(ModelAnimation));
+    tinyobj_attrib_t attrib = { 0 };
+    tinyobj_shape_t *meshes = NULL;
+    unsigned int meshCount = 0;
 
-    // frameposes
-    unsigned short *framedata = RL_MALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
-    //fseek(iqmFile, iqmHeader->ofs_frames, SEEK_SET);
-    //fread(framedata, sizeof(unsigned short), iqmHeader->num_frames*iqmHeader->num_framechannels, iqmFile);
-    memcpy(framedata, fileDataPtr + iqmHeader->ofs_frames, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
+    tinyobj_material_t *materials = NULL;
+    unsigned int materialCount = 0;
 
-    // joints
-    IQMJoint *joints = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
-    memcpy(joints, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+    char *fileText = LoadFileText(fileName);
 
-    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+    if (fileText != NULL)
     {
-        animations[a].frameCount = anim[a].num_frames;
-        animations[a].boneCount = iqmHeader->num_poses;
-        animations[a].bones = RL_MALLOC(iqmHeader->num_poses*sizeof(BoneInfo));
-        animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(Transform *));
-        // animations[a].framerate = anim.framerate;     // TODO: Use animation framerate data?
-
-        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
+        unsigned int dataSize = (unsigned int)strlen(fileText);
+        char currentDir[1024] = { 0 };
+        strcpy(currentDir, GetWorkingDirectory());
+        const char *workingDir = GetDirectoryPath(fileName);
+        if (CHDIR(workingDir) != 0)
         {
-            // If animations and skeleton are in the same file, copy bone names to anim
-            if (iqmHeader->num_joints > 0)
-                memcpy(animations[a].bones[j].name, fileDataPtr + iqmHeader->ofs_text + joints[j].name, BONE_NAME_LENGTH*sizeof(char));
-            else
-                strcpy(animations[a].bones[j].name, "ANIMJOINTNAME"); // default bone name otherwise
-            animations[a].bones[j].parent = poses[j].parent;
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
         }
 
-        for (unsigned int j = 0; j < anim[a].num_frames; j++) animations[a].framePoses[j] = RL_MALLOC(iqmHeader->num_poses*sizeof(Transform));
+        unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
+        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
 
-        int dcounter = anim[a].first_frame*iqmHeader->num_framechannels;
+        if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
+        else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
 
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
-        {
-            for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
-            {
-                animations[a].framePoses[frame][i].translation.x = poses[i].channeloffset[0];
+        model.meshCount = materialCount;
 
-                if (poses[i].mask & 0x01)
-                {
-                    animations[a].framePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
-                    dcounter++;
-                }
+        // Init model materials array
+        if (materialCount > 0)
+        {
+            model.materialCount = materialCount;
+            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", materialCount);
+        }
+        else
+        {
+            model.meshCount = 1;
+            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
+        }
 
-                animations[a].framePoses[frame][i].translation.y = poses[i].channeloffset[1];
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
 
-                if (poses[i].mask & 0x02)
-                {
-                    animations[a].framePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
-                    dcounter++;
-                }
+        // Count the faces for each material
+        int *matFaces = RL_CALLOC(model.meshCount, sizeof(int));
 
-                animations[a].framePoses[frame][i].translation.z = poses[i].channeloffset[2];
+        // if no materials are present use all faces on one mesh
+        if (materialCount > 0)
+        {
+            for (unsigned int fi = 0; fi < attrib.num_faces; fi++)
+            {
+                //tinyobj_vertex_index_t face = attrib.faces[fi];
+                int idx = attrib.material_ids[fi];
+                matFaces[idx]++;
+            }
 
-                if (poses[i].mask & 0x04)
-                {
-                    animations[a].framePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
-                    dcounter++;
-                }
+        }
+        else
+        {
+            matFaces[0] = attrib.num_faces;
+        }
 
-                animations[a].framePoses[frame][i].rotation.x = poses[i].channeloffset[3];
+        //--------------------------------------
+        // Create the material meshes
 
-                if (poses[i].mask & 0x08)
-                {
-                    animations[a].framePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
-                    dcounter++;
-                }
+        // Running counts/indexes for each material mesh as we are
+        // building them at the same time
+        int *vCount = RL_CALLOC(model.meshCount, sizeof(int));
+        int *vtCount = RL_CALLOC(model.meshCount, sizeof(int));
+        int *vnCount = RL_CALLOC(model.meshCount, sizeof(int));
+        int *faceCount = RL_CALLOC(model.meshCount, sizeof(int));
 
-                animations[a].framePoses[frame][i].rotation.y = poses[i].channeloffset[4];
+        // Allocate space for each of the material meshes
+        for (int mi = 0; mi < model.meshCount; mi++)
+        {
+            model.meshes[mi].vertexCount = matFaces[mi]*3;
+            model.meshes[mi].triangleCount = matFaces[mi];
+            model.meshes[mi].vertices = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
+            model.meshes[mi].texcoords = (float *)RL_CALLOC(model.meshes[mi].vertexCount*2, sizeof(float));
+            model.meshes[mi].normals = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
+            model.meshMaterial[mi] = mi;
+        }
 
-                if (poses[i].mask & 0x10)
-                {
-                    animations[a].framePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
-                    dcounter++;
-                }
+        // Scan through the combined sub meshes and pick out each material mesh
+        for (unsigned int af = 0; af < attrib.num_faces; af++)
+        {
+            int mm = attrib.material_ids[af];   // mesh material for this face
+            if (mm == -1) { mm = 0; }           // no material object..
 
-                animations[a].framePoses[frame][i].rotation.z = poses[i].channeloffset[5];
+            // Get indices for the face
+            tinyobj_vertex_index_t idx0 = attrib.faces[3*af + 0];
+            tinyobj_vertex_index_t idx1 = attrib.faces[3*af + 1];
+            tinyobj_vertex_index_t idx2 = attrib.faces[3*af + 2];
 
-                if (poses[i].mask & 0x20)
-                {
-                    animations[a].framePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
-                    dcounter++;
-                }
+            // Fill vertices buffer (float) using vertex index of the face
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx0.v_idx*3 + v]; } vCount[mm] +=3;
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx1.v_idx*3 + v]; } vCount[mm] +=3;
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx2.v_idx*3 + v]; } vCount[mm] +=3;
 
-                animations[a].framePoses[frame][i].rotation.w = poses[i].channeloffset[6];
+            if (attrib.num_texcoords > 0)
+            {
+                // Fill texcoords buffer (float) using vertex index of the face
+                // NOTE: Y-coordinate must be flipped upside-down to account for
+                // raylib's upside down textures...
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx0.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx0.vt_idx*2 + 1]; vtCount[mm] += 2;
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx1.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx1.vt_idx*2 + 1]; vtCount[mm] += 2;
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx2.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx2.vt_idx*2 + 1]; vtCount[mm] += 2;
+            }
 
-                if (poses[i].mask & 0x40)
-                {
-                    animations[a].framePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
-                    dcounter++;
-                }
+            if (attrib.num_normals > 0)
+            {
+                // Fill normals buffer (float) using vertex index of the face
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx0.vn_idx*3 + v]; } vnCount[mm] +=3;
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx1.vn_idx*3 + v]; } vnCount[mm] +=3;
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx2.vn_idx*3 + v]; } vnCount[mm] +=3;
+            }
+        }
 
-                animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
+        // Weld faces corners sharing position, texcoord and normal into indexed meshes
+        for (int mi = 0; mi < model.meshCount; mi++) WeldMeshVertices(&model.meshes[mi]);
 
-                if (poses[i].mask & 0x80)
-                {
-                    animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
-                    dcounter++;
-                }
+        // Init model materials
+        ProcessMaterialsOBJ(model.materials, materials, materialCount);
 
-                animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
+        tinyobj_attrib_free(&attrib);
+        tinyobj_shapes_free(meshes, meshCount);
+        tinyobj_materials_free(materials, materialCount);
 
-                if (poses[i].mask & 0x100)
-                {
-                    animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
-                    dcounter++;
-                }
+        UnloadFileText(fileText);
 
-                animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
+        RL_FREE(matFaces);
+        RL_FREE(vCount);
+        RL_FREE(vtCount);
+        RL_FREE(vnCount);
+        RL_FREE(faceCount);
 
-                if (poses[i].mask & 0x200)
-                {
-                    animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
-                    dcounter++;
-                }
+        if (CHDIR(currentDir) != 0)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
+        }
+    }
 
-                animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
-            }
-        }
-
-        // Build frameposes
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
-        {
-            for (int i = 0; i < animations[a].boneCount; i++)
-            {
-                if (animations[a].bones[i].parent >= 0)
-                {
-                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
-                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
-                }
-            }
-        }
-    }
+    return model;
+}
+#endif
 
-    RL_FREE(fileData);
+#if defined(SUPPORT_FILEFORMAT_IQM)
+// Load IQM mesh data
+static Model LoadIQM(const char *fileName)
+{
+    #define IQM_MAGIC     "INTERQUAKEMODEL" // IQM file magic number
+    #define IQM_VERSION          2          // only IQM version 2 supported
 
-    RL_FREE(joints);
-    RL_FREE(framedata);
-    RL_FREE(poses);
-    RL_FREE(anim);
+    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
+    #define MESH_NAME_LENGTH    32          // Mesh name string length
+    #define MATERIAL_NAME_LENGTH 32         // Material name string length
 
-    return animations;
-}
+    unsigned int fileSize = 0;
+    unsigned char *fileData = MapFileData(fileName, &fileSize);
+    unsigned char *fileDataPtr = fileData;
 
-#endif
+    // IQM file structs
+    //-----------------------------------------------------------------------------------
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int filesize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
 
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-// Load image from different glTF provided methods (uri, path, buffer_view)
-static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
-{
-    Image image = { 0 };
+    typedef struct IQMMesh {
+        unsigned int name;
+        unsigned int material;
+        unsigned int first_vertex, num_vertexes;
+        unsigned int first_triangle, num_triangles;
+    } IQMMesh;
 
-    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
-    {
-        if ((strlen(cgltfImage->uri) > 5) &&
-            (cgltfImage->uri[0] == 'd') &&
-            (cgltfImage->uri[1] == 'a') &&
-            (cgltfImage->uri[2] == 't') &&
-            (cgltfImage->uri[3] == 'a') &&
-            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
-        {
-            // Data URI Format: data:<mediatype>;base64,<data>
+    typedef struct IQMTriangle {
+        unsigned int vertex[3];
+    } IQMTriangle;
 
-            // Find the comma
-            int i = 0;
-            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
 
-            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
-            else
-            {
-                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
-                int outSize = 3*(base64Size/4);         // TODO: Consider padding (-numberOfPaddingCharacters)
-                void *data = NULL;
+    typedef struct IQMVertexArray {
+        unsigned int type;
+        unsigned int flags;
+        unsigned int format;
+        unsigned int size;
+        unsigned int offset;
+    } IQMVertexArray;
 
-                cgltf_options options = { 0 };
-                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+    // NOTE: Below IQM structures are not used but listed for reference
+    /*
+    typedef struct IQMAdjacency {
+        unsigned int triangle[3];
+    } IQMAdjacency;
 
-                if (result == cgltf_result_success)
-                {
-                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
-                    MemFree(data);
-                }
-            }
-        }
-        else     // Check if image is provided as image path
-        {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
-        }
-    }
-    else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
-    {
-        unsigned char *data = RL_MALLOC(cgltfImage->buffer_view->size);
-        int offset = (int)cgltfImage->buffer_view->offset;
-        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
 
-        // Copy buffer data to memory for loading
-        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
-        {
-            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
-            offset += stride;
-        }
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
 
-        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
-        // NOTE: Detected that some models define mime_type as "image\\/png"
-        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) ||
-            (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
-        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
-                 (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+    typedef struct IQMBounds {
+        float bbmin[3], bbmax[3];
+        float xyradius, radius;
+    } IQMBounds;
+    */
+    //-----------------------------------------------------------------------------------
 
-        RL_FREE(data);
-    }
+    // IQM vertex data types
+    enum {
+        IQM_POSITION     = 0,
+        IQM_TEXCOORD     = 1,
+        IQM_NORMAL       = 2,
+        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
+        IQM_BLENDINDEXES = 4,
+        IQM_BLENDWEIGHTS = 5,
+        IQM_COLOR        = 6,
+        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
+    };
 
-    return image;
-}
+    Model model = { 0 };
 
-// Load bone info from GLTF skin data
-static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
-{
-    *boneCount = (int)skin.joints_count;
-    BoneInfo *bones = RL_MALLOC(skin.joints_count*sizeof(BoneInfo));
+    IQMMesh *imesh = NULL;
+    IQMTriangle *tri = NULL;
+    IQMVertexArray *va = NULL;
+    IQMJoint *ijoint = NULL;
 
-    for (unsigned int i = 0; i < skin.joints_count; i++)
-    {
-        cgltf_node node = *skin.joints[i];
-        strncpy(bones[i].name, node.name, sizeof(bones[i].name));
+    float *vertex = NULL;
+    float *normal = NULL;
+    float *text = NULL;
+    char *blendi = NULL;
+    unsigned char *blendw = NULL;
+    unsigned char *color = NULL;
 
-        // Find parent bone index
-        unsigned int parentIndex = -1;
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return model;
 
-        for (unsigned int j = 0; j < skin.joints_count; j++)
-        {
-            if (skin.joints[j] == node.parent)
-            {
-                parentIndex = j;
-                break;
-            }
-        }
+    // Read IQM header
+    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
 
-        bones[i].parent = parentIndex;
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnmapFileData(fileData, fileSize);
+        return model;
     }
 
-    return bones;
-}
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnmapFileData(fileData, fileSize);
+        return model;
+    }
 
-// Load glTF file into model struct, .gltf and .glb supported
-static Model LoadGLTF(const char *fileName)
-{
-    /*********************************************************************************************
+    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
 
-        Function implemented by Wilhem Barbier(@wbrbr), with modifications by Tyler Bezera(@gamerfiend)
-        Reviewed by Ramon Santamaria (@raysan5)
+    // Meshes data processing
+    imesh = RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
+    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
+    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
+    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
 
-        FEATURES:
-          - Supports .gltf and .glb files
-          - Supports embedded (base64) or external textures
-          - Supports PBR metallic/roughness flow, loads material textures, values and colors
-                     PBR specular/glossiness flow and extended texture flows not supported
-          - Supports multiple meshes per model (every primitives is loaded as a separate mesh)
-          - Supports basic animations
+    model.meshCount = iqmHeader->num_meshes;
+    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
 
-        RESTRICTIONS:
-          - Only triangle meshes supported
-          - Vertex attibute types and formats supported:
-              > Vertices (position): vec3: float
-              > Normals: vec3: float
-              > Texcoords: vec2: float
-              > Colors: vec4: u8, u16, f32 (normalized)
-              > Indices: u16, u32 (truncated to u16)
-          - Node hierarchies or transforms not supported
+    model.materialCount = model.meshCount;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
 
-    ***********************************************************************************************/
+    char name[MESH_NAME_LENGTH] = { 0 };
+    char material[MATERIAL_NAME_LENGTH] = { 0 };
 
-    // Macro to simplify attributes loading code
-    #define LOAD_ATTRIBUTE(accesor, numComp, dataType, dstPtr) \
-    { \
-        int n = 0; \
-        dataType *buffer = (dataType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(dataType) + accesor->offset/sizeof(dataType); \
-        for (unsigned int k = 0; k < accesor->count; k++) \
-        {\
-            for (int l = 0; l < numComp; l++) \
-            {\
-                dstPtr[numComp*k + l] = buffer[n + l];\
-            }\
-            n += (int)(accesor->stride/sizeof(dataType));\
-        }\
-    }
-
-    Model model = { 0 };
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].name, SEEK_SET);
+        //fread(name, sizeof(char), MESH_NAME_LENGTH, iqmFile);
+        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
 
-    // glTF file loading
-    unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].material, SEEK_SET);
+        //fread(material, sizeof(char), MATERIAL_NAME_LENGTH, iqmFile);
+        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
 
-    if (fileData == NULL) return model;
+        model.materials[i] = LoadMaterialDefault();
 
-    // glTF data loading
-    cgltf_options options = { 0 };
-    cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
 
-    if (result == cgltf_result_success)
-    {
-        if (data->file_type == cgltf_file_type_glb) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glb) loaded successfully", fileName);
-        else if (data->file_type == cgltf_file_type_gltf) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glTF) loaded successfully", fileName);
-        else TRACELOG(LOG_WARNING, "MODEL: [%s] Model format not recognized", fileName);
+        model.meshes[i].vertexCount = imesh[i].num_vertexes;
 
-        TRACELOG(LOG_INFO, "    > Meshes count: %i", data->meshes_count);
-        TRACELOG(LOG_INFO, "    > Materials count: %i (+1 default)", data->materials_count);
-        TRACELOG(LOG_DEBUG, "    > Buffers count: %i", data->buffers_count);
-        TRACELOG(LOG_DEBUG, "    > Images count: %i", data->images_count);
-        TRACELOG(LOG_DEBUG, "    > Textures count: %i", data->textures_count);
+        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
+        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
+        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
 
-        // Force reading data buffers (fills buffer_view->buffer->data)
-        // NOTE: If an uri is defined to base64 data or external path, it's automatically loaded
-        result = cgltf_load_buffers(&options, data, fileName);
-        if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
+        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
+        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
 
-        int primitivesCount = 0;
-        // NOTE: We will load every primitive in the glTF as a separate raylib mesh
-        for (unsigned int i = 0; i < data->meshes_count; i++) primitivesCount += (int)data->meshes[i].primitives_count;
+        model.meshes[i].triangleCount = imesh[i].num_triangles;
+        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
 
-        // Load our model data: meshes and materials
-        model.meshCount = primitivesCount;
-        model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+        // Animated verted data, what we actually process for rendering
+        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
+        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+    }
 
-        // NOTE: We keep an extra slot for default material, in case some mesh requires it
-        model.materialCount = (int)data->materials_count + 1;
-        model.materials = RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();     // Load default material (index: 0)
+    // Triangles data processing
+    tri = RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
+    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
+    //fread(tri, sizeof(IQMTriangle), iqmHeader->num_triangles, iqmFile);
+    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
 
-        // Load mesh-material indices, by default all meshes are mapped to material index: 0
-        model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        int tcounter = 0;
 
-        // Load materials data
-        //----------------------------------------------------------------------------------------------------
-        for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
+        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
         {
-            model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
+            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
+            // expecting they point to the counter-clockwise vertex triangle, so we need to reverse triangle indexes
+            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
+            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
+            tcounter += 3;
+        }
+    }
 
-            // Check glTF material flow: PBR metallic/roughness flow
-            // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
-            if (data->materials[i].has_pbr_metallic_roughness)
+    // Vertex arrays data processing
+    va = RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
+    //fread(va, sizeof(IQMVertexArray), iqmHeader->num_vertexarrays, iqmFile);
+    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+
+    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
+    {
+        switch (va[i].type)
+        {
+            case IQM_POSITION:
             {
-                // Load base color texture (albedo)
-                if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
+                vertex = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
                 {
-                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
-                        UnloadImage(imAlbedo);
+                        model.meshes[m].vertices[vCounter] = vertex[i];
+                        model.meshes[m].animVertices[vCounter] = vertex[i];
+                        vCounter++;
                     }
                 }
-                // Load base color factor (tint)
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
+            } break;
+            case IQM_NORMAL:
+            {
+                normal = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
 
-                // Load metallic/roughness texture
-                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
                 {
-                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
-                        UnloadImage(imMetallicRoughness);
+                        model.meshes[m].normals[vCounter] = normal[i];
+                        model.meshes[m].animNormals[vCounter] = normal[i];
+                        vCounter++;
                     }
-
-                    // Load metallic/roughness material properties
-                    float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
-                    model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].value = roughness;
-
-                    float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
-                    model.materials[j].maps[MATERIAL_MAP_METALNESS].value = metallic;
                 }
+            } break;
+            case IQM_TEXCOORD:
+            {
+                text = RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
+                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
 
-                // Load normal texture
-                if (data->materials[i].normal_texture.texture)
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
                 {
-                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
-                        UnloadImage(imNormal);
+                        model.meshes[m].texcoords[vCounter] = text[i];
+                        vCounter++;
                     }
                 }
+            } break;
+            case IQM_BLENDINDEXES:
+            {
+                blendi = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
+                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
 
-                // Load ambient occlusion texture
-                if (data->materials[i].occlusion_texture.texture)
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
                 {
-                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
-                        UnloadImage(imOcclusion);
+                        model.meshes[m].boneIds[boneCounter] = blendi[i];
+                        boneCounter++;
                     }
                 }
+            } break;
+            case IQM_BLENDWEIGHTS:
+            {
+                blendw = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
 
-                // Load emissive texture
-                if (data->materials[i].emissive_texture.texture)
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
                 {
-                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
-                        UnloadImage(imEmissive);
+                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
+                        boneCounter++;
                     }
-
-                    // Load emissive color factor
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.g = (unsigned char)(data->materials[i].emissive_factor[1]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.b = (unsigned char)(data->materials[i].emissive_factor[2]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.a = 255;
                 }
-            }
-
-            // Other possible materials not supported by raylib pipeline:
-            // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
-        }
-
-        // Load meshes data
-        //----------------------------------------------------------------------------------------------------
-        for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
-        {
-            // NOTE: meshIndex accumulates primitives
-
-            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            } break;
+            case IQM_COLOR:
             {
-                // NOTE: We only support primitives defined by triangles
-                // Other alternatives: points, lines, line_strip, triangle_strip
-                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
-
-                // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
-                // Only some formats for each attribute type are supported, read info at the top of this function!
+                color = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
 
-                for (unsigned int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
                 {
-                    // Check the different attributes for every primitive
-                    if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_position)      // POSITION
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
-
-                        // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined.
+                    model.meshes[m].colors = RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
-                        {
-                            // Init raylib mesh vertices to copy glTF attribute data
-                            model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                            model.meshes[meshIndex].vertices = RL_MALLOC(attribute->count*3*sizeof(float));
-
-                            // Load 3 components of float data type into mesh.vertices
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_normal)   // NORMAL
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
                     {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+                        model.meshes[m].colors[vCounter] = color[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+        }
+    }
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
-                        {
-                            // Init raylib mesh normals to copy glTF attribute data
-                            model.meshes[meshIndex].normals = RL_MALLOC(attribute->count*3*sizeof(float));
+    // Bones (joints) data processing
+    ijoint = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
+    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
+    //fread(ijoint, sizeof(IQMJoint), iqmHeader->num_joints, iqmFile);
+    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
 
-                            // Load 3 components of float data type into mesh.normals
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+    model.boneCount = iqmHeader->num_joints;
+    model.bones = RL_MALLOC(iqmHeader->num_joints*sizeof(BoneInfo));
+    model.bindPose = RL_MALLOC(iqmHeader->num_joints*sizeof(Transform));
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh tangent to copy glTF attribute data
-                            model.meshes[meshIndex].tangents = RL_MALLOC(attribute->count*4*sizeof(float));
+    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
+    {
+        // Bones
+        model.bones[i].parent = ijoint[i].parent;
+        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[i].name, SEEK_SET);
+        //fread(model.bones[i].name, sizeof(char), BONE_NAME_LENGTH, iqmFile);
+        memcpy(model.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
 
-                            // Load 4 components of float data type into mesh.tangents
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].tangents)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_0
-                    {
-                        // TODO: Support additional texture coordinates: TEXCOORD_1 -> mesh.texcoords2
+        // Bind pose (base pose)
+        model.bindPose[i].translation.x = ijoint[i].translate[0];
+        model.bindPose[i].translation.y = ijoint[i].translate[1];
+        model.bindPose[i].translation.z = ijoint[i].translate[2];
 
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
+        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
+        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
+        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec2))
-                        {
-                            // Init raylib mesh texcoords to copy glTF attribute data
-                            model.meshes[meshIndex].texcoords = RL_MALLOC(attribute->count*2*sizeof(float));
+        model.bindPose[i].scale.x = ijoint[i].scale[0];
+        model.bindPose[i].scale.y = ijoint[i].scale[1];
+        model.bindPose[i].scale.z = ijoint[i].scale[2];
+    }
 
-                            // Load 3 components of float data type into mesh.texcoords
-                            LOAD_ATTRIBUTE(attribute, 2, float, model.meshes[meshIndex].texcoords)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_color)    // COLOR_0
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+    BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
 
-                        // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range.
+    UnmapFileData(fileData, fileSize);
 
-                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+    RL_FREE(imesh);
+    RL_FREE(tri);
+    RL_FREE(va);
+    RL_FREE(vertex);
+    RL_FREE(normal);
+    RL_FREE(text);
+    RL_FREE(blendi);
+    RL_FREE(blendw);
+    RL_FREE(ijoint);
+    RL_FREE(color);
 
-                            // Load 4 components of unsigned char data type into mesh.colors
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].colors)
-                        }
-                        else if ((attribute->component_type == cgltf_component_type_r_16u) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+    return model;
+}
 
-                            // Load data into a temp buffer to be converted to raylib data type
-                            unsigned short *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
+// Load IQM animation data
+static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount)
+{
+    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
+    #define IQM_VERSION     2                   // only IQM version 2 supported
 
-                            // Convert data to raylib color data type (4 bytes)
-                            for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    unsigned char *fileDataPtr = fileData;
 
-                            RL_FREE(temp);
-                        }
-                        else if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int filesize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
 
-                            // Load data into a temp buffer to be converted to raylib data type
-                            float *temp = RL_MALLOC(attribute->count*4*sizeof(float));
-                            LOAD_ATTRIBUTE(attribute, 4, float, temp);
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
 
-                            // Convert data to raylib color data type (4 bytes), we expect the color data normalized
-                            for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(temp[c]*255.0f);
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
 
-                            RL_FREE(temp);
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                    }
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
 
-                    // NOTE: Attributes related to animations are processed separately
-                }
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return NULL;
 
-                // Load primitive indices data (if provided)
-                if (data->meshes[i].primitives[p].indices != NULL)
-                {
-                    cgltf_accessor *attribute = data->meshes[i].primitives[p].indices;
+    // Read IQM header
+    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
 
-                    model.meshes[meshIndex].triangleCount = (int)attribute->count/3;
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        return NULL;
+    }
 
-                    if (attribute->component_type == cgltf_component_type_r_16u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        return NULL;
+    }
 
-                        // Load unsigned short data type into mesh.indices
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned short, model.meshes[meshIndex].indices)
-                    }
-                    else if (attribute->component_type == cgltf_component_type_r_32u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+    // Get bones data
+    IQMPose *poses = RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
+    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
+    //fread(poses, sizeof(IQMPose), iqmHeader->num_poses, iqmFile);
+    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
 
-                        // Load data into a temp buffer to be converted to raylib data type
-                        unsigned int *temp = RL_MALLOC(attribute->count*sizeof(unsigned int));
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned int, temp);
+    // Get animations data
+    *animCount = iqmHeader->num_anims;
+    IQMAnim *anim = RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
+    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
+    //fread(anim, sizeof(IQMAnim), iqmHeader->num_anims, iqmFile);
+    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
 
-                        // Convert data to raylib indices data type (unsigned short)
-                        for (unsigned int d = 0; d < attribute->count; d++) model.meshes[meshIndex].indices[d] = (unsigned short)temp[d];
+    ModelAnimation *animations = RL_MALLOC(iqmHeader->num_anims*sizeof(ModelAnimation));
 
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
+    // frameposes
+    unsigned short *framedata = RL_MALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
+    //fseek(iqmFile, iqmHeader->ofs_frames, SEEK_SET);
+    //fread(framedata, sizeof(unsigned short), iqmHeader->num_frames*iqmHeader->num_framechannels, iqmFile);
+    memcpy(framedata, fileDataPtr + iqmHeader->ofs_frames, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
 
-                        RL_FREE(temp);
-                    }
-                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
-                }
-                else model.meshes[meshIndex].triangleCount = model.meshes[meshIndex].vertexCount/3;    // Unindexed mesh
+    // joints
+    IQMJoint *joints = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
+    memcpy(joints, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
 
-                // Assign to the primitive mesh the corresponding material index
-                // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
-                for (unsigned int m = 0; m < data->materials_count; m++)
-                {
-                    // The primitive actually keeps the pointer to the corresponding material,
-                    // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
-                    // To get the index, we check if material pointers match, and we assign the corresponding index,
-                    // skipping index 0, the default material
-                    if (&data->materials[m] == data->meshes[i].primitives[p].material)
-                    {
-                        model.meshMaterial[meshIndex] = m + 1;
-                        break;
-                    }
-                }
+    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+    {
+        animations[a].frameCount = anim[a].num_frames;
+        animations[a].boneCount = iqmHeader->num_poses;
+        animations[a].bones = RL_MALLOC(iqmHeader->num_poses*sizeof(BoneInfo));
+        animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(Transform *));
+        // animations[a].framerate = anim.framerate;     // TODO: Use animation framerate data?
+
+        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
+        {
+            // If animations and skeleton are in the same file, copy bone names to anim
+            if (iqmHeader->num_joints > 0)
+                memcpy(animations[a].bones[j].name, fileDataPtr + iqmHeader->ofs_text + joints[j].name, BONE_NAME_LENGTH*sizeof(char));
+            else
+                strcpy(animations[a].bones[j].name, "ANIMJOINTNAME"); // default bone name otherwise
+            animations[a].bones[j].parent = poses[j].parent;
+        }
+
+        for (unsigned int j = 0; j < anim[a].num_frames; j++) animations[a].framePoses[j] = RL_MALLOC(iqmHeader->num_poses*sizeof(Transform));
+
+        int dcounter = anim[a].first_frame*iqmHeader->num_framechannels;
+
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        {
+            for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
+            {
+                animations[a].framePoses[frame][i].translation.x = poses[i].channeloffset[0];
+
+                if (poses[i].mask & 0x01)
+                {
+                    animations[a].framePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].translation.y = poses[i].channeloffset[1];
+
+                if (poses[i].mask & 0x02)
+                {
+                    animations[a].framePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].translation.z = poses[i].channeloffset[2];
+
+                if (poses[i].mask & 0x04)
+                {
+                    animations[a].framePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].rotation.x = poses[i].channeloffset[3];
+
+                if (poses[i].mask & 0x08)
+                {
+                    animations[a].framePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].rotation.y = poses[i].channeloffset[4];
+
+                if (poses[i].mask & 0x10)
+                {
+                    animations[a].framePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].rotation.z = poses[i].channeloffset[5];
+
+                if (poses[i].mask & 0x20)
+                {
+                    animations[a].framePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].rotation.w = poses[i].channeloffset[6];
+
+                if (poses[i].mask & 0x40)
+                {
+                    animations[a].framePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
+
+                if (poses[i].mask & 0x80)
+                {
+                    animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
+
+                if (poses[i].mask & 0x100)
+                {
+                    animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
+
+                if (poses[i].mask & 0x200)
+                {
+                    animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
+            }
+        }
+
+        // Build frameposes
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        {
+            for (int i = 0; i < animations[a].boneCount; i++)
+            {
+                if (animations[a].bones[i].parent >= 0)
+                {
+                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
+                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
+                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
+                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
+                }
+            }
+        }
+    }
+
+    RL_FREE(fileData);
+
+    RL_FREE(joints);
+    RL_FREE(framedata);
+    RL_FREE(poses);
+    RL_FREE(anim);
+
+    return animations;
+}
+
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// Load image from different glTF provided methods (uri, path, buffer_view)
+static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+{
+    Image image = { 0 };
+
+    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
+    {
+        if ((strlen(cgltfImage->uri) > 5) &&
+            (cgltfImage->uri[0] == 'd') &&
+            (cgltfImage->uri[1] == 'a') &&
+            (cgltfImage->uri[2] == 't') &&
+            (cgltfImage->uri[3] == 'a') &&
+            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
+        {
+            // Data URI Format: data:<mediatype>;base64,<data>
+
+            // Find the comma
+            int i = 0;
+            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+
+            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
+            else
+            {
+                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
+                int outSize = 3*(base64Size/4);         // TODO: Consider padding (-numberOfPaddingCharacters)
+                void *data = NULL;
+
+                cgltf_options options = { 0 };
+                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+
+                if (result == cgltf_result_success)
+                {
+                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
+                    MemFree(data);
+                }
+            }
+        }
+        else     // Check if image is provided as image path
+        {
+            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
+        }
+    }
+    else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
+    {
+        unsigned char *data = RL_MALLOC(cgltfImage->buffer_view->size);
+        int offset = (int)cgltfImage->buffer_view->offset;
+        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+
+        // Copy buffer data to memory for loading
+        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
+        {
+            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
+            offset += stride;
+        }
+
+        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
+        // NOTE: Detected that some models define mime_type as "image\\/png"
+        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) ||
+            (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
+        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
+                 (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+
+        RL_FREE(data);
+    }
+
+    return image;
+}
+
+// Load bone info from GLTF skin data
+static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
+{
+    *boneCount = (int)skin.joints_count;
+    BoneInfo *bones = RL_MALLOC(skin.joints_count*sizeof(BoneInfo));
+
+    for (unsigned int i = 0; i < skin.joints_count; i++)
+    {
+        cgltf_node node = *skin.joints[i];
+        strncpy(bones[i].name, node.name, sizeof(bones[i].name));
+
+        // Find parent bone index
+        unsigned int parentIndex = -1;
+
+        for (unsigned int j = 0; j < skin.joints_count; j++)
+        {
+            if (skin.joints[j] == node.parent)
+            {
+                parentIndex = j;
+                break;
+            }
+        }
+
+        bones[i].parent = parentIndex;
+    }
+
+    return bones;
+}
+
+// Load glTF file into model struct, .gltf and .glb supported
+static Model LoadGLTF(const char *fileName)
+{
+    /*********************************************************************************************
+
+        Function implemented by Wilhem Barbier(@wbrbr), with modifications by Tyler Bezera(@gamerfiend)
+        Reviewed by Ramon Santamaria (@raysan5)
+
+        FEATURES:
+          - Supports .gltf and .glb files
+          - Supports embedded (base64) or external textures
+          - Supports PBR metallic/roughness flow, loads material textures, values and colors
+                     PBR specular/glossiness flow and extended texture flows not supported
+          - Supports multiple meshes per model (every primitives is loaded as a separate mesh)
+          - Supports basic animations
+
+        RESTRICTIONS:
+          - Only triangle meshes supported
+          - Vertex attibute types and formats supported:
+              > Vertices (position): vec3: float
+              > Normals: vec3: float
+              > Texcoords: vec2: float
+              > Colors: vec4: u8, u16, f32 (normalized)
+              > Indices: u16, u32 (truncated to u16)
+          - Node hierarchies or transforms not supported
+
+    ***********************************************************************************************/
+
+    // Macro to simplify attributes loading code
+    #define LOAD_ATTRIBUTE(accesor, numComp, dataType, dstPtr) \
+    { \
+        int n = 0; \
+        dataType *buffer = (dataType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(dataType) + accesor->offset/sizeof(dataType); \
+        for (unsigned int k = 0; k < accesor->count; k++) \
+        {\
+            for (int l = 0; l < numComp; l++) \
+            {\
+                dstPtr[numComp*k + l] = buffer[n + l];\
+            }\
+            n += (int)(accesor->stride/sizeof(dataType));\
+        }\
+    }
+
+    Model model = { 0 };
+
+    // glTF file mapping (read-only, no heap copy)
+    unsigned int dataSize = 0;
+    unsigned char *fileData = MapFileData(fileName, &dataSize);
+
+    if (fileData == NULL) return model;
+
+    // glTF data loading
+    cgltf_options options = { 0 };
+    cgltf_data *data = NULL;
+    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+
+    if (result == cgltf_result_success)
+    {
+        if (data->file_type == cgltf_file_type_glb) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glb) loaded successfully", fileName);
+        else if (data->file_type == cgltf_file_type_gltf) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glTF) loaded successfully", fileName);
+        else TRACELOG(LOG_WARNING, "MODEL: [%s] Model format not recognized", fileName);
+
+        TRACELOG(LOG_INFO, "    > Meshes count: %i", data->meshes_count);
+        TRACELOG(LOG_INFO, "    > Materials count: %i (+1 default)", data->materials_count);
+        TRACELOG(LOG_DEBUG, "    > Buffers count: %i", data->buffers_count);
+        TRACELOG(LOG_DEBUG, "    > Images count: %i", data->images_count);
+        TRACELOG(LOG_DEBUG, "    > Textures count: %i", data->textures_count);
+
+        // Force reading data buffers (fills buffer_view->buffer->data)
+        // NOTE: If an uri is defined to base64 data or external path, it's automatically loaded
+        result = cgltf_load_buffers(&options, data, fileName);
+        if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
+
+        int primitivesCount = 0;
+        // NOTE: We will load every primitive in the glTF as a separate raylib mesh
+        for (unsigned int i = 0; i < data->meshes_count; i++) primitivesCount += (int)data->meshes[i].primitives_count;
+
+        // Load our model data: meshes and materials
+        model.meshCount = primitivesCount;
+        model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+        // NOTE: We keep an extra slot for default material, in case some mesh requires it
+        model.materialCount = (int)data->materials_count + 1;
+        model.materials = RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();     // Load default material (index: 0)
+
+        // Load mesh-material indices, by default all meshes are mapped to material index: 0
+        model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
+
+        // Load materials data
+        //----------------------------------------------------------------------------------------------------
+        for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
+        {
+            model.materials[j] = LoadMaterialDefault();
+            const char *texPath = GetDirectoryPath(fileName);
+
+            // Check glTF material flow: PBR metallic/roughness flow
+            // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
+            if (data->materials[i].has_pbr_metallic_roughness)
+            {
+                // Load base color texture (albedo)
+                if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
+                {
+                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
+                    if (imAlbedo.data != NULL)
+                    {
+                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
+                        UnloadImage(imAlbedo);
+                    }
+                }
+                // Load base color factor (tint)
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
+
+                // Load metallic/roughness texture
+                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
+                {
+                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
+                    if (imMetallicRoughness.data != NULL)
+                    {
+                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
+                        UnloadImage(imMetallicRoughness);
+                    }
+
+                    // Load metallic/roughness material properties
+                    float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
+                    model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].value = roughness;
+
+                    float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
+                    model.materials[j].maps[MATERIAL_MAP_METALNESS].value = metallic;
+                }
+
+                // Load normal texture
+                if (data->materials[i].normal_texture.texture)
+                {
+                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
+                    if (imNormal.data != NULL)
+                    {
+                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
+                        UnloadImage(imNormal);
+                    }
+                }
+
+                // Load ambient occlusion texture
+                if (data->materials[i].occlusion_texture.texture)
+                {
+                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
+                    if (imOcclusion.data != NULL)
+                    {
+                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
+                        UnloadImage(imOcclusion);
+                    }
+                }
+
+                // Load emissive texture
+                if (data->materials[i].emissive_texture.texture)
+                {
+                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
+                    if (imEmissive.data != NULL)
+                    {
+                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
+                        UnloadImage(imEmissive);
+                    }
+
+                    // Load emissive color factor
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.g = (unsigned char)(data->materials[i].emissive_factor[1]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.b = (unsigned char)(data->materials[i].emissive_factor[2]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.a = 255;
+                }
+            }
+
+            // Other possible materials not supported by raylib pipeline:
+            // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
+        }
+
+        // Load meshes data
+        //----------------------------------------------------------------------------------------------------
+        for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
+        {
+            // NOTE: meshIndex accumulates primitives
+
+            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            {
+                // NOTE: We only support primitives defined by triangles
+                // Other alternatives: points, lines, line_strip, triangle_strip
+                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
+
+                // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
+                // Only some formats for each attribute type are supported, read info at the top of this function!
+
+                for (unsigned int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
+                {
+                    // Check the different attributes for every primitive
+                    if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_position)      // POSITION
+                    {
+                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+
+                        // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined.
+
+                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
+                        {
+                            // Init raylib mesh vertices to copy glTF attribute data
+                            model.meshes[meshIndex].vertexCount = (int)attribute->count;
+                            model.meshes[meshIndex].vertices = RL_MALLOC(attribute->count*3*sizeof(float));
+
+                            // Load 3 components of float data type into mesh.vertices
+                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
+                        }
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
+                    }
+                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_normal)   // NORMAL
+                    {
+                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+
+                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
+                        {
+                            // Init raylib mesh normals to copy glTF attribute data
+                            model.meshes[meshIndex].normals = RL_MALLOC(attribute->count*3*sizeof(float));
+
+                            // Load 3 components of float data type into mesh.normals
+                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
+                        }
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
+                    }
+                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT
+                    {
+                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+
+                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
+                        {
+                            // Init raylib mesh tangent to copy glTF attribute data
+                            model.meshes[meshIndex].tangents = RL_MALLOC(attribute->count*4*sizeof(float));
+
+                            // Load 4 components of float data type into mesh.tangents
+                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].tangents)
+                        }
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
+                    }
+                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_0
+                    {
+                        // TODO: Support additional texture coordinates: TEXCOORD_1 -> mesh.texcoords2
+
+                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+
+                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec2))
+                        {
+                            // Init raylib mesh texcoords to copy glTF attribute data
+                            model.meshes[meshIndex].texcoords = RL_MALLOC(attribute->count*2*sizeof(float));
+
+                            // Load 3 components of float data type into mesh.texcoords
+                            LOAD_ATTRIBUTE(attribute, 2, float, model.meshes[meshIndex].texcoords)
+                        }
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
+                    }
+                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_color)    // COLOR_0
+                    {
+                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+
+                        // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range.
+
+                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
+                        {
+                            // Init raylib mesh color to copy glTF attribute data
+                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                            // Load 4 components of unsigned char data type into mesh.colors
+                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].colors)
+                        }
+                        else if ((attribute->component_type == cgltf_component_type_r_16u) && (attribute->type == cgltf_type_vec4))
+                        {
+                            // Init raylib mesh color to copy glTF attribute data
+                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                            // Load data into a temp buffer to be converted to raylib data type
+                            unsigned short *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned short));
+                            LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
+
+                            // Convert data to raylib color data type (4 bytes)
+                            for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
+
+                            RL_FREE(temp);
+                        }
+                        else if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
+                        {
+                            // Init raylib mesh color to copy glTF attribute data
+                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                            // Load data into a temp buffer to be converted to raylib data type
+                            float *temp = RL_MALLOC(attribute->count*4*sizeof(float));
+                            LOAD_ATTRIBUTE(attribute, 4, float, temp);
+
+                            // Convert data to raylib color data type (4 bytes), we expect the color data normalized
+                            for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(temp[c]*255.0f);
+
+                            RL_FREE(temp);
+                        }
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+                    }
+
+                    // NOTE: Attributes related to animations are processed separately
+                }
+
+                // Load primitive indices data (if provided)
+                if (data->meshes[i].primitives[p].indices != NULL)
+                {
+                    cgltf_accessor *attribute = data->meshes[i].primitives[p].indices;
+
+                    model.meshes[meshIndex].triangleCount = (int)attribute->count/3;
+
+                    if (attribute->component_type == cgltf_component_type_r_16u)
+                    {
+                        // Init raylib mesh indices to copy glTF attribute data
+                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+
+                        // Load unsigned short data type into mesh.indices
+                        LOAD_ATTRIBUTE(attribute, 1, unsigned short, model.meshes[meshIndex].indices)
+                    }
+                    else if (attribute->component_type == cgltf_component_type_r_32u)
+                    {
+                        // Init raylib mesh indices to copy glTF attribute data
+                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+
+                        // Load data into a temp buffer to be converted to raylib data type
+                        unsigned int *temp = RL_MALLOC(attribute->count*sizeof(unsigned int));
+                        LOAD_ATTRIBUTE(attribute, 1, unsigned int, temp);
+
+                        // Convert data to raylib indices data type (unsigned short)
+                        for (unsigned int d = 0; d < attribute->count; d++) model.meshes[meshIndex].indices[d] = (unsigned short)temp[d];
+
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
+
+                        RL_FREE(temp);
+                    }
+                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
+                }
+                else model.meshes[meshIndex].triangleCount = model.meshes[meshIndex].vertexCount/3;    // Unindexed mesh
+
+                // Assign to the primitive mesh the corresponding material index
+                // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
+                for (unsigned int m = 0; m < data->materials_count; m++)
+                {
+                    // The primitive actually keeps the pointer to the corresponding material,
+                    // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
+                    // To get the index, we check if material pointers match, and we assign the corresponding index,
+                    // skipping index 0, the default material
+                    if (&data->materials[m] == data->meshes[i].primitives[p].material)
+                    {
+                        model.meshMaterial[meshIndex] = m + 1;
+                        break;
+                    }
+                }
+
+                meshIndex++;       // Move to next mesh
+            }
+        }
+
+        // Load glTF meshes animation data
+        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skins
+        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skinned-mesh-attributes
+        //
+        // LIMITATIONS:
+        //  - Only supports 1 armature per file, and skips loading it if there are multiple armatures
+        //  - Only supports linear interpolation (default method in Blender when checked "Always Sample Animations" when exporting a GLTF file)
+        //  - Only supports translation/rotation/scale animation channel.path, weights not considered (i.e. morph targets)
+        //----------------------------------------------------------------------------------------------------
+        if (data->skins_count == 1)
+        {
+            cgltf_skin skin = data->skins[0];
+            model.bones = LoadBoneInfoGLTF(skin, &model.boneCount);
+            model.bindPose = RL_MALLOC(model.boneCount*sizeof(Transform));
+
+            for (int i = 0; i < model.boneCount; i++)
+            {
+                cgltf_node node = *skin.joints[i];
+                model.bindPose[i].translation.x = node.translation[0];
+                model.bindPose[i].translation.y = node.translation[1];
+                model.bindPose[i].translation.z = node.translation[2];
+
+                model.bindPose[i].rotation.x = node.rotation[0];
+                model.bindPose[i].rotation.y = node.rotation[1];
+                model.bindPose[i].rotation.z = node.rotation[2];
+                model.bindPose[i].rotation.w = node.rotation[3];
+
+                model.bindPose[i].scale.x = node.scale[0];
+                model.bindPose[i].scale.y = node.scale[1];
+                model.bindPose[i].scale.z = node.scale[2];
+            }
+
+            BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
+        }
+        else if (data->skins_count > 1)
+        {
+            TRACELOG(LOG_ERROR, "MODEL: [%s] can only load one skin (armature) per model, but gltf skins_count == %i", fileName, data->skins_count);
+        }
+
+        for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
+        {
+            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            {
+                // NOTE: We only support primitives defined by triangles
+                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
+
+                for (unsigned int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
+                {
+                    // NOTE: JOINTS_1 + WEIGHT_1 will be used for +4 joints influencing a vertex -> Not supported by raylib
+
+                    if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_joints)        // JOINTS_n (vec4: 4 bones max per vertex / u8, u16)
+                    {
+                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+
+                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
+                        {
+                            // Init raylib mesh bone ids to copy glTF attribute data
+                            model.meshes[meshIndex].boneIds = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
+
+                            // Load 4 components of unsigned char data type into mesh.boneIds
+                            // for cgltf_attribute_type_joints we have:
+                            //   - data.meshes[0] (256 vertices)
+                            //   - 256 values, provided as cgltf_type_vec4 of bytes (4 byte per joint, stride 4)
+                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].boneIds)
+                        }
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported, use vec4 u8", fileName);
+                    }
+                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_weights)  // WEIGHTS_n (vec4 / u8, u16, f32)
+                    {
+                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+
+                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
+                        {
+                            // Init raylib mesh bone weight to copy glTF attribute data
+                            model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
+
+                            // Load 4 components of float data type into mesh.boneWeights
+                            // for cgltf_attribute_type_weights we have:
+                            //   - data.meshes[0] (256 vertices)
+                            //   - 256 values, provided as cgltf_type_vec4 of float (4 byte per joint, stride 16)
+                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].boneWeights)
+                        }
+                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
+                    }
+                }
+
+                // Animated vertex data
+                model.meshes[meshIndex].animVertices = RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
+                memcpy(model.meshes[meshIndex].animVertices, model.meshes[meshIndex].vertices, model.meshes[meshIndex].vertexCount*3*sizeof(float));
+                model.meshes[meshIndex].animNormals = RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
+                if (model.meshes[meshIndex].normals != NULL) {
+                    memcpy(model.meshes[meshIndex].animNormals, model.meshes[meshIndex].normals, model.meshes[meshIndex].vertexCount*3*sizeof(float));
+                }
+
+                meshIndex++;       // Move to next mesh
+            }
+
+        }
+
+        // Free all cgltf loaded data
+        cgltf_free(data);
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+
+    // WARNING: cgltf requires the file pointer available while reading data
+    UnmapFileData(fileData, dataSize);
+
+    return model;
+}
+
+// Get interpolated pose for bone sampler at a specific time. Returns true on success.
+static bool GetPoseAtTimeGLTF(cgltf_accessor *input, cgltf_accessor *output, float time, void *data)
+{
+    // Input and output should have the same count
+    float tstart = 0.0f;
+    float tend = 0.0f;
+    int keyframe = 0;       // Defaults to first pose
+
+    for (int i = 0; i < input->count - 1; i++)
+    {
+        cgltf_bool r1 = cgltf_accessor_read_float(input, i, &tstart, 1);
+        if (!r1) return false;
+
+        cgltf_bool r2 = cgltf_accessor_read_float(input, i + 1, &tend, 1);
+        if (!r2) return false;
+
+        if ((tstart <= time) && (time < tend))
+        {
+            keyframe = i;
+            break;
+        }
+    }
+
+    float t = (time - tstart)/(tend - tstart);
+    t = (t < 0.0f)? 0.0f : t;
+    t = (t > 1.0f)? 1.0f : t;
+
+    if (output->component_type != cgltf_component_type_r_32f) return false;
+
+    if (output->type == cgltf_type_vec3)
+    {
+        float tmp[3] = { 0.0f };
+        cgltf_accessor_read_float(output, keyframe, tmp, 3);
+        Vector3 v1 = {tmp[0], tmp[1], tmp[2]};
+        cgltf_accessor_read_float(output, keyframe+1, tmp, 3);
+        Vector3 v2 = {tmp[0], tmp[1], tmp[2]};
+        Vector3 *r = data;
+        *r = Vector3Lerp(v1, v2, t);
+    }
+    else if (output->type == cgltf_type_vec4)
+    {
+        float tmp[4] = { 0.0f };
+        cgltf_accessor_read_float(output, keyframe, tmp, 4);
+        Vector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
+        cgltf_accessor_read_float(output, keyframe+1, tmp, 4);
+        Vector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
+        Vector4 *r = data;
+
+        // Only v4 is for rotations, so we know it's a quat
+        *r = QuaternionSlerp(v1, v2, t);
+    }
+
+    return true;
+}
+
+#define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+
+static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, unsigned int *animCount)
+{
+    // glTF file loading
+    unsigned int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    ModelAnimation *animations = NULL;
+
+    // glTF data loading
+    cgltf_options options = { 0 };
+    cgltf_data *data = NULL;
+    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+
+    if (result != cgltf_result_success)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+        *animCount = 0;
+        return NULL;
+    }
+
+    result = cgltf_load_buffers(&options, data, fileName);
+    if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load animation buffers", fileName);
+
+    if (result == cgltf_result_success)
+    {
+        if (data->skins_count == 1)
+        {
+            cgltf_skin skin = data->skins[0];
+            *animCount = (int)data->animations_count;
+            animations = RL_MALLOC(data->animations_count*sizeof(ModelAnimation));
+
+            for (unsigned int i = 0; i < data->animations_count; i++)
+            {
+                animations[i].bones = LoadBoneInfoGLTF(skin, &animations[i].boneCount);
+
+                cgltf_animation animData = data->animations[i];
+
+                struct Channels {
+                    cgltf_animation_channel *translate;
+                    cgltf_animation_channel *rotate;
+                    cgltf_animation_channel *scale;
+                };
+
+                struct Channels *boneChannels = RL_CALLOC(animations[i].boneCount, sizeof(struct Channels));
+                float animDuration = 0.0f;
+
+                for (unsigned int j = 0; j < animData.channels_count; j++)
+                {
+                    cgltf_animation_channel channel = animData.channels[j];
+                    int boneIndex = -1;
+
+                    for (unsigned int k = 0; k < skin.joints_count; k++)
+                    {
+                        if (animData.channels[j].target_node == skin.joints[k])
+                        {
+                            boneIndex = k;
+                            break;
+                        }
+                    }
+
+                    if (boneIndex == -1)
+                    {
+                        // Animation channel for a node not in the armature
+                        continue;
+                    }
+
+                    if (animData.channels[j].sampler->interpolation == cgltf_interpolation_type_linear)
+                    {
+                        if (channel.target_path == cgltf_animation_path_type_translation)
+                        {
+                            boneChannels[boneIndex].translate = &animData.channels[j];
+                        }
+                        else if (channel.target_path == cgltf_animation_path_type_rotation)
+                        {
+                            boneChannels[boneIndex].rotate = &animData.channels[j];
+                        }
+                        else if (channel.target_path == cgltf_animation_path_type_scale)
+                        {
+                            boneChannels[boneIndex].scale = &animData.channels[j];
+                        }
+                        else
+                        {
+                            TRACELOG(LOG_WARNING, "MODEL: [%s] Unsupported target_path on channel %d's sampler for animation %d. Skipping.", fileName, j, i);
+                        }
+                    }
+                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Only linear interpolation curves are supported for GLTF animation.", fileName);
+
+                    float t = 0.0f;
+                    cgltf_bool r = cgltf_accessor_read_float(channel.sampler->input, channel.sampler->input->count - 1, &t, 1);
+
+                    if (!r)
+                    {
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load input time", fileName);
+                        continue;
+                    }
+
+                    animDuration = (t > animDuration)? t : animDuration;
+                }
+
+                strncpy(animations[i].name, animData.name, sizeof(animations[i].name));
+                animations[i].name[sizeof(animations[i].name) - 1] = '\0';
+
+                animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY);
+                animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(Transform *));
+
+                for (int j = 0; j < animations[i].frameCount; j++)
+                {
+                    animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(Transform));
+                    float time = ((float) j*GLTF_ANIMDELAY)/1000.0f;
+
+                    for (int k = 0; k < animations[i].boneCount; k++)
+                    {
+                        Vector3 translation = {0, 0, 0};
+                        Quaternion rotation = {0, 0, 0, 1};
+                        Vector3 scale = {1, 1, 1};
+
+                        if (boneChannels[k].translate)
+                        {
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
+                            {
+                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
+                            }
+                        }
+
+                        if (boneChannels[k].rotate)
+                        {
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
+                            {
+                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
+                            }
+                        }
+
+                        if (boneChannels[k].scale)
+                        {
+                            if (!GetPoseAtTimeGLTF(boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
+                            {
+                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
+                            }
+                        }
+
+                        animations[i].framePoses[j][k] = (Transform){
+                            .translation = translation,
+                            .rotation = rotation,
+                            .scale = scale
+                        };
+                    }
+
+                    BuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
+                }
+
+                TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, animData.name, animations[i].frameCount, animDuration);
+                RL_FREE(boneChannels);
+            }
+        }
+        else TRACELOG(LOG_ERROR, "MODEL: [%s] expected exactly one skin to load animation data from, but found %i", fileName, data->skins_count);
+
+        cgltf_free(data);
+    }
+    UnloadFileData(fileData);
+    return animations;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_VOX)
+// Load VOX (MagicaVoxel) mesh data
+static Model LoadVOX(const char *fileName)
+{
+    Model model = { 0 };
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = NULL;
+
+    // Map vox file into memory
+    fileData = MapFileData(fileName, &fileSize);
+    if (fileData == 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX file", fileName);
+        return model;
+    }
+
+    // Read voxarray description, vox loader mesh arrays (one quad per visible voxel face) are not built,
+    // voxels are meshed by chunks below
+    VoxArray3D voxarray = { 0 };
+    int ret = Vox_LoadFromMemoryEx(fileData, fileSize, &voxarray, 0);
+
+    if (ret != VOX_SUCCESS)
+    {
+        // Error
+        UnmapFileData(fileData, fileSize);
+
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX data", fileName);
+        return model;
+    }
+
+    // Build models from meshes
+    model.transform = MatrixIdentity();
+
+    model.materialCount = 1;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+
+    // Mesh voxels by chunks with greedy quads merging, chunks meshes are merged into model meshes
+    // while vertex count fits 16bit indices
+    const float voxelSize = 0.25f;      // Voxel size used by vox loader
+    Color palette[256] = { 0 };
+    memcpy(palette, voxarray.palette, sizeof(palette));
+
+    unsigned char voxels[VOXELMAP_CHUNK_PADDED*VOXELMAP_CHUNK_PADDED*VOXELMAP_CHUNK_PADDED] = { 0 };
+    int vertexCount = 0;
+    Mesh *mesh = NULL;
+
+    for (int cz = 0; cz < voxarray.sizeZ; cz += VOXELMAP_CHUNK_SIZE)
+    {
+        for (int cy = 0; cy < voxarray.sizeY; cy += VOXELMAP_CHUNK_SIZE)
+        {
+            for (int cx = 0; cx < voxarray.sizeX; cx += VOXELMAP_CHUNK_SIZE)
+            {
+                for (int z = -1; z <= VOXELMAP_CHUNK_SIZE; z++)
+                {
+                    for (int y = -1; y <= VOXELMAP_CHUNK_SIZE; y++)
+                    {
+                        for (int x = -1; x <= VOXELMAP_CHUNK_SIZE; x++) voxels[VOXEL_CHUNK_INDEX(x, y, z)] = Vox_GetVoxel(&voxarray, cx + x, cy + y, cz + z);
+                    }
+                }
+
+                Mesh chunk = GenMeshVoxelChunk(voxels, palette, (Vector3){ cx*voxelSize, cy*voxelSize, cz*voxelSize }, voxelSize);
+                if (chunk.vertexCount == 0) continue;
+
+                if ((mesh == NULL) || (mesh->vertexCount + chunk.vertexCount > 65536))
+                {
+                    model.meshes = (Mesh *)RL_REALLOC(model.meshes, (model.meshCount + 1)*sizeof(Mesh));
+                    model.meshes[model.meshCount] = chunk;
+                    mesh = &model.meshes[model.meshCount];
+                    model.meshCount++;
+                }
+                else
+                {
+                    // Append chunk mesh data to current mesh, chunk indices are offset by mesh vertex count
+                    int count = mesh->vertexCount + chunk.vertexCount;
+                    mesh->vertices = (float *)RL_REALLOC(mesh->vertices, count*3*sizeof(float));
+                    mesh->normals = (float *)RL_REALLOC(mesh->normals, count*3*sizeof(float));
+                    mesh->colors = (unsigned char *)RL_REALLOC(mesh->colors, count*4*sizeof(unsigned char));
+                    mesh->indices = (unsigned short *)RL_REALLOC(mesh->indices, (mesh->triangleCount + chunk.triangleCount)*3*sizeof(unsigned short));
+
+                    memcpy(mesh->vertices + mesh->vertexCount*3, chunk.vertices, chunk.vertexCount*3*sizeof(float));
+                    memcpy(mesh->normals + mesh->vertexCount*3, chunk.normals, chunk.vertexCount*3*sizeof(float));
+                    memcpy(mesh->colors + mesh->vertexCount*4, chunk.colors, chunk.vertexCount*4*sizeof(unsigned char));
+                    for (int i = 0; i < chunk.triangleCount*3; i++) mesh->indices[mesh->triangleCount*3 + i] = (unsigned short)(mesh->vertexCount + chunk.indices[i]);
+
+                    mesh->vertexCount = count;
+                    mesh->triangleCount += chunk.triangleCount;
+
+                    RL_FREE(chunk.vertices);
+                    RL_FREE(chunk.normals);
+                    RL_FREE(chunk.colors);
+                    RL_FREE(chunk.indices);
+                }
+
+                vertexCount += chunk.vertexCount;
+            }
+        }
+    }
+
+    model.meshMaterial = (int *)RL_CALLOC((model.meshCount > 0)? model.meshCount : 1, sizeof(int));
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] VOX data loaded successfully : %i vertices/%i meshes", fileName, vertexCount, model.meshCount);
+
+    // Free buffers
+    Vox_FreeArrays(&voxarray);
+    UnmapFileData(fileData, fileSize);
+
+    return model;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_M3D)
+// Hook LoadFileData()/UnloadFileData() calls to M3D loaders
+unsigned char *m3d_loaderhook(char *fn, unsigned int *len) { return LoadFileData((const char *)fn, len); }
+void m3d_freehook(void *data) { UnloadFileData((unsigned char *)data); }
+
+// Load M3D mesh data
+static Model LoadM3D(const char *fileName)
+{
+    Model model = { 0 };
+
+    m3d_t *m3d = NULL;
+    m3dp_t *prop = NULL;
+    unsigned int bytesRead = 0;
+    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
+    int i, j, k, l, n, mi = -2;
+
+    if (fileData != NULL)
+    {
+        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
+
+        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
+            if (m3d) m3d_free(m3d);
+            UnloadFileData(fileData);
+            return model;
+        }
+        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i faces/%i materials", fileName, m3d->numface, m3d->nummaterial);
+
+        // no face? this is probably just a material library
+        if (!m3d->numface)
+        {
+            m3d_free(m3d);
+            UnloadFileData(fileData);
+            return model;
+        }
+
+        if (m3d->nummaterial > 0)
+        {
+            model.meshCount = model.materialCount = m3d->nummaterial;
+            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", model.materialCount);
+        }
+        else
+        {
+            model.meshCount = model.materialCount = 1;
+            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
+        }
+
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+        model.materials = (Material *)RL_CALLOC(model.materialCount + 1, sizeof(Material));
+
+        // Map no material to index 0 with default shader, everything else materialid + 1
+        model.materials[0] = LoadMaterialDefault();
+
+        for (i = l = 0, k = -1; i < (int)m3d->numface; i++, l++)
+        {
+            // Materials are grouped together
+            if (mi != m3d->face[i].materialid)
+            {
+                // there should be only one material switch per material kind, but be bulletproof for non-optimal model files
+                if (k + 1 >= model.meshCount)
+                {
+                    model.meshCount++;
+                    model.meshes = (Mesh *)RL_REALLOC(model.meshes, model.meshCount*sizeof(Mesh));
+                    memset(&model.meshes[model.meshCount - 1], 0, sizeof(Mesh));
+                    model.meshMaterial = (int *)RL_REALLOC(model.meshMaterial, model.meshCount*sizeof(int));
+                }
+
+                k++;
+                mi = m3d->face[i].materialid;
+
+                for (j = i, l = 0; (j < (int)m3d->numface) && (mi == m3d->face[j].materialid); j++, l++);
+
+                model.meshes[k].vertexCount = l*3;
+                model.meshes[k].triangleCount = l;
+                model.meshes[k].vertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+                model.meshes[k].texcoords = (float *)RL_CALLOC(model.meshes[k].vertexCount*2, sizeof(float));
+                model.meshes[k].normals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+
+                // If no map is provided, we allocate storage for vertex colors
+                // M3D specs only consider vertex colors if no material is provided
+                if (mi != M3D_UNDEF) model.meshes[k].colors = RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
+
+                if (m3d->numbone && m3d->numskin)
+                {
+                    model.meshes[k].boneIds = (unsigned char *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
+                    model.meshes[k].boneWeights = (float *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(float));
+                    model.meshes[k].animVertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+                    model.meshes[k].animNormals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+                }
+
+                model.meshMaterial[k] = mi + 1;
+                l = 0;
+            }
+
+            // Process meshes per material, add triangles
+            model.meshes[k].vertices[l*9 + 0] = m3d->vertex[m3d->face[i].vertex[0]].x*m3d->scale;
+            model.meshes[k].vertices[l*9 + 1] = m3d->vertex[m3d->face[i].vertex[0]].y*m3d->scale;
+            model.meshes[k].vertices[l*9 + 2] = m3d->vertex[m3d->face[i].vertex[0]].z*m3d->scale;
+            model.meshes[k].vertices[l*9 + 3] = m3d->vertex[m3d->face[i].vertex[1]].x*m3d->scale;
+            model.meshes[k].vertices[l*9 + 4] = m3d->vertex[m3d->face[i].vertex[1]].y*m3d->scale;
+            model.meshes[k].vertices[l*9 + 5] = m3d->vertex[m3d->face[i].vertex[1]].z*m3d->scale;
+            model.meshes[k].vertices[l*9 + 6] = m3d->vertex[m3d->face[i].vertex[2]].x*m3d->scale;
+            model.meshes[k].vertices[l*9 + 7] = m3d->vertex[m3d->face[i].vertex[2]].y*m3d->scale;
+            model.meshes[k].vertices[l*9 + 8] = m3d->vertex[m3d->face[i].vertex[2]].z*m3d->scale;
+
+            // without vertex color (full transparency), we use the default color
+            if (model.meshes[k].colors != NULL)
+            {
+                if (m3d->vertex[m3d->face[i].vertex[0]].color & 0xFF000000)
+                    memcpy(&model.meshes[k].colors[l*12 + 0], &m3d->vertex[m3d->face[i].vertex[0]].color, 4);
+                if (m3d->vertex[m3d->face[i].vertex[1]].color & 0xFF000000)
+                    memcpy(&model.meshes[k].colors[l*12 + 4], &m3d->vertex[m3d->face[i].vertex[1]].color, 4);
+                if (m3d->vertex[m3d->face[i].vertex[2]].color & 0xFF000000)
+                    memcpy(&model.meshes[k].colors[l*12 + 8], &m3d->vertex[m3d->face[i].vertex[2]].color, 4);
+            }
+
+            if (m3d->face[i].texcoord[0] != M3D_UNDEF)
+            {
+                model.meshes[k].texcoords[l*6 + 0] = m3d->tmap[m3d->face[i].texcoord[0]].u;
+                model.meshes[k].texcoords[l*6 + 1] = 1.0f - m3d->tmap[m3d->face[i].texcoord[0]].v;
+                model.meshes[k].texcoords[l*6 + 2] = m3d->tmap[m3d->face[i].texcoord[1]].u;
+                model.meshes[k].texcoords[l*6 + 3] = 1.0f - m3d->tmap[m3d->face[i].texcoord[1]].v;
+                model.meshes[k].texcoords[l*6 + 4] = m3d->tmap[m3d->face[i].texcoord[2]].u;
+                model.meshes[k].texcoords[l*6 + 5] = 1.0f - m3d->tmap[m3d->face[i].texcoord[2]].v;
+            }
+
+            if (m3d->face[i].normal[0] != M3D_UNDEF)
+            {
+                model.meshes[k].normals[l*9 + 0] = m3d->vertex[m3d->face[i].normal[0]].x;
+                model.meshes[k].normals[l*9 + 1] = m3d->vertex[m3d->face[i].normal[0]].y;
+                model.meshes[k].normals[l*9 + 2] = m3d->vertex[m3d->face[i].normal[0]].z;
+                model.meshes[k].normals[l*9 + 3] = m3d->vertex[m3d->face[i].normal[1]].x;
+                model.meshes[k].normals[l*9 + 4] = m3d->vertex[m3d->face[i].normal[1]].y;
+                model.meshes[k].normals[l*9 + 5] = m3d->vertex[m3d->face[i].normal[1]].z;
+                model.meshes[k].normals[l*9 + 6] = m3d->vertex[m3d->face[i].normal[2]].x;
+                model.meshes[k].normals[l*9 + 7] = m3d->vertex[m3d->face[i].normal[2]].y;
+                model.meshes[k].normals[l*9 + 8] = m3d->vertex[m3d->face[i].normal[2]].z;
+            }
+
+            // Add skin (vertex / bone weight pairs)
+            if (m3d->numbone && m3d->numskin)
+            {
+                for (n = 0; n < 3; n++)
+                {
+                    int skinid = m3d->vertex[m3d->face[i].vertex[n]].skinid;
+
+                    // Check if there is a skin for this mesh, should be, just failsafe
+                    if (skinid != M3D_UNDEF && skinid < (int)m3d->numskin)
+                    {
+                        for (j = 0; j < 4; j++)
+                        {
+                            model.meshes[k].boneIds[l*12 + n*4 + j] = m3d->skin[skinid].boneid[j];
+                            model.meshes[k].boneWeights[l*12 + n*4 + j] = m3d->skin[skinid].weight[j];
+                        }
+                    }
+                    else
+                    {
+                        // raylib does not handle boneless meshes with skeletal animations, so
+                        // we put all vertices without a bone into a special "no bone" bone
+                        model.meshes[k].boneIds[l*12 + n*4] = m3d->numbone;
+                        model.meshes[k].boneWeights[l*12 + n*4] = 1.0f;
+                    }
+                }
+            }
+        }
+
+        // Load materials
+        for (i = 0; i < (int)m3d->nummaterial; i++)
+        {
+            model.materials[i + 1] = LoadMaterialDefault();
+
+            for (j = 0; j < m3d->material[i].numprop; j++)
+            {
+                prop = &m3d->material[i].prop[j];
+
+                switch (prop->type)
+                {
+                    case m3dp_Kd:
+                    {
+                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].color, &prop->value.color, 4);
+                        model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
+                    } break;
+                    case m3dp_Ks:
+                    {
+                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].color, &prop->value.color, 4);
+                    } break;
+                    case m3dp_Ns:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].value = prop->value.fnum;
+                    } break;
+                    case m3dp_Ke:
+                    {
+                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].color, &prop->value.color, 4);
+                        model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].value = 0.0f;
+                    } break;
+                    case m3dp_Pm:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_METALNESS].value = prop->value.fnum;
+                    } break;
+                    case m3dp_Pr:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].value = prop->value.fnum;
+                    } break;
+                    case m3dp_Ps:
+                    {
+                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].color = WHITE;
+                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].value = prop->value.fnum;
+                    } break;
+                    default:
+                    {
+                        if (prop->type >= 128)
+                        {
+                            Image image = { 0 };
+                            image.data = m3d->texture[prop->value.textureid].d;
+                            image.width = m3d->texture[prop->value.textureid].w;
+                            image.height = m3d->texture[prop->value.textureid].h;
+                            image.mipmaps = 1;
+                            image.format = (m3d->texture[prop->value.textureid].f == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 :
+                                           ((m3d->texture[prop->value.textureid].f == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 :
+                                           ((m3d->texture[prop->value.textureid].f == 2)? PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE));
 
-                meshIndex++;       // Move to next mesh
+                            switch (prop->type)
+                            {
+                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(image); break;
+                                default: break;
+                            }
+                        }
+                    } break;
+                }
             }
         }
 
-        // Load glTF meshes animation data
-        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skins
-        // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skinned-mesh-attributes
-        //
-        // LIMITATIONS:
-        //  - Only supports 1 armature per file, and skips loading it if there are multiple armatures
-        //  - Only supports linear interpolation (default method in Blender when checked "Always Sample Animations" when exporting a GLTF file)
-        //  - Only supports translation/rotation/scale animation channel.path, weights not considered (i.e. morph targets)
-        //----------------------------------------------------------------------------------------------------
-        if (data->skins_count == 1)
+        // Load bones
+        if (m3d->numbone)
         {
-            cgltf_skin skin = data->skins[0];
-            model.bones = LoadBoneInfoGLTF(skin, &model.boneCount);
-            model.bindPose = RL_MALLOC(model.boneCount*sizeof(Transform));
+            model.boneCount = m3d->numbone + 1;
+            model.bones = RL_CALLOC(model.boneCount, sizeof(BoneInfo));
+            model.bindPose = RL_CALLOC(model.boneCount, sizeof(Transform));
 
-            for (int i = 0; i < model.boneCount; i++)
+            for (i = 0; i < (int)m3d->numbone; i++)
             {
-                cgltf_node node = *skin.joints[i];
-                model.bindPose[i].translation.x = node.translation[0];
-                model.bindPose[i].translation.y = node.translation[1];
-                model.bindPose[i].translation.z = node.translation[2];
+                model.bones[i].parent = m3d->bone[i].parent;
+                strncpy(model.bones[i].name, m3d->bone[i].name, sizeof(model.bones[i].name));
+                model.bindPose[i].translation.x = m3d->vertex[m3d->bone[i].pos].x*m3d->scale;
+                model.bindPose[i].translation.y = m3d->vertex[m3d->bone[i].pos].y*m3d->scale;
+                model.bindPose[i].translation.z = m3d->vertex[m3d->bone[i].pos].z*m3d->scale;
+                model.bindPose[i].rotation.x = m3d->vertex[m3d->bone[i].ori].x;
+                model.bindPose[i].rotation.y = m3d->vertex[m3d->bone[i].ori].y;
+                model.bindPose[i].rotation.z = m3d->vertex[m3d->bone[i].ori].z;
+                model.bindPose[i].rotation.w = m3d->vertex[m3d->bone[i].ori].w;
 
-                model.bindPose[i].rotation.x = node.rotation[0];
-                model.bindPose[i].rotation.y = node.rotation[1];
-                model.bindPose[i].rotation.z = node.rotation[2];
-                model.bindPose[i].rotation.w = node.rotation[3];
+                // TODO: If the orientation quaternion is not normalized, then that's encoding scaling
+                model.bindPose[i].rotation = QuaternionNormalize(model.bindPose[i].rotation);
+                model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
 
-                model.bindPose[i].scale.x = node.scale[0];
-                model.bindPose[i].scale.y = node.scale[1];
-                model.bindPose[i].scale.z = node.scale[2];
+                // Child bones are stored in parent bone relative space, convert that into model space
+                if (model.bones[i].parent >= 0)
+                {
+                    model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
+                    model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
+                    model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
+                    model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
+                }
             }
 
-            BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
-        }
-        else if (data->skins_count > 1)
-        {
-            TRACELOG(LOG_ERROR, "MODEL: [%s] can only load one skin (armature) per model, but gltf skins_count == %i", fileName, data->skins_count);
+            // Add a special "no bone" bone
+            model.bones[i].parent = -1;
+            strcpy(model.bones[i].name, "NO BONE");
+            model.bindPose[i].translation.x = 0.0f;
+            model.bindPose[i].translation.y = 0.0f;
+            model.bindPose[i].translation.z = 0.0f;
+            model.bindPose[i].rotation.x = 0.0f;
+            model.bindPose[i].rotation.y = 0.0f;
+            model.bindPose[i].rotation.z = 0.0f;
+            model.bindPose[i].rotation.w = 1.0f;
+            model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
         }
 
-        for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
+        // Load bone-pose default mesh into animation vertices. These will be updated when UpdateModelAnimation gets
+        // called, but not before, however DrawMesh uses these if they exist (so not good if they are left empty).
+        if (m3d->numbone && m3d->numskin)
         {
-            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            for(i = 0; i < model.meshCount; i++)
             {
-                // NOTE: We only support primitives defined by triangles
-                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
-
-                for (unsigned int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
-                {
-                    // NOTE: JOINTS_1 + WEIGHT_1 will be used for +4 joints influencing a vertex -> Not supported by raylib
+                memcpy(model.meshes[i].animVertices, model.meshes[i].vertices, model.meshes[i].vertexCount*3*sizeof(float));
+                memcpy(model.meshes[i].animNormals, model.meshes[i].normals, model.meshes[i].vertexCount*3*sizeof(float));
+            }
+        }
 
-                    if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_joints)        // JOINTS_n (vec4: 4 bones max per vertex / u8, u16)
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+        m3d_free(m3d);
+        UnloadFileData(fileData);
+    }
 
-                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh bone ids to copy glTF attribute data
-                            model.meshes[meshIndex].boneIds = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
+    return model;
+}
 
-                            // Load 4 components of unsigned char data type into mesh.boneIds
-                            // for cgltf_attribute_type_joints we have:
-                            //   - data.meshes[0] (256 vertices)
-                            //   - 256 values, provided as cgltf_type_vec4 of bytes (4 byte per joint, stride 4)
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].boneIds)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported, use vec4 u8", fileName);
-                    }
-                    else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_weights)  // WEIGHTS_n (vec4 / u8, u16, f32)
-                    {
-                        cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
+#define M3D_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh bone weight to copy glTF attribute data
-                            model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
+// Load M3D animation data
+static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, unsigned int *animCount)
+{
+    m3d_t *m3d = NULL;
+    unsigned int bytesRead = 0;
+    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
+    ModelAnimation *animations = NULL;
+    int i = 0, j = 0;
 
-                            // Load 4 components of float data type into mesh.boneWeights
-                            // for cgltf_attribute_type_weights we have:
-                            //   - data.meshes[0] (256 vertices)
-                            //   - 256 values, provided as cgltf_type_vec4 of float (4 byte per joint, stride 16)
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].boneWeights)
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
-                    }
-                }
+    *animCount = 0;
 
-                // Animated vertex data
-                model.meshes[meshIndex].animVertices = RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
-                memcpy(model.meshes[meshIndex].animVertices, model.meshes[meshIndex].vertices, model.meshes[meshIndex].vertexCount*3*sizeof(float));
-                model.meshes[meshIndex].animNormals = RL_CALLOC(model.meshes[meshIndex].vertexCount*3, sizeof(float));
-                if (model.meshes[meshIndex].normals != NULL) {
-                    memcpy(model.meshes[meshIndex].animNormals, model.meshes[meshIndex].normals, model.meshes[meshIndex].vertexCount*3*sizeof(float));
-                }
+    if (fileData != NULL)
+    {
+        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
 
-                meshIndex++;       // Move to next mesh
-            }
+        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
+            UnloadFileData(fileData);
+            return NULL;
+        }
+        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i animations, %i bones, %i skins", fileName,
+            m3d->numaction, m3d->numbone, m3d->numskin);
 
+        // No animation or bone+skin?
+        if (!m3d->numaction || !m3d->numbone || !m3d->numskin)
+        {
+            m3d_free(m3d);
+            UnloadFileData(fileData);
+            return NULL;
         }
 
-        // Free all cgltf loaded data
-        cgltf_free(data);
-    }
-    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+        animations = RL_MALLOC(m3d->numaction*sizeof(ModelAnimation));
+        *animCount = m3d->numaction;
 
-    // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+        for (unsigned int a = 0; a < m3d->numaction; a++)
+        {
+            animations[a].frameCount = m3d->action[a].durationmsec / M3D_ANIMDELAY;
+            animations[a].boneCount = m3d->numbone + 1;
+            animations[a].bones = RL_MALLOC((m3d->numbone + 1)*sizeof(BoneInfo));
+            animations[a].framePoses = RL_MALLOC(animations[a].frameCount*sizeof(Transform *));
+            // strncpy(animations[a].name, m3d->action[a].name, sizeof(animations[a].name));
+            TRACELOG(LOG_INFO, "MODEL: [%s] animation #%i: %i msec, %i frames", fileName, a, m3d->action[a].durationmsec, animations[a].frameCount);
 
-    return model;
-}
+            for (i = 0; i < (int)m3d->numbone; i++)
+            {
+                animations[a].bones[i].parent = m3d->bone[i].parent;
+                strncpy(animations[a].bones[i].name, m3d->bone[i].name, sizeof(animations[a].bones[i].name));
+            }
 
-// Get interpolated pose for bone sampler at a specific time. Returns true on success.
-static bool GetPoseAtTimeGLTF(cgltf_accessor *input, cgltf_accessor *output, float time, void *data)
-{
-    // Input and output should have the same count
-    float tstart = 0.0f;
-    float tend = 0.0f;
-    int keyframe = 0;       // Defaults to first pose
+            // A special, never transformed "no bone" bone, used for boneless vertices
+            animations[a].bones[i].parent = -1;
+            strcpy(animations[a].bones[i].name, "NO BONE");
 
-    for (int i = 0; i < input->count - 1; i++)
-    {
-        cgltf_bool r1 = cgltf_accessor_read_float(input, i, &tstart, 1);
-        if (!r1) return false;
+            // M3D stores frames at arbitrary intervals with sparse skeletons. We need full skeletons at
+            // regular intervals, so let the M3D SDK do the heavy lifting and calculate interpolated bones
+            for (i = 0; i < animations[a].frameCount; i++)
+            {
+                animations[a].framePoses[i] = RL_MALLOC((m3d->numbone + 1)*sizeof(Transform));
 
-        cgltf_bool r2 = cgltf_accessor_read_float(input, i + 1, &tend, 1);
-        if (!r2) return false;
+                m3db_t *pose = m3d_pose(m3d, a, i*M3D_ANIMDELAY);
 
-        if ((tstart <= time) && (time < tend))
-        {
-            keyframe = i;
-            break;
+                if (pose != NULL)
+                {
+                    for (j = 0; j < (int)m3d->numbone; j++)
+                    {
+                        animations[a].framePoses[i][j].translation.x = m3d->vertex[pose[j].pos].x*m3d->scale;
+                        animations[a].framePoses[i][j].translation.y = m3d->vertex[pose[j].pos].y*m3d->scale;
+                        animations[a].framePoses[i][j].translation.z = m3d->vertex[pose[j].pos].z*m3d->scale;
+                        animations[a].framePoses[i][j].rotation.x = m3d->vertex[pose[j].ori].x;
+                        animations[a].framePoses[i][j].rotation.y = m3d->vertex[pose[j].ori].y;
+                        animations[a].framePoses[i][j].rotation.z = m3d->vertex[pose[j].ori].z;
+                        animations[a].framePoses[i][j].rotation.w = m3d->vertex[pose[j].ori].w;
+                        animations[a].framePoses[i][j].rotation = QuaternionNormalize(animations[a].framePoses[i][j].rotation);
+                        animations[a].framePoses[i][j].scale.x = animations[a].framePoses[i][j].scale.y = animations[a].framePoses[i][j].scale.z = 1.0f;
+
+                        // Child bones are stored in parent bone relative space, convert that into model space
+                        if (animations[a].bones[j].parent >= 0)
+                        {
+                            animations[a].framePoses[i][j].rotation = QuaternionMultiply(animations[a].framePoses[i][animations[a].bones[j].parent].rotation, animations[a].framePoses[i][j].rotation);
+                            animations[a].framePoses[i][j].translation = Vector3RotateByQuaternion(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].rotation);
+                            animations[a].framePoses[i][j].translation = Vector3Add(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].translation);
+                            animations[a].framePoses[i][j].scale = Vector3Multiply(animations[a].framePoses[i][j].scale, animations[a].framePoses[i][animations[a].bones[j].parent].scale);
+                        }
+                    }
+
+                    // Default transform for the "no bone" bone
+                    animations[a].framePoses[i][j].translation.x = 0.0f;
+                    animations[a].framePoses[i][j].translation.y = 0.0f;
+                    animations[a].framePoses[i][j].translation.z = 0.0f;
+                    animations[a].framePoses[i][j].rotation.x = 0.0f;
+                    animations[a].framePoses[i][j].rotation.y = 0.0f;
+                    animations[a].framePoses[i][j].rotation.z = 0.0f;
+                    animations[a].framePoses[i][j].rotation.w = 1.0f;
+                    animations[a].framePoses[i][j].scale.x = animations[a].framePoses[i][j].scale.y = animations[a].framePoses[i][j].scale.z = 1.0f;
+                    RL_FREE(pose);
+                }
+            }
         }
-    }
-
-    float t = (time - tstart)/(tend - tstart);
-    t = (t < 0.0f)? 0.0f : t;
-    t = (t > 1.0f)? 1.0f : t;
-
-    if (output->component_type != cgltf_component_type_r_32f) return false;
-
-    if (output->type == cgltf_type_vec3)
-    {
-        float tmp[3] = { 0.0f };
-        cgltf_accessor_read_float(output, keyframe, tmp, 3);
-        Vector3 v1 = {tmp[0], tmp[1], tmp[2]};
-        cgltf_accessor_read_float(output, keyframe+1, tmp, 3);
-        Vector3 v2 = {tmp[0], tmp[1], tmp[2]};
-        Vector3 *r = data;
-        *r = Vector3Lerp(v1, v2, t);
-    }
-    else if (output->type == cgltf_type_vec4)
-    {
-        float tmp[4] = { 0.0f };
-        cgltf_accessor_read_float(output, keyframe, tmp, 4);
-        Vector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-        cgltf_accessor_read_float(output, keyframe+1, tmp, 4);
-        Vector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-        Vector4 *r = data;
 
-        // Only v4 is for rotations, so we know it's a quat
-        *r = QuaternionSlerp(v1, v2, t);
+        m3d_free(m3d);
+        UnloadFileData(fileData);
     }
 
-    return true;
+    return animations;
 }
+#endif
 
-#define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
 
-static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, unsigned int *animCount)
+// Get box tree node bounds
+static inline BoundingBox GetBoxTreeNodeBounds(const BoundsTreeNode *node)
 {
-    // glTF file loading
-    unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
-
-    ModelAnimation *animations = NULL;
+    BoundingBox bounds = { { node->min[0], node->min[1], node->min[2] }, { node->max[0], node->max[1], node->max[2] } };
+    return bounds;
+}
 
-    // glTF data loading
-    cgltf_options options = { 0 };
-    cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+// Get closest box hit by ray, nodes are visited front to back and skipped when farther than closest hit
+static RayCollision CastBoxTreeRay(BoxTreeState *state, Ray ray, int *userId)
+{
+    RayCollision collision = { 0 };
+    collision.distance = FLT_MAX;
 
-    if (result != cgltf_result_success)
+    if (state->tree.root == -1)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
-        *animCount = 0;
-        return NULL;
+        collision.distance = 0.0f;
+        return collision;
     }
 
-    result = cgltf_load_buffers(&options, data, fileName);
-    if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load animation buffers", fileName);
+    Vector3 invDir = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
 
-    if (result == cgltf_result_success)
-    {
-        if (data->skins_count == 1)
-        {
-            cgltf_skin skin = data->skins[0];
-            *animCount = (int)data->animations_count;
-            animations = RL_MALLOC(data->animations_count*sizeof(ModelAnimation));
+    int *stack = state->tree.stack;
+    int stackSize = 0;
+    stack[stackSize++] = state->tree.root;
 
-            for (unsigned int i = 0; i < data->animations_count; i++)
-            {
-                animations[i].bones = LoadBoneInfoGLTF(skin, &animations[i].boneCount);
+    while (stackSize > 0)
+    {
+        BoundsTreeNode *node = &state->tree.nodes[stack[--stackSize]];
 
-                cgltf_animation animData = data->animations[i];
+        // Slab test against node bounds, entry distance clamped to ray origin
+        float tx1 = (node->min[0] - ray.position.x)*invDir.x;
+        float tx2 = (node->max[0] - ray.position.x)*invDir.x;
+        float ty1 = (node->min[1] - ray.position.y)*invDir.y;
+        float ty2 = (node->max[1] - ray.position.y)*invDir.y;
+        float tz1 = (node->min[2] - ray.position.z)*invDir.z;
+        float tz2 = (node->max[2] - ray.position.z)*invDir.z;
 
-                struct Channels {
-                    cgltf_animation_channel *translate;
-                    cgltf_animation_channel *rotate;
-                    cgltf_animation_channel *scale;
-                };
+        float tmin = fmaxf(fmaxf(fminf(tx1, tx2), fminf(ty1, ty2)), fmaxf(fminf(tz1, tz2), 0.0f));
+        float tmax = fminf(fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2)), fmaxf(tz1, tz2));
 
-                struct Channels *boneChannels = RL_CALLOC(animations[i].boneCount, sizeof(struct Channels));
-                float animDuration = 0.0f;
+        // NOTE: NaN values (ray parallel to a slab, origin on its plane) do not reject node
+        if ((tmin > tmax) || (tmin > collision.distance)) continue;
 
-                for (unsigned int j = 0; j < animData.channels_count; j++)
-                {
-                    cgltf_animation_channel channel = animData.channels[j];
-                    int boneIndex = -1;
+        if (node->child1 == -1)
+        {
+            RayCollision boxCollision = GetRayCollisionBox(ray, state->boxes[node->item].bounds);
 
-                    for (unsigned int k = 0; k < skin.joints_count; k++)
-                    {
-                        if (animData.channels[j].target_node == skin.joints[k])
-                        {
-                            boneIndex = k;
-                            break;
-                        }
-                    }
+            if (boxCollision.hit && (boxCollision.distance >= 0.0f) && (boxCollision.distance < collision.distance))
+            {
+                collision = boxCollision;
+                if (userId != NULL) *userId = state->boxes[node->item].userId;
+            }
+        }
+        else
+        {
+            // Push farther child first so closer child is visited first
+            BoundingBox bounds1 = GetBoxTreeNodeBounds(&state->tree.nodes[node->child1]);
+            BoundingBox bounds2 = GetBoxTreeNodeBounds(&state->tree.nodes[node->child2]);
+            Vector3 center1 = Vector3Subtract(Vector3Lerp(bounds1.min, bounds1.max, 0.5f), ray.position);
+            Vector3 center2 = Vector3Subtract(Vector3Lerp(bounds2.min, bounds2.max, 0.5f), ray.position);
 
-                    if (boneIndex == -1)
-                    {
-                        // Animation channel for a node not in the armature
-                        continue;
-                    }
+            if (Vector3DotProduct(center1, ray.direction) < Vector3DotProduct(center2, ray.direction))
+            {
+                stack[stackSize++] = node->child2;
+                stack[stackSize++] = node->child1;
+            }
+            else
+            {
+                stack[stackSize++] = node->child1;
+                stack[stackSize++] = node->child2;
+            }
+        }
+    }
 
-                    if (animData.channels[j].sampler->interpolation == cgltf_interpolation_type_linear)
-                    {
-                        if (channel.target_path == cgltf_animation_path_type_translation)
-                        {
-                            boneChannels[boneIndex].translate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_rotation)
-                        {
-                            boneChannels[boneIndex].rotate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_scale)
-                        {
-                            boneChannels[boneIndex].scale = &animData.channels[j];
-                        }
-                        else
-                        {
-                            TRACELOG(LOG_WARNING, "MODEL: [%s] Unsupported target_path on channel %d's sampler for animation %d. Skipping.", fileName, j, i);
-                        }
-                    }
-                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Only linear interpolation curves are supported for GLTF animation.", fileName);
+    if (!collision.hit) collision.distance = 0.0f;
 
-                    float t = 0.0f;
-                    cgltf_bool r = cgltf_accessor_read_float(channel.sampler->input, channel.sampler->input->count - 1, &t, 1);
+    return collision;
+}
 
-                    if (!r)
-                    {
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load input time", fileName);
-                        continue;
-                    }
+// Mesh tangents job range work, compute triangles tangent and bitangent directions from positions and texcoords
+static void MeshTangentsFacesWork(void *data, int start, int end)
+{
+    MeshTangentsJob *job = (MeshTangentsJob *)data;
+    const Mesh *mesh = job->mesh;
 
-                    animDuration = (t > animDuration)? t : animDuration;
-                }
+    for (int t = start; t < end; t++)
+    {
+        int i1 = (mesh->indices != NULL)? mesh->indices[t*3 + 0] : t*3 + 0;
+        int i2 = (mesh->indices != NULL)? mesh->indices[t*3 + 1] : t*3 + 1;
+        int i3 = (mesh->indices != NULL)? mesh->indices[t*3 + 2] : t*3 + 2;
 
-                strncpy(animations[i].name, animData.name, sizeof(animations[i].name));
-                animations[i].name[sizeof(animations[i].name) - 1] = '\0';
+        // Get triangle vertices
+        Vector3 v1 = { mesh->vertices[i1*3 + 0], mesh->vertices[i1*3 + 1], mesh->vertices[i1*3 + 2] };
+        Vector3 v2 = { mesh->vertices[i2*3 + 0], mesh->vertices[i2*3 + 1], mesh->vertices[i2*3 + 2] };
+        Vector3 v3 = { mesh->vertices[i3*3 + 0], mesh->vertices[i3*3 + 1], mesh->vertices[i3*3 + 2] };
 
-                animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY);
-                animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(Transform *));
+        // Get triangle texcoords
+        Vector2 uv1 = { mesh->texcoords[i1*2 + 0], mesh->texcoords[i1*2 + 1] };
+        Vector2 uv2 = { mesh->texcoords[i2*2 + 0], mesh->texcoords[i2*2 + 1] };
+        Vector2 uv3 = { mesh->texcoords[i3*2 + 0], mesh->texcoords[i3*2 + 1] };
 
-                for (int j = 0; j < animations[i].frameCount; j++)
-                {
-                    animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(Transform));
-                    float time = ((float) j*GLTF_ANIMDELAY)/1000.0f;
+        float x1 = v2.x - v1.x;
+        float y1 = v2.y - v1.y;
+        float z1 = v2.z - v1.z;
+        float x2 = v3.x - v1.x;
+        float y2 = v3.y - v1.y;
+        float z2 = v3.z - v1.z;
 
-                    for (int k = 0; k < animations[i].boneCount; k++)
-                    {
-                        Vector3 translation = {0, 0, 0};
-                        Quaternion rotation = {0, 0, 0, 1};
-                        Vector3 scale = {1, 1, 1};
+        float s1 = uv2.x - uv1.x;
+        float t1 = uv2.y - uv1.y;
+        float s2 = uv3.x - uv1.x;
+        float t2 = uv3.y - uv1.y;
 
-                        if (boneChannels[k].translate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+        float div = s1*t2 - s2*t1;
+        float r = (div == 0.0f)? 0.0f : 1.0f/div;
 
-                        if (boneChannels[k].rotate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+        job->faceTangents[t*2 + 0] = (Vector3){ (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
+        job->faceTangents[t*2 + 1] = (Vector3){ (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+    }
+}
 
-                        if (boneChannels[k].scale)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+// Mesh tangents job range work, accumulate vertices tangents from their triangles and orthonormalize them with normals
+static void MeshTangentsVerticesWork(void *data, int start, int end)
+{
+    MeshTangentsJob *job = (MeshTangentsJob *)data;
+    const Mesh *mesh = job->mesh;
 
-                        animations[i].framePoses[j][k] = (Transform){
-                            .translation = translation,
-                            .rotation = rotation,
-                            .scale = scale
-                        };
-                    }
+    for (int i = start; i < end; i++)
+    {
+        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
+        Vector3 tangent = { 0 };
+        Vector3 bitangent = { 0 };
 
-                    BuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
-                }
+        // Unindexed meshes vertices only belong to their own triangle
+        int first = (job->vertexFaceOffsets != NULL)? job->vertexFaceOffsets[i] : i;
+        int last = (job->vertexFaceOffsets != NULL)? job->vertexFaceOffsets[i + 1] : ((i/3 < job->triangleCount)? i + 1 : i);
 
-                TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, animData.name, animations[i].frameCount, animDuration);
-                RL_FREE(boneChannels);
-            }
+        for (int f = first; f < last; f++)
+        {
+            int t = (job->vertexFaces != NULL)? job->vertexFaces[f] : i/3;
+            Vector3 sdir = job->faceTangents[t*2 + 0];
+            Vector3 tdir = job->faceTangents[t*2 + 1];
+
+#if defined(COMPUTE_TANGENTS_MIKKTSPACE)
+            // Triangle tangent is projected on vertex normal plane and weighted by triangle angle at vertex
+            int corners[3] = { t*3 + 0, t*3 + 1, t*3 + 2 };
+            if (mesh->indices != NULL) for (int k = 0; k < 3; k++) corners[k] = mesh->indices[t*3 + k];
+
+            int corner = (corners[0] == i)? 0 : ((corners[1] == i)? 1 : 2);
+            int next = corners[(corner + 1)%3];
+            int prev = corners[(corner + 2)%3];
+
+            Vector3 position = { mesh->vertices[i*3 + 0], mesh->vertices[i*3 + 1], mesh->vertices[i*3 + 2] };
+            Vector3 edge1 = Vector3Subtract((Vector3){ mesh->vertices[next*3 + 0], mesh->vertices[next*3 + 1], mesh->vertices[next*3 + 2] }, position);
+            Vector3 edge2 = Vector3Subtract((Vector3){ mesh->vertices[prev*3 + 0], mesh->vertices[prev*3 + 1], mesh->vertices[prev*3 + 2] }, position);
+            float weight = Vector3Angle(edge1, edge2);
+
+            sdir = Vector3Scale(Vector3Normalize(Vector3Subtract(sdir, Vector3Scale(normal, Vector3DotProduct(normal, sdir)))), weight);
+            tdir = Vector3Scale(Vector3Normalize(tdir), weight);
+#endif
+            tangent = Vector3Add(tangent, sdir);
+            bitangent = Vector3Add(bitangent, tdir);
         }
-        else TRACELOG(LOG_ERROR, "MODEL: [%s] expected exactly one skin to load animation data from, but found %i", fileName, data->skins_count);
 
-        cgltf_free(data);
+        Vector3OrthoNormalize(&normal, &tangent);
+
+        // Tangent can not be computed (degenerated texcoords), any direction perpendicular to normal is used
+        if (Vector3Length(tangent) < EPSILON) tangent = Vector3Normalize(Vector3Perpendicular(normal));
+
+        mesh->tangents[i*4 + 0] = tangent.x;
+        mesh->tangents[i*4 + 1] = tangent.y;
+        mesh->tangents[i*4 + 2] = tangent.z;
+        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), bitangent) < 0.0f)? -1.0f : 1.0f;
     }
-    UnloadFileData(fileData);
-    return animations;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_VOX)
-// Load VOX (MagicaVoxel) mesh data
-static Model LoadVOX(const char *fileName)
+#if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_MESH_GENERATION)
+// Weld unindexed mesh vertices with equal attributes, vertex arrays are compacted and mesh indices generated
+// NOTE: Vertices are hashed with all their attributes and welded only if bitwise equal,
+// meshes with more unique vertices than 16bit indices can address are kept unindexed
+static void WeldMeshVertices(Mesh *mesh)
 {
-    Model model = { 0 };
-
-    int nbvertices = 0;
-    int meshescount = 0;
-    unsigned int fileSize = 0;
-    unsigned char *fileData = NULL;
+    if ((mesh->vertices == NULL) || (mesh->indices != NULL) || (mesh->animVertices != NULL) || (mesh->vertexCount < 3)) return;
+
+    struct { unsigned char *data; int size; } attributes[8] = {
+        { (unsigned char *)mesh->vertices, 3*sizeof(float) },
+        { (unsigned char *)mesh->texcoords, 2*sizeof(float) },
+        { (unsigned char *)mesh->texcoords2, 2*sizeof(float) },
+        { (unsigned char *)mesh->normals, 3*sizeof(float) },
+        { (unsigned char *)mesh->tangents, 4*sizeof(float) },
+        { mesh->colors, 4*sizeof(unsigned char) },
+        { mesh->boneIds, 4*sizeof(unsigned char) },
+        { (unsigned char *)mesh->boneWeights, 4*sizeof(float) }
+    };
 
-    // Read vox file into buffer
-    fileData = LoadFileData(fileName, &fileSize);
-    if (fileData == 0)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX file", fileName);
-        return model;
-    }
+    int vertexCount = mesh->vertexCount;
+    unsigned int tableSize = 1;
+    while (tableSize < (unsigned int)vertexCount*2) tableSize <<= 1;
 
-    // Read and build voxarray description
-    VoxArray3D voxarray = { 0 };
-    int ret = Vox_LoadFromMemory(fileData, fileSize, &voxarray);
+    // Open addressing hash table, stores first vertex found for every unique vertex
+    int *table = (int *)MemAllocFrame(tableSize*sizeof(int));
+    unsigned short *indices = (unsigned short *)RL_MALLOC(vertexCount*sizeof(unsigned short));
 
-    if (ret != VOX_SUCCESS)
+    if ((table == NULL) || (indices == NULL))
     {
-        // Error
-        UnloadFileData(fileData);
-
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX data", fileName);
-        return model;
+        MemFreeFrame(table);
+        RL_FREE(indices);
+        return;
     }
-    else
-    {
-        // Success: Compute meshes count
-        nbvertices = voxarray.vertices.used;
-        meshescount = 1 + (nbvertices/65536);
 
-        TRACELOG(LOG_INFO, "MODEL: [%s] VOX data loaded successfully : %i vertices/%i meshes", fileName, nbvertices, meshescount);
-    }
+    for (unsigned int i = 0; i < tableSize; i++) table[i] = -1;
 
-    // Build models from meshes
-    model.transform = MatrixIdentity();
+    int uniqueCount = 0;
+    bool indexable = true;
 
-    model.meshCount = meshescount;
-    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+    for (int i = 0; (i < vertexCount) && indexable; i++)
+    {
+        unsigned int hash = 2166136261u;    // FNV-1a hash of vertex attributes
 
-    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+        for (int a = 0; a < 8; a++)
+        {
+            if (attributes[a].data == NULL) continue;
 
-    model.materialCount = 1;
-    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-    model.materials[0] = LoadMaterialDefault();
+            const unsigned char *bytes = attributes[a].data + i*attributes[a].size;
+            for (int b = 0; b < attributes[a].size; b++) hash = (hash ^ bytes[b])*16777619u;
+        }
 
-    // Init model meshes
-    int verticesRemain = voxarray.vertices.used;
-    int verticesMax = 65532; // 5461 voxels x 12 vertices per voxel -> 65532 (must be inf 65536)
+        unsigned int slot = hash & (tableSize - 1);
 
-    // 6*4 = 12 vertices per voxel
-    Vector3 *pvertices = (Vector3 *)voxarray.vertices.array;
-    Color *pcolors = (Color *)voxarray.colors.array;
+        while (table[slot] != -1)
+        {
+            bool equal = true;
 
-    unsigned short *pindices = voxarray.indices.array;    // 5461*6*6 = 196596 indices max per mesh
+            for (int a = 0; (a < 8) && equal; a++)
+            {
+                if (attributes[a].data != NULL) equal = (memcmp(attributes[a].data + i*attributes[a].size, attributes[a].data + table[slot]*attributes[a].size, attributes[a].size) == 0);
+            }
 
-    int size = 0;
+            if (equal) break;
 
-    for (int i = 0; i < meshescount; i++)
-    {
-        Mesh *pmesh = &model.meshes[i];
-        memset(pmesh, 0, sizeof(Mesh));
+            slot = (slot + 1) & (tableSize - 1);
+        }
 
-        // Copy vertices
-        pmesh->vertexCount = (int)fmin(verticesMax, verticesRemain);
+        if (table[slot] == -1)
+        {
+            indexable = (uniqueCount <= 0xffff);
 
-        size = pmesh->vertexCount*sizeof(float)*3;
-        pmesh->vertices = RL_MALLOC(size);
-        memcpy(pmesh->vertices, pvertices, size);
+            table[slot] = i;
+            indices[i] = (unsigned short)uniqueCount;
+            uniqueCount++;
+        }
+        else indices[i] = indices[table[slot]];
+    }
 
-        // Copy indices
-        size = voxarray.indices.used*sizeof(unsigned short);
-        pmesh->indices = RL_MALLOC(size);
-        memcpy(pmesh->indices, pindices, size);
+    MemFreeFrame(table);
 
-        pmesh->triangleCount = (pmesh->vertexCount/4)*2;
+    if (!indexable)
+    {
+        RL_FREE(indices);
+        return;
+    }
 
-        // Copy colors
-        size = pmesh->vertexCount*sizeof(Color);
-        pmesh->colors = RL_MALLOC(size);
-        memcpy(pmesh->colors, pcolors, size);
+    // Compact unique vertices in place, unique vertices are found in order and never moved forward
+    for (int i = 0, next = 0; i < vertexCount; i++)
+    {
+        if (indices[i] != next) continue;
 
-        // First material index
-        model.meshMaterial[i] = 0;
+        for (int a = 0; a < 8; a++)
+        {
+            if ((attributes[a].data != NULL) && (next != i)) memcpy(attributes[a].data + next*attributes[a].size, attributes[a].data + i*attributes[a].size, attributes[a].size);
+        }
 
-        verticesRemain -= verticesMax;
-        pvertices += verticesMax;
-        pcolors += verticesMax;
+        next++;
     }
 
-    // Free buffers
-    Vox_FreeArrays(&voxarray);
-    UnloadFileData(fileData);
-
-    return model;
+    if (mesh->vertices != NULL) mesh->vertices = (float *)RL_REALLOC(mesh->vertices, uniqueCount*3*sizeof(float));
+    if (mesh->texcoords != NULL) mesh->texcoords = (float *)RL_REALLOC(mesh->texcoords, uniqueCount*2*sizeof(float));
+    if (mesh->texcoords2 != NULL) mesh->texcoords2 = (float *)RL_REALLOC(mesh->texcoords2, uniqueCount*2*sizeof(float));
+    if (mesh->normals != NULL) mesh->normals = (float *)RL_REALLOC(mesh->normals, uniqueCount*3*sizeof(float));
+    if (mesh->tangents != NULL) mesh->tangents = (float *)RL_REALLOC(mesh->tangents, uniqueCount*4*sizeof(float));
+    if (mesh->colors != NULL) mesh->colors = (unsigned char *)RL_REALLOC(mesh->colors, uniqueCount*4*sizeof(unsigned char));
+    if (mesh->boneIds != NULL) mesh->boneIds = (unsigned char *)RL_REALLOC(mesh->boneIds, uniqueCount*4*sizeof(unsigned char));
+    if (mesh->boneWeights != NULL) mesh->boneWeights = (float *)RL_REALLOC(mesh->boneWeights, uniqueCount*4*sizeof(float));
+
+    mesh->indices = indices;
+    mesh->vertexCount = uniqueCount;
 }
 #endif
 
-#if defined(SUPPORT_FILEFORMAT_M3D)
-// Hook LoadFileData()/UnloadFileData() calls to M3D loaders
-unsigned char *m3d_loaderhook(char *fn, unsigned int *len) { return LoadFileData((const char *)fn, len); }
-void m3d_freehook(void *data) { UnloadFileData((unsigned char *)data); }
-
-// Load M3D mesh data
-static Model LoadM3D(const char *fileName)
+// Get instance data size for instance format (bytes), 0 for invalid formats
+static int GetInstanceFormatSize(int format)
 {
-    Model model = { 0 };
-
-    m3d_t *m3d = NULL;
-    m3dp_t *prop = NULL;
-    unsigned int bytesRead = 0;
-    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
-    int i, j, k, l, n, mi = -2;
+    int size = 0;
 
-    if (fileData != NULL)
+    switch (format)
     {
-        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
+        case INSTANCE_FORMAT_MATRIX: size = 16*sizeof(float); break;
+        case INSTANCE_FORMAT_MATRIX_3X4: size = 12*sizeof(float); break;
+        case INSTANCE_FORMAT_TRANSFORM: size = 8*sizeof(float); break;
+        default: break;
+    }
 
-        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
-            if (m3d) m3d_free(m3d);
-            UnloadFileData(fileData);
-            return model;
-        }
-        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i faces/%i materials", fileName, m3d->numface, m3d->nummaterial);
+    return size;
+}
 
-        // no face? this is probably just a material library
-        if (!m3d->numface)
-        {
-            m3d_free(m3d);
-            UnloadFileData(fileData);
-            return model;
-        }
+// Upload instances data converted to buffer format
+// NOTE: Matrix struct fields are stored by rows, so 3x4 matrices are the first three rows of every Matrix
+static void UploadInstanceData(InstanceBuffer buffer, const void *data, int offset, int count)
+{
+    int instanceSize = GetInstanceFormatSize(buffer.format);
+    float *instances = (float *)MemAllocFrame(count*instanceSize);
+    if (instances == NULL) return;
 
-        if (m3d->nummaterial > 0)
+    switch (buffer.format)
+    {
+        case INSTANCE_FORMAT_MATRIX:
         {
-            model.meshCount = model.materialCount = m3d->nummaterial;
-            TRACELOG(LOG_INFO, "MODEL: model has %i material meshes", model.materialCount);
-        }
-        else
+            for (int i = 0; i < count; i++)
+            {
+                float16 columns = MatrixToFloatV(((const Matrix *)data)[i]);
+                memcpy(&instances[i*16], columns.v, 16*sizeof(float));
+            }
+        } break;
+        case INSTANCE_FORMAT_MATRIX_3X4:
         {
-            model.meshCount = model.materialCount = 1;
-            TRACELOG(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
-        }
-
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
-        model.materials = (Material *)RL_CALLOC(model.materialCount + 1, sizeof(Material));
-
-        // Map no material to index 0 with default shader, everything else materialid + 1
-        model.materials[0] = LoadMaterialDefault();
-
-        for (i = l = 0, k = -1; i < (int)m3d->numface; i++, l++)
+            for (int i = 0; i < count; i++) memcpy(&instances[i*12], &((const Matrix *)data)[i], 12*sizeof(float));
+        } break;
+        case INSTANCE_FORMAT_TRANSFORM:
         {
-            // Materials are grouped together
-            if (mi != m3d->face[i].materialid)
+            for (int i = 0; i < count; i++)
             {
-                // there should be only one material switch per material kind, but be bulletproof for non-optimal model files
-                if (k + 1 >= model.meshCount)
-                {
-                    model.meshCount++;
-                    model.meshes = (Mesh *)RL_REALLOC(model.meshes, model.meshCount*sizeof(Mesh));
-                    memset(&model.meshes[model.meshCount - 1], 0, sizeof(Mesh));
-                    model.meshMaterial = (int *)RL_REALLOC(model.meshMaterial, model.meshCount*sizeof(int));
-                }
+                const Transform *transform = &((const Transform *)data)[i];
+
+                instances[i*8] = transform->translation.x;
+                instances[i*8 + 1] = transform->translation.y;
+                instances[i*8 + 2] = transform->translation.z;
+                instances[i*8 + 3] = transform->scale.x;
+                instances[i*8 + 4] = transform->rotation.x;
+                instances[i*8 + 5] = transform->rotation.y;
+                instances[i*8 + 6] = transform->rotation.z;
+                instances[i*8 + 7] = transform->rotation.w;
+            }
+        } break;
+        default: break;
+    }
 
-                k++;
-                mi = m3d->face[i].materialid;
+    rlUpdateVertexBuffer(buffer.id, instances, count*instanceSize, offset*instanceSize);
 
-                for (j = i, l = 0; (j < (int)m3d->numface) && (mi == m3d->face[j].materialid); j++, l++);
+    MemFreeFrame(instances);
+}
 
-                model.meshes[k].vertexCount = l*3;
-                model.meshes[k].triangleCount = l;
-                model.meshes[k].vertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
-                model.meshes[k].texcoords = (float *)RL_CALLOC(model.meshes[k].vertexCount*2, sizeof(float));
-                model.meshes[k].normals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
+// Generate voxel chunk mesh from chunk voxels, adjacent visible faces with same voxel are merged into quads (greedy meshing)
+// NOTE: Chunk voxels include a one voxel border with neighbour voxels, so faces occluded by neighbour chunks are culled
+static Mesh GenMeshVoxelChunk(const unsigned char *voxels, const Color *palette, Vector3 origin, float voxelSize)
+{
+    const int size = VOXELMAP_CHUNK_SIZE;
 
-                // If no map is provided, we allocate storage for vertex colors
-                // M3D specs only consider vertex colors if no material is provided
-                if (mi != M3D_UNDEF) model.meshes[k].colors = RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
+    Mesh mesh = { 0 };
 
-                if (m3d->numbone && m3d->numskin)
-                {
-                    model.meshes[k].boneIds = (unsigned char *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(unsigned char));
-                    model.meshes[k].boneWeights = (float *)RL_CALLOC(model.meshes[k].vertexCount*4, sizeof(float));
-                    model.meshes[k].animVertices = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
-                    model.meshes[k].animNormals = (float *)RL_CALLOC(model.meshes[k].vertexCount*3, sizeof(float));
-                }
+    // NOTE: Worst case is 3 quads per voxel (alternating voxels)
+    VoxelQuad *quads = (VoxelQuad *)MemAllocFrame(3*size*size*size*sizeof(VoxelQuad));
+    if (quads == NULL) return mesh;
 
-                model.meshMaterial[k] = mi + 1;
-                l = 0;
-            }
+    unsigned char mask[VOXELMAP_CHUNK_SIZE*VOXELMAP_CHUNK_SIZE] = { 0 };
+    int quadCount = 0;
 
-            // Process meshes per material, add triangles
-            model.meshes[k].vertices[l*9 + 0] = m3d->vertex[m3d->face[i].vertex[0]].x*m3d->scale;
-            model.meshes[k].vertices[l*9 + 1] = m3d->vertex[m3d->face[i].vertex[0]].y*m3d->scale;
-            model.meshes[k].vertices[l*9 + 2] = m3d->vertex[m3d->face[i].vertex[0]].z*m3d->scale;
-            model.meshes[k].vertices[l*9 + 3] = m3d->vertex[m3d->face[i].vertex[1]].x*m3d->scale;
-            model.meshes[k].vertices[l*9 + 4] = m3d->vertex[m3d->face[i].vertex[1]].y*m3d->scale;
-            model.meshes[k].vertices[l*9 + 5] = m3d->vertex[m3d->face[i].vertex[1]].z*m3d->scale;
-            model.meshes[k].vertices[l*9 + 6] = m3d->vertex[m3d->face[i].vertex[2]].x*m3d->scale;
-            model.meshes[k].vertices[l*9 + 7] = m3d->vertex[m3d->face[i].vertex[2]].y*m3d->scale;
-            model.meshes[k].vertices[l*9 + 8] = m3d->vertex[m3d->face[i].vertex[2]].z*m3d->scale;
+    // Faces are processed by direction (+X, -X, +Y, -Y, +Z, -Z) and by slices along face normal axis
+    for (int face = 0; face < 6; face++)
+    {
+        int d = face/2;                 // Face normal axis
+        int u = (d + 1)%3;              // Face first axis
+        int v = (d + 2)%3;              // Face second axis
+        int side = (face%2 == 0)? 1 : -1;
 
-            // without vertex color (full transparency), we use the default color
-            if (model.meshes[k].colors != NULL)
-            {
-                if (m3d->vertex[m3d->face[i].vertex[0]].color & 0xFF000000)
-                    memcpy(&model.meshes[k].colors[l*12 + 0], &m3d->vertex[m3d->face[i].vertex[0]].color, 4);
-                if (m3d->vertex[m3d->face[i].vertex[1]].color & 0xFF000000)
-                    memcpy(&model.meshes[k].colors[l*12 + 4], &m3d->vertex[m3d->face[i].vertex[1]].color, 4);
-                if (m3d->vertex[m3d->face[i].vertex[2]].color & 0xFF000000)
-                    memcpy(&model.meshes[k].colors[l*12 + 8], &m3d->vertex[m3d->face[i].vertex[2]].color, 4);
-            }
+        for (int slice = 0; slice < size; slice++)
+        {
+            // Get slice visible faces: voxel is not empty and neighbour voxel (towards face normal) is empty
+            int pos[3] = { 0 };
 
-            if (m3d->face[i].texcoord[0] != M3D_UNDEF)
+            for (int j = 0; j < size; j++)
             {
-                model.meshes[k].texcoords[l*6 + 0] = m3d->tmap[m3d->face[i].texcoord[0]].u;
-                model.meshes[k].texcoords[l*6 + 1] = 1.0f - m3d->tmap[m3d->face[i].texcoord[0]].v;
-                model.meshes[k].texcoords[l*6 + 2] = m3d->tmap[m3d->face[i].texcoord[1]].u;
-                model.meshes[k].texcoords[l*6 + 3] = 1.0f - m3d->tmap[m3d->face[i].texcoord[1]].v;
-                model.meshes[k].texcoords[l*6 + 4] = m3d->tmap[m3d->face[i].texcoord[2]].u;
-                model.meshes[k].texcoords[l*6 + 5] = 1.0f - m3d->tmap[m3d->face[i].texcoord[2]].v;
-            }
+                for (int i = 0; i < size; i++)
+                {
+                    pos[d] = slice;
+                    pos[u] = i;
+                    pos[v] = j;
+                    unsigned char voxel = voxels[VOXEL_CHUNK_INDEX(pos[0], pos[1], pos[2])];
 
-            if (m3d->face[i].normal[0] != M3D_UNDEF)
-            {
-                model.meshes[k].normals[l*9 + 0] = m3d->vertex[m3d->face[i].normal[0]].x;
-                model.meshes[k].normals[l*9 + 1] = m3d->vertex[m3d->face[i].normal[0]].y;
-                model.meshes[k].normals[l*9 + 2] = m3d->vertex[m3d->face[i].normal[0]].z;
-                model.meshes[k].normals[l*9 + 3] = m3d->vertex[m3d->face[i].normal[1]].x;
-                model.meshes[k].normals[l*9 + 4] = m3d->vertex[m3d->face[i].normal[1]].y;
-                model.meshes[k].normals[l*9 + 5] = m3d->vertex[m3d->face[i].normal[1]].z;
-                model.meshes[k].normals[l*9 + 6] = m3d->vertex[m3d->face[i].normal[2]].x;
-                model.meshes[k].normals[l*9 + 7] = m3d->vertex[m3d->face[i].normal[2]].y;
-                model.meshes[k].normals[l*9 + 8] = m3d->vertex[m3d->face[i].normal[2]].z;
+                    pos[d] = slice + side;
+                    mask[j*size + i] = ((voxel != 0) && (voxels[VOXEL_CHUNK_INDEX(pos[0], pos[1], pos[2])] == 0))? voxel : 0;
+                }
             }
 
-            // Add skin (vertex / bone weight pairs)
-            if (m3d->numbone && m3d->numskin)
+            // Merge visible faces into quads, quads grow along first axis and then along second axis
+            for (int j = 0; j < size; j++)
             {
-                for (n = 0; n < 3; n++)
+                for (int i = 0; i < size;)
                 {
-                    int skinid = m3d->vertex[m3d->face[i].vertex[n]].skinid;
+                    unsigned char voxel = mask[j*size + i];
 
-                    // Check if there is a skin for this mesh, should be, just failsafe
-                    if (skinid != M3D_UNDEF && skinid < (int)m3d->numskin)
+                    if (voxel == 0)
                     {
-                        for (j = 0; j < 4; j++)
-                        {
-                            model.meshes[k].boneIds[l*12 + n*4 + j] = m3d->skin[skinid].boneid[j];
-                            model.meshes[k].boneWeights[l*12 + n*4 + j] = m3d->skin[skinid].weight[j];
-                        }
+                        i++;
+                        continue;
                     }
-                    else
+
+                    int width = 1;
+                    while ((i + width < size) && (mask[j*size + i + width] == voxel)) width++;
+
+                    int height = 1;
+                    bool merge = true;
+
+                    while (merge && (j + height < size))
                     {
-                        // raylib does not handle boneless meshes with skeletal animations, so
-                        // we put all vertices without a bone into a special "no bone" bone
-                        model.meshes[k].boneIds[l*12 + n*4] = m3d->numbone;
-                        model.meshes[k].boneWeights[l*12 + n*4] = 1.0f;
+                        for (int k = 0; k < width; k++)
+                        {
+                            if (mask[(j + height)*size + i + k] != voxel)
+                            {
+                                merge = false;
+                                break;
+                            }
+                        }
+
+                        if (merge) height++;
                     }
+
+                    for (int k = 0; k < height; k++) memset(&mask[(j + k)*size + i], 0, width);
+
+                    quads[quadCount] = (VoxelQuad){ (unsigned char)face, (unsigned char)slice, (unsigned char)i, (unsigned char)j,
+                        (unsigned char)width, (unsigned char)height, voxel };
+                    quadCount++;
+
+                    i += width;
                 }
             }
         }
+    }
 
-        // Load materials
-        for (i = 0; i < (int)m3d->nummaterial; i++)
+    if (quadCount > 0)
+    {
+        mesh.vertexCount = quadCount*4;
+        mesh.triangleCount = quadCount*2;
+        mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+        mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+        mesh.colors = (unsigned char *)RL_MALLOC(mesh.vertexCount*4*sizeof(unsigned char));
+        mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+
+        float offset[3] = { origin.x, origin.y, origin.z };
+
+        for (int q = 0; q < quadCount; q++)
         {
-            model.materials[i + 1] = LoadMaterialDefault();
+            VoxelQuad quad = quads[q];
 
-            for (j = 0; j < m3d->material[i].numprop; j++)
+            int d = quad.face/2;
+            int u = (d + 1)%3;
+            int v = (d + 2)%3;
+            int side = (quad.face%2 == 0)? 1 : -1;
+
+            // Quad corners: start, start + first axis, start + both axis, start + second axis
+            float corner[3] = { 0 };
+            corner[d] = (float)(quad.slice + ((side > 0)? 1 : 0));
+            corner[u] = (float)quad.u;
+            corner[v] = (float)quad.v;
+
+            for (int k = 0; k < 4; k++)
             {
-                prop = &m3d->material[i].prop[j];
+                float position[3] = { corner[0], corner[1], corner[2] };
+                if ((k == 1) || (k == 2)) position[u] += quad.width;
+                if (k >= 2) position[v] += quad.height;
 
-                switch (prop->type)
-                {
-                    case m3dp_Kd:
-                    {
-                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].color, &prop->value.color, 4);
-                        model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
-                    } break;
-                    case m3dp_Ks:
-                    {
-                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].color, &prop->value.color, 4);
-                    } break;
-                    case m3dp_Ns:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].value = prop->value.fnum;
-                    } break;
-                    case m3dp_Ke:
-                    {
-                        memcpy(&model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].color, &prop->value.color, 4);
-                        model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].value = 0.0f;
-                    } break;
-                    case m3dp_Pm:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_METALNESS].value = prop->value.fnum;
-                    } break;
-                    case m3dp_Pr:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].value = prop->value.fnum;
-                    } break;
-                    case m3dp_Ps:
-                    {
-                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].color = WHITE;
-                        model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].value = prop->value.fnum;
-                    } break;
-                    default:
-                    {
-                        if (prop->type >= 128)
-                        {
-                            Image image = { 0 };
-                            image.data = m3d->texture[prop->value.textureid].d;
-                            image.width = m3d->texture[prop->value.textureid].w;
-                            image.height = m3d->texture[prop->value.textureid].h;
-                            image.mipmaps = 1;
-                            image.format = (m3d->texture[prop->value.textureid].f == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 :
-                                           ((m3d->texture[prop->value.textureid].f == 3)? PIXELFORMAT_UNCOMPRESSED_R8G8B8 :
-                                           ((m3d->texture[prop->value.textureid].f == 2)? PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE));
+                int vertex = q*4 + k;
 
-                            switch (prop->type)
-                            {
-                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(image); break;
-                                default: break;
-                            }
-                        }
-                    } break;
+                for (int c = 0; c < 3; c++)
+                {
+                    mesh.vertices[vertex*3 + c] = offset[c] + position[c]*voxelSize;
+                    mesh.normals[vertex*3 + c] = (c == d)? (float)side : 0.0f;
                 }
+
+                Color color = palette[quad.voxel];
+                mesh.colors[vertex*4] = color.r;
+                mesh.colors[vertex*4 + 1] = color.g;
+                mesh.colors[vertex*4 + 2] = color.b;
+                mesh.colors[vertex*4 + 3] = color.a;
+            }
+
+            // Quad triangles counter-clockwise when seen from face normal direction
+            unsigned short first = (unsigned short)(q*4);
+            unsigned short *indices = &mesh.indices[q*6];
+
+            if (side > 0)
+            {
+                indices[0] = first; indices[1] = first + 1; indices[2] = first + 2;
+                indices[3] = first; indices[4] = first + 2; indices[5] = first + 3;
+            }
+            else
+            {
+                indices[0] = first; indices[1] = first + 2; indices[2] = first + 1;
+                indices[3] = first; indices[4] = first + 3; indices[5] = first + 2;
+            }
+        }
+    }
+
+    MemFreeFrame(quads);
+
+    return mesh;
+}
+
+// Set voxel map chunk to be remeshed, out of bounds chunks are ignored
+static void SetVoxelChunkDirty(VoxelMapState *state, int chunkX, int chunkY, int chunkZ)
+{
+    if ((chunkX < 0) || (chunkY < 0) || (chunkZ < 0) || (chunkX >= state->chunkCountX) || (chunkY >= state->chunkCountY) || (chunkZ >= state->chunkCountZ)) return;
+
+    state->chunks[(chunkZ*state->chunkCountY + chunkY)*state->chunkCountX + chunkX].dirty = true;
+}
+
+// Queue voxel map chunk meshing job, chunk voxels and palette are copied into job data
+static void QueueVoxelChunkJob(VoxelMap map, int chunkX, int chunkY, int chunkZ)
+{
+    VoxelMapState *state = (VoxelMapState *)map.state;
+    VoxelChunk *chunk = &state->chunks[(chunkZ*state->chunkCountY + chunkY)*state->chunkCountX + chunkX];
+
+    VoxelChunkJob *job = (VoxelChunkJob *)RL_MALLOC(sizeof(VoxelChunkJob));
+    if (job == NULL) return;
+
+    int startX = chunkX*VOXELMAP_CHUNK_SIZE;
+    int startY = chunkY*VOXELMAP_CHUNK_SIZE;
+    int startZ = chunkZ*VOXELMAP_CHUNK_SIZE;
+
+    for (int z = -1; z <= VOXELMAP_CHUNK_SIZE; z++)
+    {
+        for (int y = -1; y <= VOXELMAP_CHUNK_SIZE; y++)
+        {
+            for (int x = -1; x <= VOXELMAP_CHUNK_SIZE; x++)
+            {
+                job->voxels[VOXEL_CHUNK_INDEX(x, y, z)] = GetVoxelMapVoxel(map, startX + x, startY + y, startZ + z);
             }
         }
+    }
 
-        // Load bones
-        if (m3d->numbone)
-        {
-            model.boneCount = m3d->numbone + 1;
-            model.bones = RL_CALLOC(model.boneCount, sizeof(BoneInfo));
-            model.bindPose = RL_CALLOC(model.boneCount, sizeof(Transform));
+    job->chunk = chunk;
+    job->origin = (Vector3){ startX*map.voxelSize, startY*map.voxelSize, startZ*map.voxelSize };
+    job->voxelSize = map.voxelSize;
+    memcpy(job->palette, map.palette, 256*sizeof(Color));
+    job->mesh = (Mesh){ 0 };
 
-            for (i = 0; i < (int)m3d->numbone; i++)
-            {
-                model.bones[i].parent = m3d->bone[i].parent;
-                strncpy(model.bones[i].name, m3d->bone[i].name, sizeof(model.bones[i].name));
-                model.bindPose[i].translation.x = m3d->vertex[m3d->bone[i].pos].x*m3d->scale;
-                model.bindPose[i].translation.y = m3d->vertex[m3d->bone[i].pos].y*m3d->scale;
-                model.bindPose[i].translation.z = m3d->vertex[m3d->bone[i].pos].z*m3d->scale;
-                model.bindPose[i].rotation.x = m3d->vertex[m3d->bone[i].ori].x;
-                model.bindPose[i].rotation.y = m3d->vertex[m3d->bone[i].ori].y;
-                model.bindPose[i].rotation.z = m3d->vertex[m3d->bone[i].ori].z;
-                model.bindPose[i].rotation.w = m3d->vertex[m3d->bone[i].ori].w;
+    // NOTE: Chunk changes after this point are meshed by a later job
+    chunk->dirty = false;
+    chunk->pending = true;
+    chunk->jobId = QueueJob(VoxelChunkJobWork, VoxelChunkJobFinish, job);
+}
 
-                // TODO: If the orientation quaternion is not normalized, then that's encoding scaling
-                model.bindPose[i].rotation = QuaternionNormalize(model.bindPose[i].rotation);
-                model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+// Voxel chunk meshing job work, generate chunk mesh (worker thread)
+static void VoxelChunkJobWork(void *data)
+{
+    VoxelChunkJob *job = (VoxelChunkJob *)data;
 
-                // Child bones are stored in parent bone relative space, convert that into model space
-                if (model.bones[i].parent >= 0)
+    job->mesh = GenMeshVoxelChunk(job->voxels, job->palette, job->origin, job->voxelSize);
+}
+
+// Voxel chunk meshing job finish, replace chunk mesh and upload it (main thread)
+static void VoxelChunkJobFinish(void *data)
+{
+    VoxelChunkJob *job = (VoxelChunkJob *)data;
+    VoxelChunk *chunk = job->chunk;
+
+    if (chunk->mesh.vertexCount > 0) UnloadMesh(chunk->mesh);
+
+    chunk->mesh = job->mesh;
+    if (chunk->mesh.vertexCount > 0) UploadMesh(&chunk->mesh, false);
+
+    chunk->pending = false;
+
+    RL_FREE(job);
+}
+
+// Load terrain tile heights and quadtree nodes height bounds from image (32bit float format)
+// NOTE: Image data is kept as tile heights on success
+static bool LoadTerrainTileData(TerrainTile *tile, Image image)
+{
+    if ((image.data == NULL) || (image.format != PIXELFORMAT_UNCOMPRESSED_R32) || (image.width < 2) || (image.height < 2)) return false;
+
+    // Get quadtree levels, root node covers all tile samples
+    int levels = 1;
+    while (((TERRAIN_PATCH_SIZE << (levels - 1)) < (image.width - 1)) || ((TERRAIN_PATCH_SIZE << (levels - 1)) < (image.height - 1))) levels++;
+
+    if (levels > TERRAIN_MAX_LOD_LEVELS)
+    {
+        TRACELOG(LOG_WARNING, "TERRAIN: Terrain tile heightmap too big (%i x %i samples)", image.width, image.height);
+        return false;
+    }
+
+    int boundsCount = 0;
+
+    for (int level = 0; level < levels; level++)
+    {
+        int nodes = 1 << (levels - 1 - level);
+        tile->levelOffsets[level] = boundsCount;
+        boundsCount += nodes*nodes*2;
+    }
+
+    float *bounds = (float *)RL_MALLOC(boundsCount*sizeof(float));
+    if (bounds == NULL) return false;
+
+    const float *heights = (const float *)image.data;
+
+    // Get level 0 nodes bounds from samples, nodes out of tile remain empty (min > max)
+    // NOTE: Node samples include neighbour nodes edge samples (nodes grids share edges)
+    int nodes = 1 << (levels - 1);
+
+    for (int z = 0; z < nodes; z++)
+    {
+        for (int x = 0; x < nodes; x++)
+        {
+            float min = FLT_MAX;
+            float max = -FLT_MAX;
+
+            for (int sz = z*TERRAIN_PATCH_SIZE; (sz <= (z + 1)*TERRAIN_PATCH_SIZE) && (sz < image.height); sz++)
+            {
+                for (int sx = x*TERRAIN_PATCH_SIZE; (sx <= (x + 1)*TERRAIN_PATCH_SIZE) && (sx < image.width); sx++)
                 {
-                    model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
-                    model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
-                    model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
-                    model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
+                    min = fminf(min, heights[sz*image.width + sx]);
+                    max = fmaxf(max, heights[sz*image.width + sx]);
                 }
             }
 
-            // Add a special "no bone" bone
-            model.bones[i].parent = -1;
-            strcpy(model.bones[i].name, "NO BONE");
-            model.bindPose[i].translation.x = 0.0f;
-            model.bindPose[i].translation.y = 0.0f;
-            model.bindPose[i].translation.z = 0.0f;
-            model.bindPose[i].rotation.x = 0.0f;
-            model.bindPose[i].rotation.y = 0.0f;
-            model.bindPose[i].rotation.z = 0.0f;
-            model.bindPose[i].rotation.w = 1.0f;
-            model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+            bounds[(z*nodes + x)*2] = min;
+            bounds[(z*nodes + x)*2 + 1] = max;
         }
+    }
 
-        // Load bone-pose default mesh into animation vertices. These will be updated when UpdateModelAnimation gets
-        // called, but not before, however DrawMesh uses these if they exist (so not good if they are left empty).
-        if (m3d->numbone && m3d->numskin)
+    // Get upper levels nodes bounds from children nodes bounds
+    for (int level = 1; level < levels; level++)
+    {
+        float *parents = &bounds[tile->levelOffsets[level]];
+        const float *children = &bounds[tile->levelOffsets[level - 1]];
+        nodes = 1 << (levels - 1 - level);
+
+        for (int z = 0; z < nodes; z++)
         {
-            for(i = 0; i < model.meshCount; i++)
+            for (int x = 0; x < nodes; x++)
             {
-                memcpy(model.meshes[i].animVertices, model.meshes[i].vertices, model.meshes[i].vertexCount*3*sizeof(float));
-                memcpy(model.meshes[i].animNormals, model.meshes[i].normals, model.meshes[i].vertexCount*3*sizeof(float));
+                float min = FLT_MAX;
+                float max = -FLT_MAX;
+
+                for (int i = 0; i < 4; i++)
+                {
+                    int child = (2*z + i/2)*nodes*2 + 2*x + i%2;
+                    min = fminf(min, children[child*2]);
+                    max = fmaxf(max, children[child*2 + 1]);
+                }
+
+                parents[(z*nodes + x)*2] = min;
+                parents[(z*nodes + x)*2 + 1] = max;
             }
         }
-
-        m3d_free(m3d);
-        UnloadFileData(fileData);
     }
 
-    return model;
+    tile->width = image.width;
+    tile->height = image.height;
+    tile->heights = (float *)image.data;
+    tile->levels = levels;
+    tile->bounds = bounds;
+
+    return true;
 }
 
-#define M3D_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+// Upload terrain tile heights texture, tile is set ready to be drawn
+static void UploadTerrainTile(TerrainTile *tile)
+{
+    tile->textureId = rlLoadTexture(tile->heights, tile->width, tile->height, RL_PIXELFORMAT_UNCOMPRESSED_R32, 1);
 
-// Load M3D animation data
-static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, unsigned int *animCount)
+    // NOTE: Heights are fetched by texel in vertex shader, no filtering or mipmaps required
+    if (tile->textureId > 0)
+    {
+        rlTextureParameters(tile->textureId, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+        rlTextureParameters(tile->textureId, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+        rlTextureParameters(tile->textureId, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+        rlTextureParameters(tile->textureId, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+    }
+
+    tile->state = TERRAIN_TILE_READY;
+}
+
+// Unload terrain tile data (RAM and VRAM), tile can be loaded again
+static void UnloadTerrainTile(TerrainTile *tile)
 {
-    m3d_t *m3d = NULL;
-    unsigned int bytesRead = 0;
-    unsigned char *fileData = LoadFileData(fileName, &bytesRead);
-    ModelAnimation *animations = NULL;
-    int i = 0, j = 0;
+    if (tile->textureId > 0) rlUnloadTexture(tile->textureId);
 
-    *animCount = 0;
+    RL_FREE(tile->heights);
+    RL_FREE(tile->bounds);
 
-    if (fileData != NULL)
+    *tile = (TerrainTile){ 0 };
+}
+
+// Load terrain shader and LOD node grid vertex array
+// NOTE: Heights are sampled in vertex shader, requires OpenGL 3.3 (texelFetch())
+static void LoadTerrainDrawing(TerrainState *state)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((rlGetVersion() < RL_OPENGL_33) || (rlGetVersion() > RL_OPENGL_43))
     {
-        m3d = m3d_load(fileData, m3d_loaderhook, m3d_freehook, NULL);
+        TRACELOG(LOG_WARNING, "TERRAIN: Terrain drawing requires OpenGL 3.3");
+        return;
+    }
 
-        if (!m3d || M3D_ERR_ISFATAL(m3d->errcode))
+    const char *terrainVShaderCode =
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "out vec3 fragNormal;               \n"
+    "uniform mat4 mvp;                  \n"
+    "uniform vec3 viewPos;              \n"
+    "uniform vec3 origin;               \n"
+    "uniform vec3 scale;                \n"
+    "uniform vec4 node;                 \n"     // Node offset (samples), node size (samples), grid size (quads)
+    "uniform vec2 morphRange;           \n"
+    "uniform sampler2D heightmap;       \n"
+    "float GetHeight(vec2 p)            \n"
+    "{                                  \n"
+    "    ivec2 texel = clamp(ivec2(p + 0.5), ivec2(0), textureSize(heightmap, 0) - 1); \n"
+    "    return texelFetch(heightmap, texel, 0).r*scale.y; \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 limit = vec2(textureSize(heightmap, 0) - 1); \n"
+    "    vec2 p = min(node.xy + vertexPosition*node.z, limit); \n"
+    "    float morph = clamp((distance(origin + vec3(p.x*scale.x, GetHeight(p), p.y*scale.z), viewPos) - morphRange.x)/(morphRange.y - morphRange.x), 0.0, 1.0); \n"
+    "    vec2 grid = vertexPosition - fract(vertexPosition*node.w*0.5)*2.0/node.w*morph; \n"     // Odd vertices morph into next level grid
+    "    p = min(node.xy + grid*node.z, limit); \n"
+    "    float hl = GetHeight(p - vec2(1.0, 0.0)); \n"
+    "    float hr = GetHeight(p + vec2(1.0, 0.0)); \n"
+    "    float hd = GetHeight(p - vec2(0.0, 1.0)); \n"
+    "    float hu = GetHeight(p + vec2(0.0, 1.0)); \n"
+    "    fragNormal = normalize(vec3((hl - hr)/(2.0*scale.x), 1.0, (hd - hu)/(2.0*scale.z))); \n"
+    "    gl_Position = mvp*vec4(origin + vec3(p.x*scale.x, GetHeight(p), p.y*scale.z), 1.0); \n"
+    "}                                  \n";
+
+    const char *terrainFShaderCode =
+    "#version 330                       \n"
+    "in vec3 fragNormal;                \n"
+    "out vec4 finalColor;               \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float light = 0.35 + 0.65*max(dot(normalize(fragNormal), normalize(vec3(0.4, 1.0, 0.3))), 0.0); \n"
+    "    finalColor = vec4(colDiffuse.rgb*light, colDiffuse.a); \n"
+    "}                                  \n";
+
+    state->shaderId = rlLoadShaderCode(terrainVShaderCode, terrainFShaderCode);
+
+    if ((state->shaderId == 0) || (state->shaderId == rlGetShaderIdDefault()))
+    {
+        TRACELOG(LOG_WARNING, "TERRAIN: Failed to load terrain shader");
+        state->shaderId = 0;
+        return;
+    }
+
+    const char *names[8] = { "mvp", "colDiffuse", "viewPos", "origin", "scale", "node", "morphRange", "heightmap" };
+    for (int i = 0; i < 8; i++) state->locs[i] = rlGetLocationUniform(state->shaderId, names[i]);
+
+    // LOD node grid, positions in [0..1] range, triangles counter-clockwise seen from above
+    const int size = TERRAIN_PATCH_SIZE;
+    float *vertices = (float *)RL_MALLOC((size + 1)*(size + 1)*2*sizeof(float));
+    unsigned short *indices = (unsigned short *)RL_MALLOC(size*size*6*sizeof(unsigned short));
+
+    if ((vertices != NULL) && (indices != NULL))
+    {
+        for (int z = 0; z <= size; z++)
         {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load M3D data, error code %d", fileName, m3d ? m3d->errcode : -2);
-            UnloadFileData(fileData);
-            return NULL;
+            for (int x = 0; x <= size; x++)
+            {
+                vertices[(z*(size + 1) + x)*2] = (float)x/size;
+                vertices[(z*(size + 1) + x)*2 + 1] = (float)z/size;
+            }
         }
-        else TRACELOG(LOG_INFO, "MODEL: [%s] M3D data loaded successfully: %i animations, %i bones, %i skins", fileName,
-            m3d->numaction, m3d->numbone, m3d->numskin);
 
-        // No animation or bone+skin?
-        if (!m3d->numaction || !m3d->numbone || !m3d->numskin)
+        for (int z = 0, k = 0; z < size; z++)
         {
-            m3d_free(m3d);
-            UnloadFileData(fileData);
-            return NULL;
+            for (int x = 0; x < size; x++, k += 6)
+            {
+                unsigned short corner = (unsigned short)(z*(size + 1) + x);
+
+                indices[k] = corner;
+                indices[k + 1] = corner + size + 1;
+                indices[k + 2] = corner + size + 2;
+                indices[k + 3] = corner;
+                indices[k + 4] = corner + size + 2;
+                indices[k + 5] = corner + 1;
+            }
         }
 
-        animations = RL_MALLOC(m3d->numaction*sizeof(ModelAnimation));
-        *animCount = m3d->numaction;
+        state->vaoId = rlLoadVertexArray();
+        rlEnableVertexArray(state->vaoId);
 
-        for (unsigned int a = 0; a < m3d->numaction; a++)
-        {
-            animations[a].frameCount = m3d->action[a].durationmsec / M3D_ANIMDELAY;
-            animations[a].boneCount = m3d->numbone + 1;
-            animations[a].bones = RL_MALLOC((m3d->numbone + 1)*sizeof(BoneInfo));
-            animations[a].framePoses = RL_MALLOC(animations[a].frameCount*sizeof(Transform *));
-            // strncpy(animations[a].name, m3d->action[a].name, sizeof(animations[a].name));
-            TRACELOG(LOG_INFO, "MODEL: [%s] animation #%i: %i msec, %i frames", fileName, a, m3d->action[a].durationmsec, animations[a].frameCount);
+        // Grid vertex attribute uses default shader location: vertexPosition (0)
+        state->vboId = rlLoadVertexBuffer(vertices, (size + 1)*(size + 1)*2*sizeof(float), false);
+        rlSetVertexAttribute(0, 2, RL_FLOAT, false, 0, (void *)0);
+        rlEnableVertexAttribute(0);
 
-            for (i = 0; i < (int)m3d->numbone; i++)
-            {
-                animations[a].bones[i].parent = m3d->bone[i].parent;
-                strncpy(animations[a].bones[i].name, m3d->bone[i].name, sizeof(animations[a].bones[i].name));
-            }
+        state->eboId = rlLoadVertexBufferElement(indices, size*size*6*sizeof(unsigned short), false);
 
-            // A special, never transformed "no bone" bone, used for boneless vertices
-            animations[a].bones[i].parent = -1;
-            strcpy(animations[a].bones[i].name, "NO BONE");
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+        rlDisableVertexBufferElement();
+    }
 
-            // M3D stores frames at arbitrary intervals with sparse skeletons. We need full skeletons at
-            // regular intervals, so let the M3D SDK do the heavy lifting and calculate interpolated bones
-            for (i = 0; i < animations[a].frameCount; i++)
-            {
-                animations[a].framePoses[i] = RL_MALLOC((m3d->numbone + 1)*sizeof(Transform));
+    RL_FREE(vertices);
+    RL_FREE(indices);
+#else
+    TRACELOG(LOG_WARNING, "TERRAIN: Terrain drawing requires OpenGL 3.3");
+#endif
+}
 
-                m3db_t *pose = m3d_pose(m3d, a, i*M3D_ANIMDELAY);
+// Queue terrain tile loading job, tile file name is formatted with tile indices
+static void QueueTerrainTileJob(TerrainState *state, TerrainTile *tile, int tileX, int tileZ)
+{
+    char fileName[512] = { 0 };
+    snprintf(fileName, 512, state->fileNameFormat, tileX, tileZ);
 
-                if (pose != NULL)
-                {
-                    for (j = 0; j < (int)m3d->numbone; j++)
-                    {
-                        animations[a].framePoses[i][j].translation.x = m3d->vertex[pose[j].pos].x*m3d->scale;
-                        animations[a].framePoses[i][j].translation.y = m3d->vertex[pose[j].pos].y*m3d->scale;
-                        animations[a].framePoses[i][j].translation.z = m3d->vertex[pose[j].pos].z*m3d->scale;
-                        animations[a].framePoses[i][j].rotation.x = m3d->vertex[pose[j].ori].x;
-                        animations[a].framePoses[i][j].rotation.y = m3d->vertex[pose[j].ori].y;
-                        animations[a].framePoses[i][j].rotation.z = m3d->vertex[pose[j].ori].z;
-                        animations[a].framePoses[i][j].rotation.w = m3d->vertex[pose[j].ori].w;
-                        animations[a].framePoses[i][j].rotation = QuaternionNormalize(animations[a].framePoses[i][j].rotation);
-                        animations[a].framePoses[i][j].scale.x = animations[a].framePoses[i][j].scale.y = animations[a].framePoses[i][j].scale.z = 1.0f;
+    int fileNameSize = (int)strlen(fileName) + 1;
 
-                        // Child bones are stored in parent bone relative space, convert that into model space
-                        if (animations[a].bones[j].parent >= 0)
-                        {
-                            animations[a].framePoses[i][j].rotation = QuaternionMultiply(animations[a].framePoses[i][animations[a].bones[j].parent].rotation, animations[a].framePoses[i][j].rotation);
-                            animations[a].framePoses[i][j].translation = Vector3RotateByQuaternion(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].rotation);
-                            animations[a].framePoses[i][j].translation = Vector3Add(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].translation);
-                            animations[a].framePoses[i][j].scale = Vector3Multiply(animations[a].framePoses[i][j].scale, animations[a].framePoses[i][animations[a].bones[j].parent].scale);
-                        }
-                    }
+    TerrainTileJob *job = (TerrainTileJob *)RL_CALLOC(1, sizeof(TerrainTileJob) + fileNameSize);
+    if (job == NULL) return;
 
-                    // Default transform for the "no bone" bone
-                    animations[a].framePoses[i][j].translation.x = 0.0f;
-                    animations[a].framePoses[i][j].translation.y = 0.0f;
-                    animations[a].framePoses[i][j].translation.z = 0.0f;
-                    animations[a].framePoses[i][j].rotation.x = 0.0f;
-                    animations[a].framePoses[i][j].rotation.y = 0.0f;
-                    animations[a].framePoses[i][j].rotation.z = 0.0f;
-                    animations[a].framePoses[i][j].rotation.w = 1.0f;
-                    animations[a].framePoses[i][j].scale.x = animations[a].framePoses[i][j].scale.y = animations[a].framePoses[i][j].scale.z = 1.0f;
-                    RL_FREE(pose);
-                }
-            }
-        }
+    job->fileName = (char *)job + sizeof(TerrainTileJob);
+    memcpy(job->fileName, fileName, fileNameSize);
+    job->tile = tile;
 
-        m3d_free(m3d);
-        UnloadFileData(fileData);
+    tile->state = TERRAIN_TILE_LOADING;
+    tile->jobId = QueueJob(TerrainTileJobWork, TerrainTileJobFinish, job);
+}
+
+// Terrain tile loading job work, load tile file heights and quadtree bounds (worker thread)
+static void TerrainTileJobWork(void *data)
+{
+    TerrainTileJob *job = (TerrainTileJob *)data;
+
+    Image image = LoadImage(job->fileName);
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R32);
+
+    if (!LoadTerrainTileData(&job->data, image)) UnloadImage(image);
+}
+
+// Terrain tile loading job finish, set tile data and upload heights texture (main thread)
+static void TerrainTileJobFinish(void *data)
+{
+    TerrainTileJob *job = (TerrainTileJob *)data;
+
+    if (job->data.heights != NULL)
+    {
+        *job->tile = job->data;
+        UploadTerrainTile(job->tile);
+    }
+    else
+    {
+        job->tile->state = TERRAIN_TILE_MISSING;
+        TRACELOG(LOG_WARNING, "TERRAIN: [%s] Failed to load terrain tile", job->fileName);
     }
 
-    return animations;
+    RL_FREE(job);
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Select and draw terrain LOD nodes (CDLOD), returns false if node is out of its LOD range
+// NOTE: Node out of its LOD range must be drawn by parent node, nodes out of view frustum are skipped
+static bool SelectTerrainNode(TerrainDrawContext *context, TerrainTile *tile, int level, int x, int z)
+{
+    BoundingBox box = { 0 };
+    if (!GetTerrainNodeBox(context, tile, level, x, z, &box)) return true;
+
+    // Check node box against view frustum planes, using box corner farthest along plane normal
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = context->planes[i];
+        float distance = plane.x*((plane.x > 0.0f)? box.max.x : box.min.x) +
+                         plane.y*((plane.y > 0.0f)? box.max.y : box.min.y) +
+                         plane.z*((plane.z > 0.0f)? box.max.z : box.min.z) + plane.w;
+
+        if (distance < 0.0f) return true;
+    }
+
+    if (!CheckCollisionBoxSphere(box, context->viewPosition, context->ranges[level])) return false;
+
+    if ((level == 0) || !CheckCollisionBoxSphere(box, context->viewPosition, context->ranges[level - 1])) DrawTerrainNode(context, level, x, z);
+    else
+    {
+        // Children out of their LOD range are drawn fully morphed, matching this node LOD level
+        for (int i = 0; i < 4; i++)
+        {
+            int childX = 2*x + i%2;
+            int childZ = 2*z + i/2;
+
+            if (!SelectTerrainNode(context, tile, level - 1, childX, childZ)) DrawTerrainNode(context, level - 1, childX, childZ);
+        }
+    }
+
+    return true;
+}
+
+// Get terrain LOD node bounds (terrain space), returns false if node is out of tile samples
+static bool GetTerrainNodeBox(TerrainDrawContext *context, TerrainTile *tile, int level, int x, int z, BoundingBox *box)
+{
+    int size = TERRAIN_PATCH_SIZE << level;
+    int startX = x*size;
+    int startZ = z*size;
+
+    if ((startX >= tile->width - 1) || (startZ >= tile->height - 1)) return false;
+
+    int nodes = 1 << (tile->levels - 1 - level);
+    const float *bounds = &tile->bounds[tile->levelOffsets[level] + (z*nodes + x)*2];
+
+    int endX = (startX + size < tile->width - 1)? startX + size : tile->width - 1;
+    int endZ = (startZ + size < tile->height - 1)? startZ + size : tile->height - 1;
+
+    box->min = (Vector3){ context->origin.x + startX*context->scale.x, bounds[0]*context->scale.y, context->origin.z + startZ*context->scale.z };
+    box->max = (Vector3){ context->origin.x + endX*context->scale.x, bounds[1]*context->scale.y, context->origin.z + endZ*context->scale.z };
+
+    return true;
+}
+
+// Draw terrain LOD node grid, grid vertices morph into next level grid approaching level range
+static void DrawTerrainNode(TerrainDrawContext *context, int level, int x, int z)
+{
+    float size = (float)(TERRAIN_PATCH_SIZE << level);
+    float node[4] = { x*size, z*size, size, (float)TERRAIN_PATCH_SIZE };
+    float morphRange[2] = { TERRAIN_MORPH_START*context->ranges[level], context->ranges[level] };
+
+    rlSetUniform(context->state->locs[5], node, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(context->state->locs[6], morphRange, RL_SHADER_UNIFORM_VEC2, 1);
+
+    rlDrawVertexArrayElements(0, TERRAIN_PATCH_SIZE*TERRAIN_PATCH_SIZE*6, 0);
 }
 #endif
 
@@ -0,0 +1,612 @@
+/**********************************************************************************************
+*
+*   rparticles - Particle system, particles pool updated on CPU (SIMD) or GPU (compute shader)
+*
+*   Particles are stored as structure of arrays (same layout on CPU and GPU pools) and all
+*   particles are drawn instanced in a single draw call (OpenGL 3.3+), render batch is used
+*   on OpenGL 1.1, 2.1 and ES2
+*
+*   CONFIGURATION:
+*       #define PARTICLES_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*   DEPENDENCIES:
+*       raylib.h    - Particle system types and functions declaration
+*       rlgl.h      - OpenGL abstraction layer, shaders, vertex buffers and instanced drawing
+*       raymath.h   - MatrixMultiply(), RM_*4() SIMD macros (if RAYMATH_SIMD is enabled)
+*       utils.h     - TRACELOG()
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 agent
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RPARTICLES_H
+#define RPARTICLES_H
+
+// NOTE: Particle system types (ParticleSystem, ParticleUpdateMode) and functions are declared in raylib.h
+
+#endif // RPARTICLES_H
+
+/***********************************************************************************
+*
+*   PARTICLES IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(PARTICLES_IMPLEMENTATION)
+
+#include <string.h>             // Required for: memcpy()
+#include <math.h>               // Required for: fminf()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define PARTICLE_DATA_ARRAYS            8       // Particle data arrays (structure of arrays), same layout on CPU and GPU pools
+#define PARTICLE_COMPUTE_GROUP_SIZE   256       // Particles compute shader work group size, must match shader local_size_x
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Particle data arrays, every array stores one particle value for all pool particles
+typedef enum {
+    PARTICLE_POSITION_X = 0,    // Position x
+    PARTICLE_POSITION_Y,        // Position y
+    PARTICLE_VELOCITY_X,        // Velocity x
+    PARTICLE_VELOCITY_Y,        // Velocity y
+    PARTICLE_AGE,               // Age (seconds since emitted)
+    PARTICLE_LIFE_INVERSE,      // Lifetime inverse (1/seconds), 0 for unused particles
+    PARTICLE_SIZE,              // Size (interpolated over life)
+    PARTICLE_COLOR              // Color, packed RGBA bytes (interpolated over life)
+} ParticleDataArray;
+
+// Particle system internal state
+typedef struct ParticleState {
+    int capacity;               // Particles pool capacity
+    int count;                  // Particles count (CPU: alive particles, GPU: pool used particles, including dead ones)
+    int next;                   // Next particle to emit (GPU: pool used as ring buffer)
+    int updateMode;             // Particles update mode (ParticleUpdateMode)
+    unsigned int seed;          // Random seed for emitted particles velocity spread
+    float *data;                // Particles data arrays (capacity*PARTICLE_DATA_ARRAYS)
+    double time;                // Particles update time (GPU: sum of update delta times)
+    double *deathTimes;         // Particles death time (GPU: alive particles are counted on CPU, no GPU readback)
+    unsigned int bufferId;      // Particles data buffer id (CPU: vertex buffer, GPU: shader storage buffer)
+    unsigned int computeShaderId;   // Particles update compute shader id
+    int computeLocs[7];         // Particles update compute shader uniform locations
+    unsigned int shaderId;      // Particles drawing shader id
+    int shaderLocs[1];          // Particles drawing shader uniform locations: mvp
+    unsigned int vaoId;         // Particles drawing vertex array id (VAO)
+    unsigned int quadBufferId;  // Particle quad vertex buffer id
+    bool drawingLoaded;         // Particles instanced drawing loaded (or failed to load)
+} ParticleState;
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static float GetParticleRandom(unsigned int *seed);         // Get particle random value (xorshift), [0..1] range
+static unsigned int GetParticleColor(Color start, Color end, float t);  // Get particle color interpolated over life, packed RGBA bytes
+#if defined(GRAPHICS_API_OPENGL_33)
+static void LoadParticleDrawing(ParticleState *state);      // Load particles instanced drawing shader and vertex array
+#endif
+#if defined(GRAPHICS_API_OPENGL_43)
+static bool LoadParticleUpdate(ParticleState *state);       // Load particles update compute shader and storage buffer
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load particle system, particles pool stored as structure of arrays
+// NOTE: PARTICLE_UPDATE_GPU requires OpenGL 4.3 compute shaders, CPU update is used if not available
+ParticleSystem LoadParticleSystem(int capacity, int updateMode)
+{
+    ParticleSystem system = { 0 };
+
+    if (capacity <= 0) return system;
+
+    ParticleState *state = (ParticleState *)RL_CALLOC(1, sizeof(ParticleState));
+    if (state != NULL) state->data = (float *)RL_CALLOC(capacity*PARTICLE_DATA_ARRAYS, sizeof(float));
+
+    if ((state == NULL) || (state->data == NULL))
+    {
+        RL_FREE(state);
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to allocate particle system");
+        return system;
+    }
+
+    state->capacity = capacity;
+    state->updateMode = PARTICLE_UPDATE_CPU;
+    state->seed = (unsigned int)GetRandomValue(1, 0x7fffffff);
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (updateMode == PARTICLE_UPDATE_GPU)
+    {
+        state->deathTimes = (double *)RL_CALLOC(capacity, sizeof(double));
+        if ((state->deathTimes != NULL) && LoadParticleUpdate(state)) state->updateMode = PARTICLE_UPDATE_GPU;
+    }
+#endif
+
+    if (updateMode != state->updateMode) TRACELOG(LOG_WARNING, "PARTICLES: Compute shaders not available, particles updated on CPU");
+
+    system.capacity = capacity;
+    system.gravity = (Vector2){ 0.0f, 0.0f };
+    system.startSize = 8.0f;
+    system.endSize = 8.0f;
+    system.startColor = WHITE;
+    system.endColor = (Color){ 255, 255, 255, 0 };
+    system.state = state;
+
+    return system;
+}
+
+// Unload particle system pool and GPU buffers
+void UnloadParticleSystem(ParticleSystem system)
+{
+    ParticleState *state = (ParticleState *)system.state;
+    if (state == NULL) return;
+
+    if (state->vaoId > 0) rlUnloadVertexArray(state->vaoId);
+    if (state->quadBufferId > 0) rlUnloadVertexBuffer(state->quadBufferId);
+    if (state->shaderId > 0) rlUnloadShaderProgram(state->shaderId);
+
+    if (state->updateMode == PARTICLE_UPDATE_GPU)
+    {
+        rlUnloadShaderBuffer(state->bufferId);
+        rlUnloadShaderProgram(state->computeShaderId);
+    }
+    else if (state->bufferId > 0) rlUnloadVertexBuffer(state->bufferId);
+
+    RL_FREE(state->deathTimes);
+    RL_FREE(state->data);
+    RL_FREE(state);
+}
+
+// Emit particles at position, velocity randomly varied by spread (per component)
+// NOTE: CPU update: particles over capacity are not emitted,
+// GPU update: pool is used as a ring buffer, oldest particles are replaced
+void EmitParticles(ParticleSystem system, Vector2 position, Vector2 velocity, float spread, float lifetime, int count)
+{
+    ParticleState *state = (ParticleState *)system.state;
+    if ((state == NULL) || (lifetime <= 0.0f) || (count <= 0)) return;
+
+    int capacity = state->capacity;
+    int first = (state->updateMode == PARTICLE_UPDATE_GPU)? state->next : state->count;
+
+    if (state->updateMode == PARTICLE_UPDATE_GPU) { if (count > capacity) count = capacity; }
+    else if (count > (capacity - state->count)) count = capacity - state->count;
+
+    unsigned int color = GetParticleColor(system.startColor, system.endColor, 0.0f);
+
+    for (int i = 0; i < count; i++)
+    {
+        int k = (first + i)%capacity;
+
+        state->data[PARTICLE_POSITION_X*capacity + k] = position.x;
+        state->data[PARTICLE_POSITION_Y*capacity + k] = position.y;
+        state->data[PARTICLE_VELOCITY_X*capacity + k] = velocity.x + spread*(2.0f*GetParticleRandom(&state->seed) - 1.0f);
+        state->data[PARTICLE_VELOCITY_Y*capacity + k] = velocity.y + spread*(2.0f*GetParticleRandom(&state->seed) - 1.0f);
+        state->data[PARTICLE_AGE*capacity + k] = 0.0f;
+        state->data[PARTICLE_LIFE_INVERSE*capacity + k] = 1.0f/lifetime;
+        state->data[PARTICLE_SIZE*capacity + k] = system.startSize;
+        ((unsigned int *)&state->data[PARTICLE_COLOR*capacity])[k] = color;
+    }
+
+    if (state->updateMode == PARTICLE_UPDATE_GPU)
+    {
+        for (int i = 0; i < count; i++) state->deathTimes[(first + i)%capacity] = state->time + lifetime;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (state->updateMode == PARTICLE_UPDATE_GPU)
+    {
+        // Upload emitted particles, range can wrap around pool end
+        int firstCount = (first + count > capacity)? capacity - first : count;
+
+        for (int a = 0; a < PARTICLE_DATA_ARRAYS; a++)
+        {
+            rlUpdateShaderBuffer(state->bufferId, &state->data[a*capacity + first], firstCount*sizeof(float), (a*capacity + first)*sizeof(float));
+            if (count > firstCount) rlUpdateShaderBuffer(state->bufferId, &state->data[a*capacity], (count - firstCount)*sizeof(float), a*capacity*sizeof(float));
+        }
+
+        state->next = (first + count)%capacity;
+        state->count = (state->count + count > capacity)? capacity : state->count + count;
+        return;
+    }
+#endif
+
+    state->count += count;
+}
+
+// Update particle system: integrate particles, interpolate color and size over life, remove dead particles
+// NOTE: CPU update is vectorized (4 particles per step) if RAYMATH_SIMD is enabled
+void UpdateParticleSystem(ParticleSystem system, float deltaTime)
+{
+    ParticleState *state = (ParticleState *)system.state;
+    if ((state == NULL) || (state->count == 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (state->updateMode == PARTICLE_UPDATE_GPU)
+    {
+        float gravity[2] = { system.gravity.x, system.gravity.y };
+        float size[2] = { system.startSize, system.endSize };
+        float startColor[4] = { system.startColor.r/255.0f, system.startColor.g/255.0f, system.startColor.b/255.0f, system.startColor.a/255.0f };
+        float endColor[4] = { system.endColor.r/255.0f, system.endColor.g/255.0f, system.endColor.b/255.0f, system.endColor.a/255.0f };
+
+        rlEnableShader(state->computeShaderId);
+        rlSetUniform(state->computeLocs[0], &state->capacity, RL_SHADER_UNIFORM_INT, 1);
+        rlSetUniform(state->computeLocs[1], &state->count, RL_SHADER_UNIFORM_INT, 1);
+        rlSetUniform(state->computeLocs[2], &deltaTime, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(state->computeLocs[3], gravity, RL_SHADER_UNIFORM_VEC2, 1);
+        rlSetUniform(state->computeLocs[4], size, RL_SHADER_UNIFORM_VEC2, 1);
+        rlSetUniform(state->computeLocs[5], startColor, RL_SHADER_UNIFORM_VEC4, 1);
+        rlSetUniform(state->computeLocs[6], endColor, RL_SHADER_UNIFORM_VEC4, 1);
+        rlBindShaderBuffer(state->bufferId, 0);
+        rlComputeShaderDispatch((state->count + PARTICLE_COMPUTE_GROUP_SIZE - 1)/PARTICLE_COMPUTE_GROUP_SIZE, 1, 1);
+        rlComputeShaderBarrier();
+        rlDisableShader();
+
+        state->time += deltaTime;
+
+        return;
+    }
+#endif
+
+    int capacity = state->capacity;
+    float *positionsX = &state->data[PARTICLE_POSITION_X*capacity];
+    float *positionsY = &state->data[PARTICLE_POSITION_Y*capacity];
+    float *velocitiesX = &state->data[PARTICLE_VELOCITY_X*capacity];
+    float *velocitiesY = &state->data[PARTICLE_VELOCITY_Y*capacity];
+    float *ages = &state->data[PARTICLE_AGE*capacity];
+    float *lifeInverses = &state->data[PARTICLE_LIFE_INVERSE*capacity];
+    float *sizes = &state->data[PARTICLE_SIZE*capacity];
+    unsigned int *colors = (unsigned int *)&state->data[PARTICLE_COLOR*capacity];
+
+    float gravityX = system.gravity.x*deltaTime;
+    float gravityY = system.gravity.y*deltaTime;
+    float sizeDelta = system.endSize - system.startSize;
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_ENABLED)
+    rmFloat4 deltaTime4 = RM_SPLAT4(deltaTime);
+    rmFloat4 gravityX4 = RM_SPLAT4(gravityX);
+    rmFloat4 gravityY4 = RM_SPLAT4(gravityY);
+    rmFloat4 startSize4 = RM_SPLAT4(system.startSize);
+    rmFloat4 sizeDelta4 = RM_SPLAT4(sizeDelta);
+    rmFloat4 one4 = RM_SPLAT4(1.0f);
+    float life[4] = { 0 };
+
+    for (; (i + 4) <= state->count; i += 4)
+    {
+        rmFloat4 age = RM_ADD4(RM_LOAD4(&ages[i]), deltaTime4);
+        rmFloat4 t = RM_MIN4(RM_MUL4(age, RM_LOAD4(&lifeInverses[i])), one4);
+        rmFloat4 velocityX = RM_ADD4(RM_LOAD4(&velocitiesX[i]), gravityX4);
+        rmFloat4 velocityY = RM_ADD4(RM_LOAD4(&velocitiesY[i]), gravityY4);
+
+        RM_STORE4(&positionsX[i], RM_ADD4(RM_LOAD4(&positionsX[i]), RM_MUL4(velocityX, deltaTime4)));
+        RM_STORE4(&positionsY[i], RM_ADD4(RM_LOAD4(&positionsY[i]), RM_MUL4(velocityY, deltaTime4)));
+        RM_STORE4(&velocitiesX[i], velocityX);
+        RM_STORE4(&velocitiesY[i], velocityY);
+        RM_STORE4(&ages[i], age);
+        RM_STORE4(&sizes[i], RM_ADD4(startSize4, RM_MUL4(sizeDelta4, t)));
+        RM_STORE4(life, t);
+
+        colors[i] = GetParticleColor(system.startColor, system.endColor, life[0]);
+        colors[i + 1] = GetParticleColor(system.startColor, system.endColor, life[1]);
+        colors[i + 2] = GetParticleColor(system.startColor, system.endColor, life[2]);
+        colors[i + 3] = GetParticleColor(system.startColor, system.endColor, life[3]);
+    }
+#endif
+
+    for (; i < state->count; i++)
+    {
+        float t = fminf((ages[i] + deltaTime)*lifeInverses[i], 1.0f);
+
+        velocitiesX[i] += gravityX;
+        velocitiesY[i] += gravityY;
+        positionsX[i] += velocitiesX[i]*deltaTime;
+        positionsY[i] += velocitiesY[i]*deltaTime;
+        ages[i] += deltaTime;
+        sizes[i] = system.startSize + sizeDelta*t;
+        colors[i] = GetParticleColor(system.startColor, system.endColor, t);
+    }
+
+    // Remove dead particles, alive particles are kept packed (last particle moved to dead particle)
+    for (i = 0; i < state->count; )
+    {
+        if ((ages[i]*lifeInverses[i]) >= 1.0f)
+        {
+            int last = --state->count;
+
+            for (int a = 0; a < PARTICLE_COLOR; a++) state->data[a*capacity + i] = state->data[a*capacity + last];
+            colors[i] = colors[last];
+        }
+        else i++;
+    }
+}
+
+// Draw particle system particles with texture (white quads if texture is not valid)
+// NOTE: Particles are drawn instanced in a single draw call, render batch is used on OpenGL 1.1, 2.1 and ES2
+void DrawParticleSystem(ParticleSystem system, Texture2D texture)
+{
+    ParticleState *state = (ParticleState *)system.state;
+    if ((state == NULL) || (state->count == 0)) return;
+
+    unsigned int textureId = (texture.id > 0)? texture.id : rlGetTextureIdDefault();
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!state->drawingLoaded && (rlGetVersion() >= RL_OPENGL_33) && (rlGetVersion() <= RL_OPENGL_43)) LoadParticleDrawing(state);
+
+    if (state->vaoId > 0)
+    {
+        int capacity = state->capacity;
+
+        // Upload particles drawing data (position, size, color), GPU updated particles are already on GPU
+        if (state->updateMode == PARTICLE_UPDATE_CPU)
+        {
+            rlUpdateVertexBuffer(state->bufferId, &state->data[PARTICLE_POSITION_X*capacity], state->count*sizeof(float), PARTICLE_POSITION_X*capacity*sizeof(float));
+            rlUpdateVertexBuffer(state->bufferId, &state->data[PARTICLE_POSITION_Y*capacity], state->count*sizeof(float), PARTICLE_POSITION_Y*capacity*sizeof(float));
+            rlUpdateVertexBuffer(state->bufferId, &state->data[PARTICLE_SIZE*capacity], state->count*sizeof(float), PARTICLE_SIZE*capacity*sizeof(float));
+            rlUpdateVertexBuffer(state->bufferId, &state->data[PARTICLE_COLOR*capacity], state->count*sizeof(float), PARTICLE_COLOR*capacity*sizeof(float));
+        }
+
+        rlDrawRenderBatchActive();      // Draw textures batched before particles
+
+        rlEnableShader(state->shaderId);
+
+        Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+        rlSetUniformMatrix(state->shaderLocs[0], MatrixMultiply(matModelView, rlGetMatrixProjection()));
+
+        rlActiveTextureSlot(0);
+        rlEnableTexture(textureId);
+
+        rlEnableVertexArray(state->vaoId);
+        rlDrawVertexArrayInstanced(0, 6, state->count);
+        rlDisableVertexArray();
+
+        rlDisableTexture();
+        rlDisableShader();
+
+        return;
+    }
+#endif
+
+    // Particles drawn with render batch if instancing is not available
+    int capacity = state->capacity;
+    const float *positionsX = &state->data[PARTICLE_POSITION_X*capacity];
+    const float *positionsY = &state->data[PARTICLE_POSITION_Y*capacity];
+    const float *sizes = &state->data[PARTICLE_SIZE*capacity];
+    const unsigned char *colors = (const unsigned char *)&state->data[PARTICLE_COLOR*capacity];
+
+    rlSetTexture(textureId);
+    rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);   // Normal vector pointing towards viewer
+
+        for (int i = 0; i < state->count; i++)
+        {
+            float half = sizes[i]/2.0f;
+
+            rlColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+            rlTexCoord2f(0.0f, 0.0f); rlVertex2f(positionsX[i] - half, positionsY[i] - half);
+            rlTexCoord2f(0.0f, 1.0f); rlVertex2f(positionsX[i] - half, positionsY[i] + half);
+            rlTexCoord2f(1.0f, 1.0f); rlVertex2f(positionsX[i] + half, positionsY[i] + half);
+            rlTexCoord2f(1.0f, 0.0f); rlVertex2f(positionsX[i] + half, positionsY[i] - half);
+        }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Get particle system alive particles count
+// NOTE: GPU update: every particle ages the same delta time per update, so particles alive on GPU
+// are counted on CPU from their death times, no particles data is read back from GPU
+int GetParticleCount(ParticleSystem system)
+{
+    ParticleState *state = (ParticleState *)system.state;
+    if (state == NULL) return 0;
+
+    int count = state->count;
+
+    if (state->updateMode == PARTICLE_UPDATE_GPU)
+    {
+        count = 0;
+        for (int i = 0; i < state->count; i++) count += (state->deathTimes[i] > state->time);
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Get particle random value (xorshift), [0..1] range
+static float GetParticleRandom(unsigned int *seed)
+{
+    unsigned int x = *seed;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+
+    return (float)(x >> 8)/16777216.0f;
+}
+
+// Get particle color interpolated over life, packed RGBA bytes
+static unsigned int GetParticleColor(Color start, Color end, float t)
+{
+    Color color = {
+        (unsigned char)(start.r + (end.r - start.r)*t),
+        (unsigned char)(start.g + (end.g - start.g)*t),
+        (unsigned char)(start.b + (end.b - start.b)*t),
+        (unsigned char)(start.a + (end.a - start.a)*t)
+    };
+
+    unsigned int packed = 0;
+    memcpy(&packed, &color, sizeof(unsigned int));
+
+    return packed;
+}
+
+#if defined(GRAPHICS_API_OPENGL_43)
+// Load particles update compute shader and storage buffer
+// NOTE: Storage buffer uses particles data arrays layout, particles are integrated and
+// interpolated over life on GPU, dead particles are kept in pool with zero size
+static bool LoadParticleUpdate(ParticleState *state)
+{
+    const char *particleCShaderCode =
+    "#version 430                       \n"
+    "layout(local_size_x = 256) in;     \n"
+    "layout(std430, binding = 0) buffer particleData { float data[]; }; \n"
+    "uniform int capacity;              \n"
+    "uniform int count;                 \n"
+    "uniform float deltaTime;           \n"
+    "uniform vec2 gravity;              \n"
+    "uniform vec2 size;                 \n"
+    "uniform vec4 startColor;           \n"
+    "uniform vec4 endColor;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    int i = int(gl_GlobalInvocationID.x); \n"
+    "    if (i >= count) return;        \n"
+    "    float lifeInverse = data[5*capacity + i]; \n"
+    "    float age = data[4*capacity + i] + deltaTime; \n"
+    "    float t = min(age*lifeInverse, 1.0); \n"
+    "    vec2 velocity = vec2(data[2*capacity + i], data[3*capacity + i]) + gravity*deltaTime; \n"
+    "    data[0*capacity + i] += velocity.x*deltaTime; \n"
+    "    data[1*capacity + i] += velocity.y*deltaTime; \n"
+    "    data[2*capacity + i] = velocity.x; \n"
+    "    data[3*capacity + i] = velocity.y; \n"
+    "    data[4*capacity + i] = age;    \n"
+    "    data[6*capacity + i] = ((lifeInverse > 0.0) && (t < 1.0))? mix(size.x, size.y, t) : 0.0; \n"
+    "    data[7*capacity + i] = uintBitsToFloat(packUnorm4x8(mix(startColor, endColor, t))); \n"
+    "}                                  \n";
+
+    unsigned int shaderId = rlCompileShader(particleCShaderCode, RL_COMPUTE_SHADER);
+    if (shaderId > 0) state->computeShaderId = rlLoadComputeShaderProgram(shaderId);
+
+    if (state->computeShaderId == 0) return false;
+
+    state->bufferId = rlLoadShaderBuffer(state->capacity*PARTICLE_DATA_ARRAYS*sizeof(float), NULL, RL_DYNAMIC_COPY);
+
+    state->computeLocs[0] = rlGetLocationUniform(state->computeShaderId, "capacity");
+    state->computeLocs[1] = rlGetLocationUniform(state->computeShaderId, "count");
+    state->computeLocs[2] = rlGetLocationUniform(state->computeShaderId, "deltaTime");
+    state->computeLocs[3] = rlGetLocationUniform(state->computeShaderId, "gravity");
+    state->computeLocs[4] = rlGetLocationUniform(state->computeShaderId, "size");
+    state->computeLocs[5] = rlGetLocationUniform(state->computeShaderId, "startColor");
+    state->computeLocs[6] = rlGetLocationUniform(state->computeShaderId, "endColor");
+
+    return true;
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Load particles instanced drawing shader and vertex array
+// NOTE: One quad is drawn per particle instance, instance attributes (position, size, color)
+// are read from particles data arrays buffer (CPU: vertex buffer, GPU: compute shader storage buffer)
+static void LoadParticleDrawing(ParticleState *state)
+{
+    const char *particleVShaderCode =
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in float particleX;                \n"
+    "in float particleY;                \n"
+    "in float particleSize;             \n"
+    "in vec4 particleColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = particleColor;     \n"
+    "    gl_Position = mvp*vec4(vec2(particleX, particleY) + vertexPosition*particleSize, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *particleFShaderCode =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+
+    state->drawingLoaded = true;
+    state->shaderId = rlLoadShaderCode(particleVShaderCode, particleFShaderCode);
+
+    if ((state->shaderId == 0) || (state->shaderId == rlGetShaderIdDefault()))
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particles shader, particles drawn with render batch");
+        state->shaderId = 0;
+        return;
+    }
+
+    state->shaderLocs[0] = rlGetLocationUniform(state->shaderId, "mvp");
+
+    // Particle quad vertices: top-left, bottom-left, bottom-right, top-left, bottom-right, top-right (position, texcoord)
+    float quad[24] = {
+        -0.5f, -0.5f, 0.0f, 0.0f,
+        -0.5f, 0.5f, 0.0f, 1.0f,
+        0.5f, 0.5f, 1.0f, 1.0f,
+        -0.5f, -0.5f, 0.0f, 0.0f,
+        0.5f, 0.5f, 1.0f, 1.0f,
+        0.5f, -0.5f, 1.0f, 0.0f
+    };
+
+    int capacity = state->capacity;
+
+    state->vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(state->vaoId);
+
+    // Quad vertex attributes use default shader locations: vertexPosition (0) and vertexTexCoord (1)
+    state->quadBufferId = rlLoadVertexBuffer(quad, sizeof(quad), false);
+    rlSetVertexAttribute(0, 2, RL_FLOAT, false, 4*sizeof(float), (void *)0);
+    rlEnableVertexAttribute(0);
+    rlSetVertexAttribute(1, 2, RL_FLOAT, false, 4*sizeof(float), (void *)(2*sizeof(float)));
+    rlEnableVertexAttribute(1);
+
+    if (state->updateMode == PARTICLE_UPDATE_CPU) state->bufferId = rlLoadVertexBuffer(NULL, capacity*PARTICLE_DATA_ARRAYS*sizeof(float), true);
+    else rlEnableVertexBuffer(state->bufferId);
+
+    // Instance attributes, one value per particle
+    const char *names[4] = { "particleX", "particleY", "particleSize", "particleColor" };
+    const int arrays[4] = { PARTICLE_POSITION_X, PARTICLE_POSITION_Y, PARTICLE_SIZE, PARTICLE_COLOR };
+
+    for (int i = 0; i < 4; i++)
+    {
+        int location = rlGetLocationAttrib(state->shaderId, names[i]);
+        if (location < 0) continue;
+
+        if (arrays[i] == PARTICLE_COLOR) rlSetVertexAttribute(location, 4, RL_UNSIGNED_BYTE, true, 0, (void *)(arrays[i]*capacity*sizeof(float)));
+        else rlSetVertexAttribute(location, 1, RL_FLOAT, false, 0, (void *)(arrays[i]*capacity*sizeof(float)));
+        rlEnableVertexAttribute(location);
+        rlSetVertexAttributeDivisor(location, 1);
+    }
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+}
+#endif
+
+#endif // PARTICLES_IMPLEMENTATION
@@ -22,6 +22,19 @@
 *       #define SUPPORT_QUADS_DRAW_MODE
 *           Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
 *
+*   BROADPHASE:
+*       Broadphase2D keeps a set of boxes (moving shapes bounds) and finds overlapping boxes pairs,
+*       pairs can be checked later with narrow-phase functions (CheckCollisionRecs(), CheckCollisionCircles()...)
+*       Two structures are provided: a uniform grid (spatial hash, sorted every query) for many moving boxes
+*       of similar size, and a dynamic AABB tree (boxes enlarged by a margin) for boxes of varying size,
+*       grid boxes overlapping more than BROADPHASE_MAX_BOX_CELLS cells are checked against all boxes
+*
+*   PATHS:
+*       Path2D records vector paths (lines, quadratic/cubic curves and arcs), curves are flattened
+*       adaptively to path tolerance. StrokePath2D() tessellates path stroke (joins and caps) into a
+*       vertex buffer kept on GPU, DrawPath2D() draws it in a single draw call, anti-aliased on shader
+*       from every vertex distance to the stroke center line
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -53,11 +66,16 @@
 
 #if defined(SUPPORT_MODULE_RSHAPES)
 
+#include "utils.h"      // Required for: TRACELOG()
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
+#include "raymath.h"    // Required for: Vector2 and Matrix functionality
+
+#define BOUNDS_IMPLEMENTATION
+#include "rbounds.h"   // Required for: BoundsTree, broadphase tree
 
 #include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
 #include <float.h>      // Required for: FLT_EPSILON
-#include <stdlib.h>     // Required for: RL_FREE
+#include <stdlib.h>     // Required for: RL_MALLOC(), RL_REALLOC(), RL_FREE()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -70,12 +88,116 @@
 #ifndef BEZIER_LINE_DIVISIONS
     #define BEZIER_LINE_DIVISIONS       24      // Bezier line divisions
 #endif
+#ifndef MAX_SHAPES_ARC_CACHE
+    #define MAX_SHAPES_ARC_CACHE        16      // Maximum number of unit arcs cached for circular shapes drawing
+#endif
+#ifndef MAX_SHAPES_ARC_SEGMENTS
+    #define MAX_SHAPES_ARC_SEGMENTS    256      // Maximum segments of a cached unit arc, longer arcs are computed on drawing
+#endif
+#ifndef PATH_FLATTEN_TOLERANCE
+    #define PATH_FLATTEN_TOLERANCE    0.25f     // Path curves default flattening tolerance (maximum distance to curve)
+#endif
+#ifndef PATH_MITER_LIMIT
+    #define PATH_MITER_LIMIT          4.0f      // Path miter joins maximum length (relative to stroke half thickness), bevel if longer
+#endif
+#ifndef BROADPHASE_MAX_BOX_CELLS
+    #define BROADPHASE_MAX_BOX_CELLS    64      // Broadphase grid maximum cells per box, bigger boxes are checked against all boxes
+#endif
+
+#define BROADPHASE_GRID_LIMIT    1048576.0f     // Broadphase grid cell coordinates limit (per axis), positions outside are clamped
+
+#define PATH_VERTEX_FLOATS             4        // Path stroke vertex: position (x, y), distance to center line, stroke half thickness
 
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit arc points cached for circular shapes drawing
+// NOTE: Points store { sinf(), cosf() } of (i*stepLength) angles, arcs are rotated to start angle on drawing
+typedef struct ShapeArcTable {
+    int segments;                   // Arc segments (points - 1), 0 if table is not used
+    float stepLength;               // Arc step angle (degrees)
+    Vector2 points[MAX_SHAPES_ARC_SEGMENTS + 1];    // Arc unit points
+} ShapeArcTable;
+
+// Arc to draw: cached unit arc rotated to start angle
+typedef struct ShapeArc {
+    const Vector2 *points;          // Cached unit arc points, NULL if arc is not cached
+    float startAngle;               // Arc start angle (degrees)
+    float stepLength;               // Arc step angle (degrees)
+    float startSin;                 // Arc start angle sine
+    float startCos;                 // Arc start angle cosine
+} ShapeArc;
+
+// Path sub-path, range of path points
+typedef struct PathSubpath {
+    int start;                      // Sub-path first point index
+    int count;                      // Sub-path points count
+    bool closed;                    // Sub-path is closed (last point joins first point)
+} PathSubpath;
+
+// Path internal state
+typedef struct PathState {
+    Vector2 *points;                // Path points (curves flattened)
+    int pointCount;                 // Path points count
+    int pointCapacity;              // Path points capacity
+
+    PathSubpath *subpaths;          // Path sub-paths
+    int subpathCount;               // Path sub-paths count
+    int subpathCapacity;            // Path sub-paths capacity
+
+    float *vertices;                // Stroke vertices (PATH_VERTEX_FLOATS per vertex, triangles)
+    int vertexCount;                // Stroke vertices count
+    int vertexCapacity;             // Stroke vertices capacity (floats)
+
+    unsigned int vaoId;             // Stroke vertex array id (VAO)
+    unsigned int vboId;             // Stroke vertex buffer id (VBO)
+    int vboCapacity;                // Stroke vertex buffer capacity (vertices)
+} PathState;
+
+// Broadphase box
+typedef struct BroadphaseBox {
+    Rectangle rec;                  // Box bounds
+    int userId;                     // Box user id, reported in pairs
+    int node;                       // Box tree leaf node (BROADPHASE_TREE), next free box if removed
+    bool active;                    // Box is in use
+    bool large;                     // Box overlaps more than BROADPHASE_MAX_BOX_CELLS grid cells (BROADPHASE_GRID)
+} BroadphaseBox;
+
+// Broadphase grid cell entry, a box is registered in every cell it overlaps
+typedef struct BroadphaseCell {
+    unsigned int key;               // Cell hash key, entries are sorted by key
+    int x;                          // Cell x coordinate
+    int y;                          // Cell y coordinate
+    int box;                        // Box id
+} BroadphaseCell;
+
+// Broadphase internal state
+typedef struct BroadphaseState {
+    float cellSize;                 // Grid cell size (BROADPHASE_GRID) or boxes margin (BROADPHASE_TREE)
+
+    BroadphaseBox *boxes;           // Boxes array
+    int boxCount;                   // Boxes array used entries (including removed boxes)
+    int boxCapacity;                // Boxes array capacity
+    int freeBox;                    // First removed box (free list), -1 if none
+    int activeCount;                // Active boxes count
+
+    BoundsTree tree;                // Boxes tree, leaves bounds are boxes bounds enlarged by a margin
+
+    BroadphaseCell *cells;          // Grid cells entries, sorted by key
+    BroadphaseCell *cellsTemp;      // Grid cells entries sorting buffer
+    int cellCount;                  // Grid cells entries count
+    int cellCapacity;               // Grid cells entries capacity
+    bool cellsDirty;                // Grid cells entries require update (boxes changed)
+
+    int *largeBoxes;                // Grid boxes overlapping more than BROADPHASE_MAX_BOX_CELLS cells, not registered in cells
+    int largeCount;                 // Grid large boxes count
+    int largeCapacity;              // Grid large boxes capacity
+
+    BroadphasePair *pairs;          // Overlapping pairs found in last query
+    int pairCount;                  // Overlapping pairs count
+    int pairCapacity;               // Overlapping pairs capacity
+} BroadphaseState;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -83,10 +205,41 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (usually a white pixel)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static ShapeArcTable shapesArcCache[MAX_SHAPES_ARC_CACHE] = { 0 };    // Unit arcs cache for circular shapes drawing
+static int shapesArcCacheNext = 0;                          // Next unit arc cache entry to replace
+
+static unsigned int pathShaderId = 0;                       // Path stroke shader id (anti-aliasing)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static int pathShaderLocs[2] = { -1, -1 };                  // Path stroke shader locations: mvp, colDiffuse
+#endif
+static int pathCount = 0;                                   // Loaded paths count, path shader is unloaded with last path
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static float GetSmoothCircleSegments(float radius);                 // Get segments required for a smooth full circle
+static ShapeArc GetShapeArc(float startAngle, float stepLength, int segments);   // Get arc to draw, unit arc points are cached
+static inline Vector2 GetShapeArcPoint(ShapeArc arc, int index);    // Get arc point { sinf(), cosf() } at (startAngle + index*stepLength)
+
+static void *GrowShapesArray(void *array, int *capacity, int required, int size);         // Grow array capacity (doubling)
+static void AddBroadphasePair(BroadphaseState *state, int box1, int box2);                  // Add overlapping pair (boxes ids)
+static void UpdateBroadphaseCells(BroadphaseState *state);                                  // Update grid cells entries (sorted by key)
+static int GetBroadphaseCell(float position, float cellSize);                               // Get grid cell coordinate containing position (clamped)
+static int FindBroadphaseCell(BroadphaseState *state, unsigned int key);                    // Find first grid cell entry with key
+static int QueryBroadphaseTree(BroadphaseState *state, Rectangle rec, int *userIds, int maxCount);             // Query tree boxes overlapping rectangle
+
+static PathSubpath *GetPathSubpath(PathState *state, bool open);                           // Get current sub-path (open: new sub-path if current is closed)
+static void AddPathPoint(PathState *state, Vector2 point);                                  // Add point to current sub-path
+static void AddStrokeTriangle(PathState *state, Vector2 v1, float d1, Vector2 v2, float d2, Vector2 v3, float d3, float halfThick);    // Add stroke triangle (vertices distance to center line)
+static void AddStrokeFan(PathState *state, Vector2 center, Vector2 normal, float angle, float halfThick);   // Add stroke round fan (joins and caps)
+static float GetStrokeJoinCut(Vector2 prev, Vector2 point, Vector2 next, float halfThick, float *side);      // Get segments cut length at join inner side
+static void AddStrokeJoin(PathState *state, Vector2 prev, Vector2 point, Vector2 next, float halfThick, int join);  // Add stroke join at point
+static void AddStrokeCap(PathState *state, Vector2 point, Vector2 direction, float halfThick, int cap);     // Add stroke cap at point (direction pointing out)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadPathShader(void);                                                           // Load path stroke shader
+static void SetPathVertexAttributes(void);                                                  // Set path stroke vertex attributes for bound buffer
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -361,14 +514,14 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetSmoothCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapeArc arc = GetShapeArc(startAngle, stepLength, segments);
+    int index = 0;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -377,36 +530,43 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
         // NOTE: Every QUAD actually represents two segments
         for (int i = 0; i < segments/2; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+            Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+            Vector2 point3 = GetShapeArcPoint(arc, index + 2);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
+            rlVertex2f(center.x + point3.x*radius, center.y + point3.y*radius);
 
-            angle += (stepLength*2);
+            index += 2;
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
         if (segments%2)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+            Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -418,13 +578,16 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+            Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -449,39 +612,46 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetSmoothCircleSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapeArc arc = GetShapeArc(startAngle, stepLength, segments);
+    int index = 0;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+            Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
         }
     rlEnd();
 }
@@ -581,8 +751,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetSmoothCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -595,7 +764,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapeArc arc = GetShapeArc(startAngle, stepLength, segments);
+    int index = 0;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -603,21 +773,24 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     rlBegin(RL_QUADS);
         for (int i = 0; i < segments; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+            Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + point2.x*outerRadius, center.y + point2.y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 
@@ -626,17 +799,20 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+            Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
+            rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+            rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
+            rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+            rlVertex2f(center.x + point2.x*outerRadius, center.y + point2.y*outerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -671,8 +847,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetSmoothCircleSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -684,35 +859,43 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapeArc arc = GetShapeArc(startAngle, stepLength, segments);
+    int index = 0;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+            Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+            rlVertex2f(center.x + point2.x*outerRadius, center.y + point2.y*outerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
+            rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, index);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
         }
     rlEnd();
 }
@@ -938,8 +1121,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
+        segments = (int)(GetSmoothCircleSegments(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -973,6 +1155,9 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     const Vector2 centers[4] = { point[8], point[9], point[10], point[11] };
     const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
 
+    // NOTE: Corners share a full circle unit arc, every corner starts at (angle/90)*segments point
+    ShapeArc arc = GetShapeArc(0.0f, stepLength, 4*segments);
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
 
@@ -980,34 +1165,41 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            int index = (int)(angles[k]/90.0f)*segments;
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
             for (int i = 0; i < segments/2; i++)
             {
+                Vector2 point1 = GetShapeArcPoint(arc, index);
+                Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+                Vector2 point3 = GetShapeArcPoint(arc, index + 2);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-                angle += (stepLength*2);
+                rlVertex2f(center.x + point3.x*radius, center.y + point3.y*radius);
+                index += 2;
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
             if (segments%2)
             {
+                Vector2 point1 = GetShapeArcPoint(arc, index);
+                Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
             }
@@ -1076,15 +1268,18 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            int index = (int)(angles[k]/90.0f)*segments;
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
+                Vector2 point1 = GetShapeArcPoint(arc, index);
+                Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
+                rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
+                index++;
             }
         }
 
@@ -1158,8 +1353,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
+        segments = (int)(GetSmoothCircleSegments(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -1199,6 +1393,9 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
 
     const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
 
+    // NOTE: Corners share a full circle unit arc, every corner starts at (angle/90)*segments point
+    ShapeArc arc = GetShapeArc(0.0f, stepLength, 4*segments);
+
     if (lineThick > 1)
     {
 #if defined(SUPPORT_QUADS_DRAW_MODE)
@@ -1209,21 +1406,24 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = (int)(angles[k]/90.0f)*segments;
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
+                    Vector2 point1 = GetShapeArcPoint(arc, index);
+                    Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + point2.x*outerRadius, center.y + point2.y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1279,22 +1479,25 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = (int)(angles[k]/90.0f)*segments;
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
+                    Vector2 point1 = GetShapeArcPoint(arc, index);
+                    Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
+                    rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+                    rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
+                    rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+                    rlVertex2f(center.x + point2.x*outerRadius, center.y + point2.y*outerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1344,15 +1547,18 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = (int)(angles[k]/90.0f)*segments;
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
+                    Vector2 point1 = GetShapeArcPoint(arc, index);
+                    Vector2 point2 = GetShapeArcPoint(arc, index + 1);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + point1.x*outerRadius, center.y + point1.y*outerRadius);
+                    rlVertex2f(center.x + point2.x*outerRadius, center.y + point2.y*outerRadius);
+                    index++;
                 }
             }
 
@@ -1481,7 +1687,7 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
 void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation;
+    ShapeArc arc = GetShapeArc(rotation, 360.0f/(float)sides, sides);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -1489,20 +1695,22 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
     rlBegin(RL_QUADS);
         for (int i = 0; i < sides; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, i);
+            Vector2 point2 = GetShapeArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
 
-            centralAngle += 360.0f/(float)sides;
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
         }
     rlEnd();
     rlSetTexture(0);
@@ -1510,13 +1718,14 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < sides; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, i);
+            Vector2 point2 = GetShapeArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
-
-            centralAngle += 360.0f/(float)sides;
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
         }
     rlEnd();
 #endif
@@ -1526,16 +1735,18 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
 void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation;
+    ShapeArc arc = GetShapeArc(rotation, 360.0f/(float)sides, sides);
 
     rlBegin(RL_LINES);
         for (int i = 0; i < sides; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, i);
+            Vector2 point2 = GetShapeArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
-            centralAngle += 360.0f/(float)sides;
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
         }
     rlEnd();
 }
@@ -1543,9 +1754,9 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Colo
 void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation;
     float exteriorAngle = 360.0f/(float)sides;
     float innerRadius = radius - (lineThick*cosf(DEG2RAD*exteriorAngle/2.0f));
+    ShapeArc arc = GetShapeArc(rotation, exteriorAngle, sides);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -1553,20 +1764,22 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
     rlBegin(RL_QUADS);
         for (int i = 0; i < sides; i++)
         {
+            Vector2 point1 = GetShapeArcPoint(arc, i);
+            Vector2 point2 = GetShapeArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*innerRadius, center.y + cosf(DEG2RAD*centralAngle)*innerRadius);
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
 
-            centralAngle += exteriorAngle;
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*innerRadius, center.y + cosf(DEG2RAD*centralAngle)*innerRadius);
+            rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
         }
     rlEnd();
     rlSetTexture(0);
@@ -1574,23 +1787,393 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < sides; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            float nextAngle = centralAngle + exteriorAngle;
+            Vector2 point1 = GetShapeArcPoint(arc, i);
+            Vector2 point2 = GetShapeArcPoint(arc, i + 1);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*radius, center.y + cosf(DEG2RAD*centralAngle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*innerRadius, center.y + cosf(DEG2RAD*centralAngle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*nextAngle)*radius, center.y + cosf(DEG2RAD*nextAngle)*radius);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*centralAngle)*innerRadius, center.y + cosf(DEG2RAD*centralAngle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*nextAngle)*radius, center.y + cosf(DEG2RAD*nextAngle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*nextAngle)*innerRadius, center.y + cosf(DEG2RAD*nextAngle)*innerRadius);
+            rlVertex2f(center.x + point1.x*radius, center.y + point1.y*radius);
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
 
-            centralAngle = nextAngle;
+            rlVertex2f(center.x + point1.x*innerRadius, center.y + point1.y*innerRadius);
+            rlVertex2f(center.x + point2.x*radius, center.y + point2.y*radius);
+            rlVertex2f(center.x + point2.x*innerRadius, center.y + point2.y*innerRadius);
         }
     rlEnd();
 #endif
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Path (vector shapes) functions
+//----------------------------------------------------------------------------------
+
+// Load path for vector shapes stroking
+// NOTE: path.tolerance can be modified, it defines curves flattening maximum error (in path units)
+Path2D LoadPath2D(void)
+{
+    Path2D path = { 0 };
+
+    path.tolerance = PATH_FLATTEN_TOLERANCE;
+    path.state = RL_CALLOC(1, sizeof(PathState));
+
+    if (path.state == NULL) TRACELOG(LOG_WARNING, "SHAPES: Failed to allocate path");
+    else pathCount++;
+
+    return path;
+}
+
+// Unload path (points and stroke GPU buffers)
+void UnloadPath2D(Path2D path)
+{
+    PathState *state = (PathState *)path.state;
+    if (state == NULL) return;
+
+    if (state->vaoId > 0) rlUnloadVertexArray(state->vaoId);
+    if (state->vboId > 0) rlUnloadVertexBuffer(state->vboId);
+
+    RL_FREE(state->points);
+    RL_FREE(state->subpaths);
+    RL_FREE(state->vertices);
+    RL_FREE(state);
+
+    pathCount--;
+
+    // Unload stroke shader with last path
+    if ((pathCount <= 0) && (pathShaderId > 0))
+    {
+        rlUnloadShaderProgram(pathShaderId);
+        pathShaderId = 0;
+    }
+}
+
+// Clear path points, last stroke is kept until next StrokePath2D()
+void ClearPath2D(Path2D path)
+{
+    PathState *state = (PathState *)path.state;
+    if (state == NULL) return;
+
+    state->pointCount = 0;
+    state->subpathCount = 0;
+}
+
+// Begin a new sub-path at point
+void PathMoveTo(Path2D path, Vector2 point)
+{
+    PathState *state = (PathState *)path.state;
+    if (state == NULL) return;
+
+    PathSubpath *subpath = (state->subpathCount > 0)? &state->subpaths[state->subpathCount - 1] : NULL;
+
+    // Current sub-path without segments is reused
+    if ((subpath != NULL) && !subpath->closed && (subpath->count <= 1))
+    {
+        state->pointCount = subpath->start;
+        subpath->count = 0;
+    }
+    else
+    {
+        state->subpaths = (PathSubpath *)GrowShapesArray(state->subpaths, &state->subpathCapacity, state->subpathCount + 1, sizeof(PathSubpath));
+        if (state->subpathCount >= state->subpathCapacity) return;
+
+        subpath = &state->subpaths[state->subpathCount++];
+        subpath->start = state->pointCount;
+        subpath->count = 0;
+        subpath->closed = false;
+    }
+
+    AddPathPoint(state, point);
+}
+
+// Add line from current point to point
+void PathLineTo(Path2D path, Vector2 point)
+{
+    PathState *state = (PathState *)path.state;
+    if (state != NULL) AddPathPoint(state, point);
+}
+
+// Add lines from current point through points
+// NOTE: Path points array is grown once for all points
+void PathLineStrip(Path2D path, const Vector2 *points, int pointCount)
+{
+    PathState *state = (PathState *)path.state;
+    if ((state == NULL) || (points == NULL) || (pointCount <= 0)) return;
+
+    state->points = (Vector2 *)GrowShapesArray(state->points, &state->pointCapacity, state->pointCount + pointCount + 1, sizeof(Vector2));
+
+    for (int i = 0; i < pointCount; i++) AddPathPoint(state, points[i]);
+}
+
+// Add quadratic bezier curve from current point to point
+// NOTE: Curve is flattened in the segments count required to keep error under path.tolerance,
+// instead of the fixed BEZIER_LINE_DIVISIONS used by DrawLineBezier()
+void PathQuadraticTo(Path2D path, Vector2 control, Vector2 point)
+{
+    PathState *state = (PathState *)path.state;
+    if (state == NULL) return;
+
+    PathSubpath *subpath = GetPathSubpath(state, true);
+    if ((subpath == NULL) || (subpath->count == 0))
+    {
+        PathMoveTo(path, point);
+        return;
+    }
+
+    Vector2 start = state->points[subpath->start + subpath->count - 1];
+    float tolerance = (path.tolerance > 0.0f)? path.tolerance : PATH_FLATTEN_TOLERANCE;
+
+    // Segments count bound from curve second derivative (Wang's formula)
+    float dd = Vector2Length(Vector2Add(Vector2Subtract(start, Vector2Scale(control, 2.0f)), point));
+    int segments = (int)ceilf(sqrtf(dd/(4.0f*tolerance)));
+    if (segments < 1) segments = 1;
+
+    for (int i = 1; i <= segments; i++)
+    {
+        float t = (float)i/(float)segments;
+        float a = (1.0f - t)*(1.0f - t);
+        float b = 2.0f*(1.0f - t)*t;
+        float c = t*t;
+
+        AddPathPoint(state, (Vector2){ a*start.x + b*control.x + c*point.x, a*start.y + b*control.y + c*point.y });
+    }
+}
+
+// Add cubic bezier curve from current point to point
+// NOTE: Curve is flattened in the segments count required to keep error under path.tolerance
+void PathCubicTo(Path2D path, Vector2 control1, Vector2 control2, Vector2 point)
+{
+    PathState *state = (PathState *)path.state;
+    if (state == NULL) return;
+
+    PathSubpath *subpath = GetPathSubpath(state, true);
+    if ((subpath == NULL) || (subpath->count == 0))
+    {
+        PathMoveTo(path, point);
+        return;
+    }
+
+    Vector2 start = state->points[subpath->start + subpath->count - 1];
+    float tolerance = (path.tolerance > 0.0f)? path.tolerance : PATH_FLATTEN_TOLERANCE;
+
+    // Segments count bound from curve second derivative (Wang's formula)
+    float dd1 = Vector2Length(Vector2Add(Vector2Subtract(start, Vector2Scale(control1, 2.0f)), control2));
+    float dd2 = Vector2Length(Vector2Add(Vector2Subtract(control1, Vector2Scale(control2, 2.0f)), point));
+    int segments = (int)ceilf(sqrtf(0.75f*fmaxf(dd1, dd2)/tolerance));
+    if (segments < 1) segments = 1;
+
+    for (int i = 1; i <= segments; i++)
+    {
+        float t = (float)i/(float)segments;
+        float a = (1.0f - t)*(1.0f - t)*(1.0f - t);
+        float b = 3.0f*(1.0f - t)*(1.0f - t)*t;
+        float c = 3.0f*(1.0f - t)*t*t;
+        float d = t*t*t;
+
+        AddPathPoint(state, (Vector2){ a*start.x + b*control1.x + c*control2.x + d*point.x,
+                                       a*start.y + b*control1.y + c*control2.y + d*point.y });
+    }
+}
+
+// Add circle arc, a line joins current point to arc start point
+// NOTE: Angles follow DrawCircleSector() convention, arc goes from startAngle to endAngle in any direction
+void PathArc(Path2D path, Vector2 center, float radius, float startAngle, float endAngle)
+{
+    PathState *state = (PathState *)path.state;
+    if ((state == NULL) || (radius <= 0.0f)) return;
+
+    int segments = (int)ceilf(fabsf(endAngle - startAngle)*GetSmoothCircleSegments(radius)/360.0f);
+    if (segments < 1) segments = 1;
+
+    float stepLength = (endAngle - startAngle)/(float)segments;
+    ShapeArc arc = GetShapeArc(startAngle, stepLength, segments);
+
+    for (int i = 0; i <= segments; i++)
+    {
+        Vector2 point = GetShapeArcPoint(arc, i);
+        AddPathPoint(state, (Vector2){ center.x + point.x*radius, center.y + point.y*radius });
+    }
+}
+
+// Close current sub-path, a line joins last point to first point
+void PathClose(Path2D path)
+{
+    PathState *state = (PathState *)path.state;
+    if (state == NULL) return;
+
+    PathSubpath *subpath = GetPathSubpath(state, false);
+
+    if ((subpath != NULL) && (subpath->count > 1))
+    {
+        // Last point matching first point is not required
+        if (Vector2Equals(state->points[subpath->start], state->points[subpath->start + subpath->count - 1]))
+        {
+            subpath->count--;
+            state->pointCount--;
+        }
+
+        subpath->closed = true;
+    }
+}
+
+// Tessellate path stroke into path vertex buffer, uploaded to GPU
+// NOTE: Stroke is kept until next call, path can be cleared and filled again meanwhile
+void StrokePath2D(Path2D path, float thick, int join, int cap)
+{
+    PathState *state = (PathState *)path.state;
+    if (state == NULL) return;
+
+    float halfThick = thick/2.0f;
+    state->vertexCount = 0;
+
+    for (int s = 0; (s < state->subpathCount) && (halfThick > 0.0f); s++)
+    {
+        const Vector2 *points = &state->points[state->subpaths[s].start];
+        int count = state->subpaths[s].count;
+        bool closed = state->subpaths[s].closed && (count > 2);
+
+        if (count < 2) continue;
+
+        // Segments quads, vertices distance to center line is signed, so it goes through zero on center line
+        // NOTE: Segments are cut at the inner side of joins (inner offset lines intersection) and the cut
+        // corner is filled up to the join point, so adjacent segments do not overlap (no double blending)
+        int segmentCount = closed? count : count - 1;
+
+        for (int i = 0; i < segmentCount; i++)
+        {
+            Vector2 p1 = points[i];
+            Vector2 p2 = points[(i + 1)%count];
+            Vector2 direction = Vector2Normalize(Vector2Subtract(p2, p1));
+            Vector2 normal = { -direction.y*halfThick, direction.x*halfThick };
+
+            Vector2 startLeft = Vector2Add(p1, normal);
+            Vector2 startRight = Vector2Subtract(p1, normal);
+            Vector2 endLeft = Vector2Add(p2, normal);
+            Vector2 endRight = Vector2Subtract(p2, normal);
+
+            float startSide = 0.0f;
+            float endSide = 0.0f;
+            float startCut = (closed || (i > 0))? GetStrokeJoinCut(points[(i + count - 1)%count], p1, p2, halfThick, &startSide) : 0.0f;
+            float endCut = (closed || (i < (segmentCount - 1)))? GetStrokeJoinCut(p1, p2, points[(i + 2)%count], halfThick, &endSide) : 0.0f;
+
+            if (startCut > 0.0f)
+            {
+                if (startSide > 0.0f) startLeft = Vector2Add(startLeft, Vector2Scale(direction, startCut));
+                else startRight = Vector2Add(startRight, Vector2Scale(direction, startCut));
+            }
+
+            if (endCut > 0.0f)
+            {
+                if (endSide > 0.0f) endLeft = Vector2Subtract(endLeft, Vector2Scale(direction, endCut));
+                else endRight = Vector2Subtract(endRight, Vector2Scale(direction, endCut));
+            }
+
+            AddStrokeTriangle(state, startLeft, halfThick, startRight, -halfThick, endRight, -halfThick, halfThick);
+            AddStrokeTriangle(state, startLeft, halfThick, endRight, -halfThick, endLeft, halfThick, halfThick);
+
+            if (startCut > 0.0f) AddStrokeTriangle(state, startLeft, halfThick, p1, 0.0f, startRight, -halfThick, halfThick);
+            if (endCut > 0.0f) AddStrokeTriangle(state, endLeft, halfThick, endRight, -halfThick, p2, 0.0f, halfThick);
+        }
+
+        // Joins between segments
+        for (int i = (closed? 0 : 1); i < (closed? count : count - 1); i++)
+        {
+            AddStrokeJoin(state, points[(i + count - 1)%count], points[i], points[(i + 1)%count], halfThick, join);
+        }
+
+        // Caps at open sub-path ends
+        if (!closed)
+        {
+            AddStrokeCap(state, points[0], Vector2Normalize(Vector2Subtract(points[0], points[1])), halfThick, cap);
+            AddStrokeCap(state, points[count - 1], Vector2Normalize(Vector2Subtract(points[count - 1], points[count - 2])), halfThick, cap);
+        }
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Upload stroke to GPU, vertex buffer is only reloaded if stroke does not fit
+    if (state->vertexCount > state->vboCapacity)
+    {
+        if (state->vaoId > 0) rlUnloadVertexArray(state->vaoId);
+        if (state->vboId > 0) rlUnloadVertexBuffer(state->vboId);
+
+        state->vboCapacity = state->vertexCapacity/PATH_VERTEX_FLOATS;
+        state->vaoId = rlLoadVertexArray();
+        rlEnableVertexArray(state->vaoId);
+
+        state->vboId = rlLoadVertexBuffer(state->vertices, state->vboCapacity*PATH_VERTEX_FLOATS*sizeof(float), true);
+        SetPathVertexAttributes();
+
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+    }
+    else if (state->vertexCount > 0) rlUpdateVertexBuffer(state->vboId, state->vertices, state->vertexCount*PATH_VERTEX_FLOATS*sizeof(float), 0);
+#endif
+}
+
+// Draw path stroke (anti-aliased)
+// NOTE: Render batch is flushed before drawing, stroke is drawn in a single draw call,
+// stroke triangles winding depends on path turns, so backface culling is disabled while drawing
+void DrawPath2D(Path2D path, Color color)
+{
+    PathState *state = (PathState *)path.state;
+    if ((state == NULL) || (state->vertexCount == 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (pathShaderId == 0) LoadPathShader();
+
+    if ((pathShaderId > 0) && (state->vboId > 0))
+    {
+        rlDrawRenderBatchActive();      // Draw shapes batched before path
+
+        rlDisableBackfaceCulling();
+        rlEnableShader(pathShaderId);
+
+        Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+        rlSetUniformMatrix(pathShaderLocs[0], MatrixMultiply(matModelView, rlGetMatrixProjection()));
+
+        float values[4] = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+        rlSetUniform(pathShaderLocs[1], values, RL_SHADER_UNIFORM_VEC4, 1);
+
+        bool vaoEnabled = rlEnableVertexArray(state->vaoId);
+
+        if (!vaoEnabled)
+        {
+            rlEnableVertexBuffer(state->vboId);
+            SetPathVertexAttributes();
+        }
+
+        rlDrawVertexArray(0, state->vertexCount);
+
+        // Vertex attributes enabled without VAO (OpenGL ES 2.0) are global state, disabled so they do not
+        // point to path vertex buffer on next draw calls
+        if (!vaoEnabled)
+        {
+            rlDisableVertexAttribute(0);
+            rlDisableVertexAttribute(1);
+        }
+
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+        rlDisableShader();
+        rlEnableBackfaceCulling();
+
+        return;
+    }
+#endif
+
+    // Stroke drawn with render batch if path shader is not available, no anti-aliasing
+    rlDrawRenderBatchActive();
+    rlDisableBackfaceCulling();
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        for (int i = 0; i < state->vertexCount; i++) rlVertex2f(state->vertices[i*PATH_VERTEX_FLOATS], state->vertices[i*PATH_VERTEX_FLOATS + 1]);
+    rlEnd();
+
+    rlDrawRenderBatchActive();
+    rlEnableBackfaceCulling();
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Collision Detection functions
 //----------------------------------------------------------------------------------
@@ -1780,6 +2363,315 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
     return overlap;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Broadphase collision detection functions
+//----------------------------------------------------------------------------------
+
+// Load broadphase for boxes overlapping pairs detection
+// NOTE: cellSize is grid cell size (BROADPHASE_GRID), should be similar to common boxes size,
+// or boxes bounds margin (BROADPHASE_TREE), boxes moving inside their margin do not update tree
+Broadphase2D LoadBroadphase2D(int type, float cellSize)
+{
+    Broadphase2D broadphase = { 0 };
+
+    if ((type == BROADPHASE_GRID) && (cellSize <= 0.0f))
+    {
+        TRACELOG(LOG_WARNING, "SHAPES: Broadphase grid cell size must be greater than 0");
+        return broadphase;
+    }
+
+    BroadphaseState *state = (BroadphaseState *)RL_CALLOC(1, sizeof(BroadphaseState));
+    state->cellSize = (cellSize > 0.0f)? cellSize : 0.0f;
+    state->freeBox = -1;
+    state->tree = LoadBoundsTree(2);
+
+    broadphase.type = type;
+    broadphase.state = state;
+
+    return broadphase;
+}
+
+// Unload broadphase
+void UnloadBroadphase2D(Broadphase2D broadphase)
+{
+    BroadphaseState *state = (BroadphaseState *)broadphase.state;
+
+    if (state != NULL)
+    {
+        RL_FREE(state->boxes);
+        UnloadBoundsTree(&state->tree);
+        RL_FREE(state->cells);
+        RL_FREE(state->cellsTemp);
+        RL_FREE(state->largeBoxes);
+        RL_FREE(state->pairs);
+        RL_FREE(state);
+    }
+}
+
+// Add box to broadphase, returns box id (-1 on failure)
+// NOTE: userId is reported in overlapping pairs and queries, usually an index into user shapes array
+int AddBroadphaseBox(Broadphase2D broadphase, Rectangle box, int userId)
+{
+    BroadphaseState *state = (BroadphaseState *)broadphase.state;
+    if (state == NULL) return -1;
+
+    int id = state->freeBox;
+
+    if (id != -1) state->freeBox = state->boxes[id].node;
+    else
+    {
+        state->boxes = (BroadphaseBox *)GrowShapesArray(state->boxes, &state->boxCapacity, state->boxCount + 1, sizeof(BroadphaseBox));
+        if (state->boxCount >= state->boxCapacity) return -1;
+
+        id = state->boxCount++;
+    }
+
+    state->boxes[id].rec = box;
+    state->boxes[id].userId = userId;
+    state->boxes[id].node = -1;
+    state->boxes[id].active = true;
+    state->boxes[id].large = false;
+    state->activeCount++;
+
+    if (broadphase.type == BROADPHASE_TREE)
+    {
+        float min[2] = { box.x - state->cellSize, box.y - state->cellSize };
+        float max[2] = { box.x + box.width + state->cellSize, box.y + box.height + state->cellSize };
+
+        state->boxes[id].node = AddBoundsTreeLeaf(&state->tree, min, max, id);
+
+        // Tree nodes could not be allocated, box is removed
+        if (state->boxes[id].node == -1)
+        {
+            state->boxes[id].active = false;
+            state->boxes[id].node = state->freeBox;
+            state->freeBox = id;
+            state->activeCount--;
+            return -1;
+        }
+    }
+    else state->cellsDirty = true;
+
+    return id;
+}
+
+// Update box bounds
+void UpdateBroadphaseBox(Broadphase2D broadphase, int boxId, Rectangle box)
+{
+    BroadphaseState *state = (BroadphaseState *)broadphase.state;
+    if ((state == NULL) || (boxId < 0) || (boxId >= state->boxCount) || !state->boxes[boxId].active) return;
+
+    state->boxes[boxId].rec = box;
+
+    if (broadphase.type == BROADPHASE_TREE)
+    {
+        int leaf = state->boxes[boxId].node;
+        BoundsTreeNode *node = &state->tree.nodes[leaf];
+
+        // Box still inside its enlarged bounds, tree does not change
+        if ((box.x >= node->min[0]) && (box.y >= node->min[1]) &&
+            ((box.x + box.width) <= node->max[0]) && ((box.y + box.height) <= node->max[1])) return;
+
+        float min[2] = { box.x - state->cellSize, box.y - state->cellSize };
+        float max[2] = { box.x + box.width + state->cellSize, box.y + box.height + state->cellSize };
+
+        MoveBoundsTreeLeaf(&state->tree, leaf, min, max);
+    }
+    else state->cellsDirty = true;
+}
+
+// Remove box from broadphase, box id can be reused by next added box
+void RemoveBroadphaseBox(Broadphase2D broadphase, int boxId)
+{
+    BroadphaseState *state = (BroadphaseState *)broadphase.state;
+    if ((state == NULL) || (boxId < 0) || (boxId >= state->boxCount) || !state->boxes[boxId].active) return;
+
+    if (broadphase.type == BROADPHASE_TREE) RemoveBoundsTreeLeaf(&state->tree, state->boxes[boxId].node);
+    else state->cellsDirty = true;
+
+    state->boxes[boxId].active = false;
+    state->boxes[boxId].node = state->freeBox;
+    state->freeBox = boxId;
+    state->activeCount--;
+}
+
+// Get overlapping boxes pairs (boxes user ids), overlap is checked as CheckCollisionRecs()
+// NOTE: Returned array is owned by broadphase, it is valid until next call
+BroadphasePair *GetBroadphasePairs(Broadphase2D broadphase, int *pairCount)
+{
+    BroadphaseState *state = (BroadphaseState *)broadphase.state;
+
+    if (pairCount != NULL) *pairCount = 0;
+    if (state == NULL) return NULL;
+
+    state->pairCount = 0;
+
+    if (broadphase.type == BROADPHASE_TREE)
+    {
+        // Query tree for every box, pairs are reported by the box with lower id
+        for (int i = 0; i < state->boxCount; i++)
+        {
+            if (!state->boxes[i].active) continue;
+
+            Rectangle rec = state->boxes[i].rec;
+            int *stack = state->tree.stack;
+            int stackSize = 0;
+
+            if (state->tree.root != -1) stack[stackSize++] = state->tree.root;
+
+            while (stackSize > 0)
+            {
+                BoundsTreeNode *node = &state->tree.nodes[stack[--stackSize]];
+
+                if ((rec.x > node->max[0]) || ((rec.x + rec.width) < node->min[0]) ||
+                    (rec.y > node->max[1]) || ((rec.y + rec.height) < node->min[1])) continue;
+
+                if (node->child1 == -1)
+                {
+                    if ((node->item > i) && CheckCollisionRecs(rec, state->boxes[node->item].rec)) AddBroadphasePair(state, i, node->item);
+                }
+                else
+                {
+                    stack[stackSize++] = node->child1;
+                    stack[stackSize++] = node->child2;
+                }
+            }
+        }
+    }
+    else
+    {
+        if (state->cellsDirty) UpdateBroadphaseCells(state);
+
+        BroadphaseCell *cells = state->cells;
+
+        // Check boxes sharing a cell, every pair is reported once: in the first cell of both boxes bounds intersection
+        for (int start = 0, end = 0; start < state->cellCount; start = end)
+        {
+            end = start + 1;
+            while ((end < state->cellCount) && (cells[end].key == cells[start].key)) end++;
+
+            for (int i = start; i < end; i++)
+            {
+                for (int j = i + 1; j < end; j++)
+                {
+                    // Different cells can share the same key
+                    if ((cells[i].x != cells[j].x) || (cells[i].y != cells[j].y)) continue;
+
+                    Rectangle rec1 = state->boxes[cells[i].box].rec;
+                    Rectangle rec2 = state->boxes[cells[j].box].rec;
+
+                    if (!CheckCollisionRecs(rec1, rec2)) continue;
+
+                    int cellX = GetBroadphaseCell(fmaxf(rec1.x, rec2.x), state->cellSize);
+                    int cellY = GetBroadphaseCell(fmaxf(rec1.y, rec2.y), state->cellSize);
+
+                    if ((cells[i].x == cellX) && (cells[i].y == cellY))
+                    {
+                        if (cells[i].box < cells[j].box) AddBroadphasePair(state, cells[i].box, cells[j].box);
+                        else AddBroadphasePair(state, cells[j].box, cells[i].box);
+                    }
+                }
+            }
+        }
+
+        // Check large boxes against all boxes, pairs of two large boxes are reported by the box with lower id
+        for (int i = 0; i < state->largeCount; i++)
+        {
+            int large = state->largeBoxes[i];
+            Rectangle rec = state->boxes[large].rec;
+
+            for (int j = 0; j < state->boxCount; j++)
+            {
+                if (!state->boxes[j].active || (j == large) || (state->boxes[j].large && (j < large))) continue;
+                if (!CheckCollisionRecs(rec, state->boxes[j].rec)) continue;
+
+                if (large < j) AddBroadphasePair(state, large, j);
+                else AddBroadphasePair(state, j, large);
+            }
+        }
+    }
+
+    if (pairCount != NULL) *pairCount = state->pairCount;
+
+    return state->pairs;
+}
+
+// Get boxes overlapping a rectangle, returns boxes count (up to maxCount user ids registered)
+int GetBroadphaseBoxesRec(Broadphase2D broadphase, Rectangle rec, int *userIds, int maxCount)
+{
+    BroadphaseState *state = (BroadphaseState *)broadphase.state;
+    if (state == NULL) return 0;
+
+    int count = 0;
+
+    if (broadphase.type == BROADPHASE_TREE) count = QueryBroadphaseTree(state, rec, userIds, maxCount);
+    else
+    {
+        int x0 = GetBroadphaseCell(rec.x, state->cellSize);
+        int y0 = GetBroadphaseCell(rec.y, state->cellSize);
+        int x1 = GetBroadphaseCell(rec.x + rec.width, state->cellSize);
+        int y1 = GetBroadphaseCell(rec.y + rec.height, state->cellSize);
+
+        if (((float)(x1 - x0 + 1)*(float)(y1 - y0 + 1)) > (float)state->activeCount)
+        {
+            // Rectangle covers more cells than boxes, checking all boxes is faster
+            for (int i = 0; i < state->boxCount; i++)
+            {
+                if (state->boxes[i].active && CheckCollisionRecs(rec, state->boxes[i].rec))
+                {
+                    if (count < maxCount) userIds[count] = state->boxes[i].userId;
+                    count++;
+                }
+            }
+        }
+        else
+        {
+            if (state->cellsDirty) UpdateBroadphaseCells(state);
+
+            for (int y = y0; y <= y1; y++)
+            {
+                for (int x = x0; x <= x1; x++)
+                {
+                    unsigned int key = ((unsigned int)x*73856093u) ^ ((unsigned int)y*19349663u);
+
+                    for (int i = FindBroadphaseCell(state, key); (i < state->cellCount) && (state->cells[i].key == key); i++)
+                    {
+                        BroadphaseCell *cell = &state->cells[i];
+                        if ((cell->x != x) || (cell->y != y)) continue;
+
+                        Rectangle box = state->boxes[cell->box].rec;
+                        if (!CheckCollisionRecs(rec, box)) continue;
+
+                        // Box is reported once: in the first cell of box and rectangle cells intersection
+                        int cellX = GetBroadphaseCell(box.x, state->cellSize);
+                        int cellY = GetBroadphaseCell(box.y, state->cellSize);
+
+                        if ((x == ((cellX > x0)? cellX : x0)) && (y == ((cellY > y0)? cellY : y0)))
+                        {
+                            if (count < maxCount) userIds[count] = state->boxes[cell->box].userId;
+                            count++;
+                        }
+                    }
+                }
+            }
+
+            // Large boxes are not registered in cells
+            for (int i = 0; i < state->largeCount; i++)
+            {
+                int large = state->largeBoxes[i];
+
+                if (CheckCollisionRecs(rec, state->boxes[large].rec))
+                {
+                    if (count < maxCount) userIds[count] = state->boxes[large].userId;
+                    count++;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
@@ -1795,4 +2687,514 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return 0.5f*c*(t*t*t + 2.0f) + b;
 }
 
+
+// Grow array capacity (doubling), returns reallocated array
+static void *GrowShapesArray(void *array, int *capacity, int required, int size)
+{
+    if (required <= *capacity) return array;
+
+    int newCapacity = (*capacity > 0)? *capacity : 64;
+    while (newCapacity < required) newCapacity *= 2;
+
+    void *newArray = RL_REALLOC(array, (size_t)newCapacity*size);
+
+    if (newArray != NULL)
+    {
+        array = newArray;
+        *capacity = newCapacity;
+    }
+    else TRACELOG(LOG_WARNING, "SHAPES: Failed to grow array");
+
+    return array;
+}
+
+// Add overlapping pair (boxes ids), pair stores boxes user ids
+static void AddBroadphasePair(BroadphaseState *state, int box1, int box2)
+{
+    state->pairs = (BroadphasePair *)GrowShapesArray(state->pairs, &state->pairCapacity, state->pairCount + 1, sizeof(BroadphasePair));
+    if (state->pairCount >= state->pairCapacity) return;
+
+    state->pairs[state->pairCount].a = state->boxes[box1].userId;
+    state->pairs[state->pairCount].b = state->boxes[box2].userId;
+    state->pairCount++;
+}
+
+// Update grid cells entries: register every box in every cell it overlaps and sort entries by key
+// NOTE: Entries are sorted with a radix sort (4 passes of 8 bit), cost is linear on entries count,
+// boxes overlapping more than BROADPHASE_MAX_BOX_CELLS cells are kept in large boxes list instead
+static void UpdateBroadphaseCells(BroadphaseState *state)
+{
+    state->cellCount = 0;
+    state->largeCount = 0;
+
+    for (int i = 0; i < state->boxCount; i++)
+    {
+        if (!state->boxes[i].active) continue;
+
+        Rectangle rec = state->boxes[i].rec;
+        int x0 = GetBroadphaseCell(rec.x, state->cellSize);
+        int y0 = GetBroadphaseCell(rec.y, state->cellSize);
+        int x1 = GetBroadphaseCell(rec.x + rec.width, state->cellSize);
+        int y1 = GetBroadphaseCell(rec.y + rec.height, state->cellSize);
+
+        // NOTE: Span is checked per axis first, so cells count can not overflow
+        int spanX = x1 - x0 + 1;
+        int spanY = y1 - y0 + 1;
+
+        state->boxes[i].large = (spanX > BROADPHASE_MAX_BOX_CELLS) || (spanY > BROADPHASE_MAX_BOX_CELLS) || ((spanX*spanY) > BROADPHASE_MAX_BOX_CELLS);
+
+        if (state->boxes[i].large)
+        {
+            state->largeBoxes = (int *)GrowShapesArray(state->largeBoxes, &state->largeCapacity, state->largeCount + 1, sizeof(int));
+            if (state->largeCount < state->largeCapacity) state->largeBoxes[state->largeCount++] = i;
+            continue;
+        }
+
+        int required = state->cellCount + spanX*spanY;
+        state->cells = (BroadphaseCell *)GrowShapesArray(state->cells, &state->cellCapacity, required, sizeof(BroadphaseCell));
+        if (required > state->cellCapacity) break;
+
+        for (int y = y0; y <= y1; y++)
+        {
+            for (int x = x0; x <= x1; x++)
+            {
+                BroadphaseCell *cell = &state->cells[state->cellCount++];
+
+                cell->key = ((unsigned int)x*73856093u) ^ ((unsigned int)y*19349663u);
+                cell->x = x;
+                cell->y = y;
+                cell->box = i;
+            }
+        }
+    }
+
+    // Sorting buffer matches cells capacity
+    BroadphaseCell *cellsTemp = (BroadphaseCell *)RL_REALLOC(state->cellsTemp, (size_t)state->cellCapacity*sizeof(BroadphaseCell));
+
+    if (cellsTemp != NULL)
+    {
+        state->cellsTemp = cellsTemp;
+
+        BroadphaseCell *src = state->cells;
+        BroadphaseCell *dst = state->cellsTemp;
+
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            int offsets[256] = { 0 };
+
+            for (int i = 0; i < state->cellCount; i++) offsets[(src[i].key >> shift) & 0xff]++;
+            for (int i = 0, sum = 0; i < 256; i++)
+            {
+                int count = offsets[i];
+                offsets[i] = sum;
+                sum += count;
+            }
+            for (int i = 0; i < state->cellCount; i++) dst[offsets[(src[i].key >> shift) & 0xff]++] = src[i];
+
+            BroadphaseCell *temp = src;
+            src = dst;
+            dst = temp;
+        }
+
+        // NOTE: An even number of passes leaves sorted entries in cells array
+    }
+
+    state->cellsDirty = false;
+}
+
+// Get grid cell coordinate containing position, clamped to grid limits (also for infinite positions)
+static int GetBroadphaseCell(float position, float cellSize)
+{
+    return (int)fminf(fmaxf(floorf(position/cellSize), -BROADPHASE_GRID_LIMIT), BROADPHASE_GRID_LIMIT);
+}
+
+// Find first grid cell entry with key (binary search), returns cellCount if not found
+static int FindBroadphaseCell(BroadphaseState *state, unsigned int key)
+{
+    int low = 0;
+    int high = state->cellCount;
+
+    while (low < high)
+    {
+        int mid = low + (high - low)/2;
+
+        if (state->cells[mid].key < key) low = mid + 1;
+        else high = mid;
+    }
+
+    return low;
+}
+
+// Query tree boxes overlapping rectangle, returns boxes count (up to maxCount user ids registered)
+static int QueryBroadphaseTree(BroadphaseState *state, Rectangle rec, int *userIds, int maxCount)
+{
+    int count = 0;
+    int *stack = state->tree.stack;
+    int stackSize = 0;
+
+    if (state->tree.root != -1) stack[stackSize++] = state->tree.root;
+
+    while (stackSize > 0)
+    {
+        BoundsTreeNode *node = &state->tree.nodes[stack[--stackSize]];
+
+        if ((rec.x > node->max[0]) || ((rec.x + rec.width) < node->min[0]) ||
+            (rec.y > node->max[1]) || ((rec.y + rec.height) < node->min[1])) continue;
+
+        if (node->child1 == -1)
+        {
+            if (CheckCollisionRecs(rec, state->boxes[node->item].rec))
+            {
+                if (count < maxCount) userIds[count] = state->boxes[node->item].userId;
+                count++;
+            }
+        }
+        else
+        {
+            stack[stackSize++] = node->child1;
+            stack[stackSize++] = node->child2;
+        }
+    }
+
+    return count;
+}
+
+// Get segments required for a smooth full circle, based on error rate (usually 0.5f)
+// NOTE: Last radius result is kept, shapes are usually drawn in series with the same radius
+static float GetSmoothCircleSegments(float radius)
+{
+    static float lastRadius = 0.0f;
+    static float lastSegments = 0.0f;
+
+    if (radius != lastRadius)
+    {
+        // Calculate the maximum angle between segments based on the error rate
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+
+        lastSegments = ceilf(2*PI/th);
+        lastRadius = radius;
+    }
+
+    return lastSegments;
+}
+
+// Get arc to draw, unit arc points { sinf(), cosf() } for (segments, stepLength) are cached
+// NOTE: Start angle is applied on GetShapeArcPoint() as a rotation, so the same unit arc
+// is shared by every circle, ring, rounded rectangle corner or polygon with same subdivision
+static ShapeArc GetShapeArc(float startAngle, float stepLength, int segments)
+{
+    ShapeArc arc = { 0 };
+
+    arc.startAngle = startAngle;
+    arc.stepLength = stepLength;
+    arc.startSin = (startAngle != 0.0f)? sinf(DEG2RAD*startAngle) : 0.0f;
+    arc.startCos = (startAngle != 0.0f)? cosf(DEG2RAD*startAngle) : 1.0f;
+
+    if ((segments <= 0) || (segments > MAX_SHAPES_ARC_SEGMENTS)) return arc;
+
+    for (int i = 0; i < MAX_SHAPES_ARC_CACHE; i++)
+    {
+        if ((shapesArcCache[i].segments == segments) && (shapesArcCache[i].stepLength == stepLength))
+        {
+            arc.points = shapesArcCache[i].points;
+            return arc;
+        }
+    }
+
+    // Unit arc not found, replace oldest cache entry
+    ShapeArcTable *table = &shapesArcCache[shapesArcCacheNext];
+    shapesArcCacheNext = (shapesArcCacheNext + 1)%MAX_SHAPES_ARC_CACHE;
+
+    table->segments = segments;
+    table->stepLength = stepLength;
+
+    for (int i = 0; i <= segments; i++)
+    {
+        table->points[i].x = sinf(DEG2RAD*(stepLength*i));
+        table->points[i].y = cosf(DEG2RAD*(stepLength*i));
+    }
+
+    arc.points = table->points;
+
+    return arc;
+}
+
+// Get arc point { sinf(), cosf() } at (startAngle + index*stepLength)
+static inline Vector2 GetShapeArcPoint(ShapeArc arc, int index)
+{
+    Vector2 point = { 0 };
+
+    if (arc.points != NULL)
+    {
+        // Rotate unit arc point by start angle
+        point.x = arc.startSin*arc.points[index].y + arc.startCos*arc.points[index].x;
+        point.y = arc.startCos*arc.points[index].y - arc.startSin*arc.points[index].x;
+    }
+    else
+    {
+        point.x = sinf(DEG2RAD*(arc.startAngle + arc.stepLength*index));
+        point.y = cosf(DEG2RAD*(arc.startAngle + arc.stepLength*index));
+    }
+
+    return point;
+}
+
+// Get current sub-path, a new sub-path starting at closed sub-path first point is created if required (open)
+static PathSubpath *GetPathSubpath(PathState *state, bool open)
+{
+    PathSubpath *subpath = (state->subpathCount > 0)? &state->subpaths[state->subpathCount - 1] : NULL;
+
+    if (open && (subpath != NULL) && subpath->closed)
+    {
+        Vector2 start = state->points[subpath->start];
+
+        state->subpaths = (PathSubpath *)GrowShapesArray(state->subpaths, &state->subpathCapacity, state->subpathCount + 1, sizeof(PathSubpath));
+        if (state->subpathCount >= state->subpathCapacity) return NULL;
+
+        subpath = &state->subpaths[state->subpathCount++];
+        subpath->start = state->pointCount;
+        subpath->count = 0;
+        subpath->closed = false;
+
+        AddPathPoint(state, start);
+    }
+
+    return subpath;
+}
+
+// Add point to current sub-path, a new sub-path is started if there is none
+static void AddPathPoint(PathState *state, Vector2 point)
+{
+    PathSubpath *subpath = GetPathSubpath(state, true);
+
+    if (subpath == NULL)
+    {
+        state->subpaths = (PathSubpath *)GrowShapesArray(state->subpaths, &state->subpathCapacity, state->subpathCount + 1, sizeof(PathSubpath));
+        if (state->subpathCount >= state->subpathCapacity) return;
+
+        subpath = &state->subpaths[state->subpathCount++];
+        subpath->start = state->pointCount;
+        subpath->count = 0;
+        subpath->closed = false;
+    }
+
+    // Repeated points do not define a direction, skip them
+    if ((subpath->count > 0) && Vector2Equals(state->points[state->pointCount - 1], point)) return;
+
+    state->points = (Vector2 *)GrowShapesArray(state->points, &state->pointCapacity, state->pointCount + 1, sizeof(Vector2));
+    if (state->pointCount >= state->pointCapacity) return;
+
+    state->points[state->pointCount++] = point;
+    subpath->count++;
+}
+
+// Add stroke triangle, every vertex stores its distance to stroke center line
+static void AddStrokeTriangle(PathState *state, Vector2 v1, float d1, Vector2 v2, float d2, Vector2 v3, float d3, float halfThick)
+{
+    state->vertices = (float *)GrowShapesArray(state->vertices, &state->vertexCapacity, (state->vertexCount + 3)*PATH_VERTEX_FLOATS, sizeof(float));
+    if ((state->vertexCount + 3)*PATH_VERTEX_FLOATS > state->vertexCapacity) return;
+
+    float *vertex = &state->vertices[state->vertexCount*PATH_VERTEX_FLOATS];
+
+    vertex[0] = v1.x; vertex[1] = v1.y; vertex[2] = d1; vertex[3] = halfThick;
+    vertex[4] = v2.x; vertex[5] = v2.y; vertex[6] = d2; vertex[7] = halfThick;
+    vertex[8] = v3.x; vertex[9] = v3.y; vertex[10] = d3; vertex[11] = halfThick;
+
+    state->vertexCount += 3;
+}
+
+// Add stroke round fan around center, rotating unit normal by angle (radians)
+static void AddStrokeFan(PathState *state, Vector2 center, Vector2 normal, float angle, float halfThick)
+{
+    int segments = (int)ceilf(fabsf(angle)*GetSmoothCircleSegments(halfThick)/(2*PI));
+    if (segments < 1) segments = 1;
+
+    float stepSin = sinf(angle/segments);
+    float stepCos = cosf(angle/segments);
+    Vector2 rim = Vector2Add(center, Vector2Scale(normal, halfThick));
+
+    for (int i = 0; i < segments; i++)
+    {
+        normal = (Vector2){ normal.x*stepCos - normal.y*stepSin, normal.x*stepSin + normal.y*stepCos };
+        Vector2 next = Vector2Add(center, Vector2Scale(normal, halfThick));
+
+        AddStrokeTriangle(state, center, 0.0f, rim, halfThick, next, halfThick, halfThick);
+        rim = next;
+    }
+}
+
+// Get segments cut length at join inner side, side is set to inner side sign relative to segments left normal
+// NOTE: Join is not cut (returns 0) if cut does not fit in half of both segments (sharp turns on short
+// segments), adjacent segments overlap in that case
+static float GetStrokeJoinCut(Vector2 prev, Vector2 point, Vector2 next, float halfThick, float *side)
+{
+    Vector2 segment1 = Vector2Subtract(point, prev);
+    Vector2 segment2 = Vector2Subtract(next, point);
+    float length1 = Vector2Length(segment1);
+    float length2 = Vector2Length(segment2);
+
+    if ((length1 <= 0.0f) || (length2 <= 0.0f)) return 0.0f;
+
+    float cross = (segment1.x*segment2.y - segment1.y*segment2.x)/(length1*length2);
+    float dot = Vector2DotProduct(segment1, segment2)/(length1*length2);
+
+    // Inner offset lines intersect at halfThick*tan(theta/2) from join point, theta being the turn angle
+    if ((fabsf(cross) < 1e-6f) || (dot <= -1.0f + 1e-6f)) return 0.0f;
+
+    float cut = halfThick*fabsf(cross)/(1.0f + dot);
+    if ((cut > length1/2.0f) || (cut > length2/2.0f)) return 0.0f;
+
+    *side = (cross > 0.0f)? 1.0f : -1.0f;
+
+    return cut;
+}
+
+// Add stroke join at point, join fills the gap on the outer side of the turn
+static void AddStrokeJoin(PathState *state, Vector2 prev, Vector2 point, Vector2 next, float halfThick, int join)
+{
+    Vector2 direction1 = Vector2Normalize(Vector2Subtract(point, prev));
+    Vector2 direction2 = Vector2Normalize(Vector2Subtract(next, point));
+    float cross = direction1.x*direction2.y - direction1.y*direction2.x;
+
+    // Straight continuation, no gap to fill
+    if ((fabsf(cross) < 1e-6f) && (Vector2DotProduct(direction1, direction2) > 0.0f)) return;
+
+    float side = (cross > 0.0f)? -1.0f : 1.0f;
+    Vector2 normal1 = { -direction1.y*side, direction1.x*side };
+    Vector2 normal2 = { -direction2.y*side, direction2.x*side };
+    Vector2 outer1 = Vector2Add(point, Vector2Scale(normal1, halfThick));
+    Vector2 outer2 = Vector2Add(point, Vector2Scale(normal2, halfThick));
+
+    if (join == PATH_JOIN_ROUND)
+    {
+        float angle = atan2f(normal1.x*normal2.y - normal1.y*normal2.x, Vector2DotProduct(normal1, normal2));
+        AddStrokeFan(state, point, normal1, angle, halfThick);
+        return;
+    }
+
+    if (join == PATH_JOIN_MITER)
+    {
+        // Miter length (relative to half thickness) is 1/cos(theta/2), theta being the angle between normals
+        Vector2 miter = Vector2Add(normal1, normal2);
+        float halfCos = Vector2Length(miter)/2.0f;
+
+        if (halfCos > (1.0f/PATH_MITER_LIMIT))
+        {
+            Vector2 tip = Vector2Add(point, Vector2Scale(miter, halfThick/(2.0f*halfCos*halfCos)));
+
+            AddStrokeTriangle(state, point, 0.0f, outer1, halfThick, tip, halfThick, halfThick);
+            AddStrokeTriangle(state, point, 0.0f, tip, halfThick, outer2, halfThick, halfThick);
+            return;
+        }
+    }
+
+    // Bevel join, also used by miter joins over PATH_MITER_LIMIT
+    AddStrokeTriangle(state, point, 0.0f, outer1, halfThick, outer2, halfThick, halfThick);
+}
+
+// Add stroke cap at point, unit direction points out of the stroke
+static void AddStrokeCap(PathState *state, Vector2 point, Vector2 direction, float halfThick, int cap)
+{
+    Vector2 normal = { -direction.y, direction.x };
+
+    if (cap == PATH_CAP_ROUND) AddStrokeFan(state, point, normal, -PI, halfThick);
+    else if (cap == PATH_CAP_SQUARE)
+    {
+        Vector2 side = Vector2Scale(normal, halfThick);
+        Vector2 end = Vector2Add(point, Vector2Scale(direction, halfThick));
+
+        AddStrokeTriangle(state, Vector2Add(point, side), halfThick, Vector2Subtract(point, side), -halfThick, Vector2Subtract(end, side), -halfThick, halfThick);
+        AddStrokeTriangle(state, Vector2Add(point, side), halfThick, Vector2Subtract(end, side), -halfThick, Vector2Add(end, side), halfThick, halfThick);
+    }
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load path stroke shader
+// NOTE: Fragment coverage is computed from distance to center line and its screen-space derivative,
+// so stroke edges fade over one pixel at any transform scale
+static void LoadPathShader(void)
+{
+    const char *pathVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "varying vec2 fragEdge;             \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "out vec2 fragEdge;                 \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "varying vec2 fragEdge;             \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragEdge = vertexTexCoord;     \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *pathFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragEdge;             \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float width = length(vec2(dFdx(fragEdge.x), dFdy(fragEdge.x))); \n"
+    "    float alpha = clamp((fragEdge.y - abs(fragEdge.x))/max(width, 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    gl_FragColor = vec4(colDiffuse.rgb, colDiffuse.a*alpha); \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragEdge;                  \n"
+    "out vec4 finalColor;               \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float width = length(vec2(dFdx(fragEdge.x), dFdy(fragEdge.x))); \n"
+    "    float alpha = clamp((fragEdge.y - abs(fragEdge.x))/max(width, 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    finalColor = vec4(colDiffuse.rgb, colDiffuse.a*alpha); \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#extension GL_OES_standard_derivatives : enable \n"    // Required for: dFdx(), dFdy()
+    "precision mediump float;           \n"
+    "varying vec2 fragEdge;             \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float width = length(vec2(dFdx(fragEdge.x), dFdy(fragEdge.x))); \n"
+    "    float alpha = clamp((fragEdge.y - abs(fragEdge.x))/max(width, 0.0001) + 0.5, 0.0, 1.0); \n"
+    "    gl_FragColor = vec4(colDiffuse.rgb, colDiffuse.a*alpha); \n"
+    "}                                  \n";
+#endif
+
+    pathShaderId = rlLoadShaderCode(pathVShaderCode, pathFShaderCode);
+
+    if (pathShaderId > 0)
+    {
+        pathShaderLocs[0] = rlGetLocationUniform(pathShaderId, "mvp");
+        pathShaderLocs[1] = rlGetLocationUniform(pathShaderId, "colDiffuse");
+    }
+    else TRACELOG(LOG_WARNING, "SHAPES: Failed to load path shader, paths drawn without anti-aliasing");
+}
+
+// Set path stroke vertex attributes for currently bound vertex buffer
+// NOTE: Attributes use default shader locations: vertexPosition (0) and vertexTexCoord (1)
+static void SetPathVertexAttributes(void)
+{
+    rlSetVertexAttribute(0, 2, RL_FLOAT, false, PATH_VERTEX_FLOATS*sizeof(float), (void *)0);
+    rlEnableVertexAttribute(0);
+    rlSetVertexAttribute(1, 2, RL_FLOAT, false, PATH_VERTEX_FLOATS*sizeof(float), (void *)(2*sizeof(float)));
+    rlEnableVertexAttribute(1);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RSHAPES
@@ -91,7 +91,14 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Font asynchronous loading job data
+typedef struct FontLoadJob {
+    char *fileName;             // File name to load (copied after job data)
+    int *fontChars;             // Font characters to load (copied after file name)
+    Font font;                  // Loaded font, texture not uploaded (worker thread)
+    Image atlas;                // Font atlas image to upload on job finish
+    Font *outFont;              // Destination font, set on job finish
+} FontLoadJob;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -113,6 +120,8 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+static void FontLoadJobWork(void *data);          // Font loading job work, load glyphs and atlas image (worker thread)
+static void FontLoadJobFinish(void *data);        // Font loading job finish, upload atlas texture and set font (main thread)
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -348,22 +357,47 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCou
 {
     Font font = { 0 };
 
-    // Loading file to memory
+    // Mapping file to memory (read-only, no heap copy)
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    unsigned char *fileData = MapFileData(fileName, &fileSize);
 
     if (fileData != NULL)
     {
         // Loading font from memory data
         font = LoadFontFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, fontChars, glyphCount);
 
-        UnloadFileData(fileData);
+        UnmapFileData(fileData, fileSize);
     }
     else font = GetFontDefault();
 
     return font;
 }
 
+// Load font from file with extended parameters asynchronously, returns job id
+// NOTE: Glyphs and atlas are generated on a worker thread, atlas is uploaded and font set on main thread once job is done (IsJobDone())
+// NOTE: Only TTF/OTF fonts are supported, default font is set on failure
+unsigned int LoadFontAsync(const char *fileName, int fontSize, int *fontChars, int glyphCount, Font *font)
+{
+    int fileNameSize = (int)strlen(fileName) + 1;
+    int fontCharsSize = (fontChars != NULL)? glyphCount*sizeof(int) : 0;
+
+    FontLoadJob *job = (FontLoadJob *)RL_CALLOC(1, sizeof(FontLoadJob) + fontCharsSize + fileNameSize);
+
+    if (fontCharsSize > 0)
+    {
+        job->fontChars = (int *)((char *)job + sizeof(FontLoadJob));
+        memcpy(job->fontChars, fontChars, fontCharsSize);
+    }
+
+    job->fileName = (char *)job + sizeof(FontLoadJob) + fontCharsSize;
+    memcpy(job->fileName, fileName, fileNameSize);
+    job->font.baseSize = fontSize;
+    job->font.glyphCount = (glyphCount > 0)? glyphCount : 95;
+    job->outFont = font;
+
+    return QueueJob(FontLoadJobWork, FontLoadJobFinish, job);
+}
+
 // Load an Image font file (XNA style)
 Font LoadFontFromImage(Image image, Color key, int firstChar)
 {
@@ -1944,6 +1978,64 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Font loading job work, load glyphs and atlas image (worker thread)
+// NOTE: Avoid TextToLower(), it uses an internal static buffer, IsFileExtension() is reentrant
+static void FontLoadJobWork(void *data)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    FontLoadJob *job = (FontLoadJob *)data;
+
+    if (!IsFileExtension(job->fileName, ".ttf;.otf")) return;
+
+    unsigned int fileSize = 0;
+    unsigned char *fileData = MapFileData(job->fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        job->font.glyphs = LoadFontData(fileData, fileSize, job->font.baseSize, job->fontChars, job->font.glyphCount, FONT_DEFAULT);
+
+        if (job->font.glyphs != NULL)
+        {
+            job->font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+            job->atlas = GenImageFontAtlas(job->font.glyphs, &job->font.recs, job->font.glyphCount, job->font.baseSize, job->font.glyphPadding, 0);
+
+            // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
+            for (int i = 0; i < job->font.glyphCount; i++)
+            {
+                UnloadImage(job->font.glyphs[i].image);
+                job->font.glyphs[i].image = ImageFromImage(job->atlas, job->font.recs[i]);
+            }
+        }
+
+        UnmapFileData(fileData, fileSize);
+    }
+#endif
+}
+
+// Font loading job finish, upload atlas texture and set font (main thread)
+static void FontLoadJobFinish(void *data)
+{
+    FontLoadJob *job = (FontLoadJob *)data;
+
+    if (job->font.glyphs != NULL)
+    {
+        job->font.texture = LoadTextureFromImage(job->atlas);
+        UnloadImage(job->atlas);
+
+        TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", job->font.baseSize, job->font.glyphCount);
+
+        if (job->outFont != NULL) *job->outFont = job->font;
+        else UnloadFont(job->font);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font asynchronously", job->fileName);
+        if (job->outFont != NULL) *job->outFont = GetFontDefault();
+    }
+
+    RL_FREE(job);
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT)
 
 // Read a line from memory
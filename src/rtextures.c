@@ -72,6 +72,7 @@
 
 #include "utils.h"              // Required for: TRACELOG()
 #include "rlgl.h"               // OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
+#include "raymath.h"            // Required for: MatrixMultiply(), MatrixTranslate() [Used in DrawTileMap()]
 
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
@@ -205,10 +206,40 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef TILEMAP_CHUNK_SIZE
+    #define TILEMAP_CHUNK_SIZE       32    // Tile map chunk size (tiles per side), must be lower than 128 (16 bit indices)
+#endif
+
+#define TILEMAP_VERTEX_FLOATS         4    // Tile map vertex: position (x, y), texcoord (u, v)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image/texture asynchronous loading job data
+typedef struct ImageLoadJob {
+    char *fileName;             // File name to load (copied after job data)
+    Image image;                // Loaded image (worker thread)
+    Image *outImage;            // Destination image, set on job finish (LoadImageAsync())
+    Texture2D *outTexture;      // Destination texture, set on job finish (LoadTextureAsync())
+} ImageLoadJob;
+
+// Tile map chunk, chunk tiles drawn from a static vertex buffer
+typedef struct TileMapChunk {
+    unsigned int vaoId;         // Chunk vertex array id (VAO)
+    unsigned int vboId;         // Chunk vertex buffer id (VBO)
+    int tileCount;              // Chunk tiles count in vertex buffer (non-empty tiles)
+    int tileCapacity;           // Chunk vertex buffer capacity (tiles)
+    bool dirty;                 // Chunk vertex buffer requires rebuild (tiles changed)
+} TileMapChunk;
+
+// Tile map internal state
+typedef struct TileMapState {
+    int chunkCountX;            // Chunks count in x
+    int chunkCountY;            // Chunks count in y
+    TileMapChunk *chunks;       // Chunks array (chunkCountX*chunkCountY)
+    unsigned int indexBufferId; // Quads index buffer id, shared by all chunks
+    float *vertices;            // Chunk vertices buffer, used on chunks rebuild
+} TileMapState;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -223,7 +254,16 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
-static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized, frame memory)
+static Color *LoadImageColorsFrame(Image image);            // Load pixel data from image as Color array (frame memory)
+static void CopyImageColors(Image image, Color *pixels);    // Copy image pixel data into Color array
+static unsigned int QueueImageLoadJob(const char *fileName, Image *image, Texture2D *texture);  // Queue image/texture async loading job
+static void ImageLoadJobWork(void *data);                   // Image loading job work, decode image (worker thread)
+static void ImageLoadJobFinish(void *data);                 // Image loading job finish, set image or upload texture (main thread)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void UpdateTileMapChunk(TileMap map, int chunkX, int chunkY);   // Rebuild tile map chunk vertex buffer
+static void SetTileMapVertexAttributes(void);               // Set tile map vertex attributes for bound vertex buffer
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -232,6 +272,8 @@ static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data f
 // Load image from file into CPU memory (RAM)
 Image LoadImage(const char *fileName)
 {
+    PROFILE_ZONE_BEGIN("LoadImage");
+
     Image image = { 0 };
 
 #if defined(SUPPORT_FILEFORMAT_PNG) || \
@@ -247,18 +289,27 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
+    // Mapping file to memory (read-only, no heap copy)
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    unsigned char *fileData = MapFileData(fileName, &fileSize);
 
     // Loading image from memory data
     if (fileData != NULL) image = LoadImageFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
-    RL_FREE(fileData);
+    UnmapFileData(fileData, fileSize);
+
+    PROFILE_ZONE_END();
 
     return image;
 }
 
+// Load image from file into CPU memory (RAM) asynchronously, returns job id
+// NOTE: Image is decoded on a worker thread and set on main thread once job is done (IsJobDone())
+unsigned int LoadImageAsync(const char *fileName, Image *image)
+{
+    return QueueImageLoadJob(fileName, image, NULL);
+}
+
 // Load an image from RAW file data
 Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize)
 {
@@ -526,6 +577,8 @@ bool ExportImage(Image image, const char *fileName)
 
     if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return success;
 
+    PROFILE_ZONE_BEGIN("ExportImage");
+
 #if defined(SUPPORT_IMAGE_EXPORT)
     int channels = 4;
     bool allocatedData = false;
@@ -602,6 +655,8 @@ bool ExportImage(Image image, const char *fileName)
     if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
     else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", fileName);
 
+    PROFILE_ZONE_END();
+
     return success;
 }
 
@@ -1136,6 +1191,8 @@ void ImageFormat(Image *image, int newFormat)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    PROFILE_ZONE_BEGIN("ImageFormat");
+
     if ((newFormat != 0) && (image->format != newFormat))
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
@@ -1289,7 +1346,7 @@ void ImageFormat(Image *image, int newFormat)
                 default: break;
             }
 
-            RL_FREE(pixels);
+            MemFreeFrame(pixels);
             pixels = NULL;
 
             // In case original image had mipmaps, generate mipmaps for formatted image
@@ -1304,6 +1361,8 @@ void ImageFormat(Image *image, int newFormat)
         }
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
+
+    PROFILE_ZONE_END();
 }
 
 // Create an image from text (default font)
@@ -1393,7 +1452,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    Color *pixels = LoadImageColorsFrame(*image);
     Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
     // EDIT: added +1 to account for an early rounding problem
@@ -1423,7 +1482,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
 
     ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
 
-    UnloadImageColors(pixels);
+    MemFreeFrame(pixels);
 }
 
 
@@ -1436,6 +1495,8 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    PROFILE_ZONE_BEGIN("ImageResize");
+
     // Check if we can use a fast path on image scaling
     // It can be for 8 bit per channel images with 1 to 4 channels per pixel
     if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
@@ -1463,7 +1524,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     else
     {
         // Get data as Color pixels array to work with it
-        Color *pixels = LoadImageColors(*image);
+        Color *pixels = LoadImageColorsFrame(*image);
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
@@ -1471,7 +1532,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
 
         int format = image->format;
 
-        UnloadImageColors(pixels);
+        MemFreeFrame(pixels);
         RL_FREE(image->data);
 
         image->data = output;
@@ -1481,6 +1542,8 @@ void ImageResize(Image *image, int newWidth, int newHeight)
 
         ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
     }
+
+    PROFILE_ZONE_END();
 }
 
 // Resize canvas and fill with color
@@ -1748,14 +1811,23 @@ void ImageBlurGaussian(Image *image, int blurSize) {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Loop switches between pixelsCopy1 and pixelsCopy2
+    Vector4 *pixelsCopy1 = MemAllocFrame((image->height)*(image->width)*sizeof(Vector4));
+    Vector4 *pixelsCopy2 = MemAllocFrame((image->height)*(image->width)*sizeof(Vector4));
+
+    // NOTE: Image is not modified if working memory can not be allocated
+    if ((pixelsCopy1 == NULL) || (pixelsCopy2 == NULL))
+    {
+        MemFreeFrame(pixelsCopy2);
+        MemFreeFrame(pixelsCopy1);
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate memory for gaussian blur");
+        return;
+    }
+
     ImageAlphaPremultiply(image);
 
     Color *pixels = LoadImageColors(*image);
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-
     for (int i = 0; i < (image->height)*(image->width); i++) {
         pixelsCopy1[i].x = pixels[i].r;
         pixelsCopy1[i].y = pixels[i].g;
@@ -1886,8 +1958,8 @@ void ImageBlurGaussian(Image *image, int blurSize) {
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+    MemFreeFrame(pixelsCopy2);
+    MemFreeFrame(pixelsCopy1);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -1904,6 +1976,8 @@ void ImageMipmaps(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    PROFILE_ZONE_BEGIN("ImageMipmaps");
+
     int mipCount = 1;                   // Required mipmap levels count (including base level)
     int mipWidth = image->width;        // Base image width
     int mipHeight = image->height;      // Base image height
@@ -1963,6 +2037,8 @@ void ImageMipmaps(Image *image)
         UnloadImage(imCopy);
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
+
+    PROFILE_ZONE_END();
 }
 
 // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
@@ -1985,7 +2061,7 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     }
     else
     {
-        Color *pixels = LoadImageColors(*image);
+        Color *pixels = LoadImageColorsFrame(*image);
 
         RL_FREE(image->data);      // free old image data
 
@@ -2073,7 +2149,7 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
             }
         }
 
-        UnloadImageColors(pixels);
+        MemFreeFrame(pixels);
     }
 }
 
@@ -2486,112 +2562,7 @@ Color *LoadImageColors(Image image)
 
     Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
-
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
-
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
-    }
+    if (pixels != NULL) CopyImageColors(image, pixels);
 
     return pixels;
 }
@@ -2604,7 +2575,7 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 
     int palCount = 0;
     Color *palette = NULL;
-    Color *pixels = LoadImageColors(image);
+    Color *pixels = LoadImageColorsFrame(image);
 
     if (pixels != NULL)
     {
@@ -2644,7 +2615,7 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
             }
         }
 
-        UnloadImageColors(pixels);
+        MemFreeFrame(pixels);
     }
 
     *colorCount = palCount;
@@ -2670,7 +2641,7 @@ Rectangle GetImageAlphaBorder(Image image, float threshold)
 {
     Rectangle crop = { 0 };
 
-    Color *pixels = LoadImageColors(image);
+    Color *pixels = LoadImageColorsFrame(image);
 
     if (pixels != NULL)
     {
@@ -2699,7 +2670,7 @@ Rectangle GetImageAlphaBorder(Image image, float threshold)
             crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
         }
 
-        UnloadImageColors(pixels);
+        MemFreeFrame(pixels);
     }
 
     return crop;
@@ -3329,6 +3300,13 @@ Texture2D LoadTexture(const char *fileName)
     return texture;
 }
 
+// Load texture from file into GPU memory (VRAM) asynchronously, returns job id
+// NOTE: Image is decoded on a worker thread, texture is uploaded and set on main thread once job is done (IsJobDone())
+unsigned int LoadTextureAsync(const char *fileName, Texture2D *texture)
+{
+    return QueueImageLoadJob(fileName, NULL, texture);
+}
+
 // Load a texture from image data
 // NOTE: image is not unloaded, it must be done manually
 Texture2D LoadTextureFromImage(Image image)
@@ -4493,13 +4471,423 @@ int GetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+//------------------------------------------------------------------------------------
+// Tile map functions
+//------------------------------------------------------------------------------------
+// Load tile map, all tiles empty (-1)
+// NOTE: Tileset is not copied, it must be valid while drawing tile map and unloaded by user
+TileMap LoadTileMap(Texture2D tileset, int tileWidth, int tileHeight, int width, int height)
+{
+    TileMap map = { 0 };
+
+    if ((tileWidth <= 0) || (tileHeight <= 0) || (width <= 0) || (height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "TILEMAP: Failed to load tile map, invalid tile or map size");
+        return map;
+    }
+
+    TileMapState *state = (TileMapState *)RL_CALLOC(1, sizeof(TileMapState));
+    int *tiles = (int *)RL_MALLOC(width*height*sizeof(int));
+
+    if ((state != NULL) && (tiles != NULL))
+    {
+        state->chunkCountX = (width + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+        state->chunkCountY = (height + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+        state->chunks = (TileMapChunk *)RL_CALLOC(state->chunkCountX*state->chunkCountY, sizeof(TileMapChunk));
+
+        // Chunks are built first time they are visible
+        if (state->chunks != NULL) for (int i = 0; i < state->chunkCountX*state->chunkCountY; i++) state->chunks[i].dirty = true;
+    }
+
+    if ((state == NULL) || (tiles == NULL) || (state->chunks == NULL))
+    {
+        if (state != NULL) RL_FREE(state->chunks);
+        RL_FREE(state);
+        RL_FREE(tiles);
+
+        TRACELOG(LOG_WARNING, "TILEMAP: Failed to allocate tile map");
+        return map;
+    }
+
+    for (int i = 0; i < width*height; i++) tiles[i] = -1;
+
+    map.width = width;
+    map.height = height;
+    map.tileWidth = tileWidth;
+    map.tileHeight = tileHeight;
+    map.tileset = tileset;
+    map.tiles = tiles;
+    map.state = state;
+
+    TRACELOG(LOG_INFO, "TILEMAP: Tile map loaded successfully (%i x %i tiles, %i chunks)", width, height, state->chunkCountX*state->chunkCountY);
+
+    return map;
+}
+
+// Unload tile map tiles and chunks vertex buffers (tileset is not unloaded)
+void UnloadTileMap(TileMap map)
+{
+    TileMapState *state = (TileMapState *)map.state;
+
+    if (state != NULL)
+    {
+        for (int i = 0; i < state->chunkCountX*state->chunkCountY; i++)
+        {
+            if (state->chunks[i].vaoId > 0) rlUnloadVertexArray(state->chunks[i].vaoId);
+            if (state->chunks[i].vboId > 0) rlUnloadVertexBuffer(state->chunks[i].vboId);
+        }
+
+        if (state->indexBufferId > 0) rlUnloadVertexBuffer(state->indexBufferId);
+
+        RL_FREE(state->chunks);
+        RL_FREE(state->vertices);
+        RL_FREE(state);
+    }
+
+    RL_FREE(map.tiles);
+}
+
+// Set tile map tile (tileset tile index, -1 for empty tile)
+// NOTE: Tile chunk is marked to be rebuilt next time it is drawn
+void SetTileMapTile(TileMap map, int x, int y, int tile)
+{
+    TileMapState *state = (TileMapState *)map.state;
+
+    if ((state == NULL) || (x < 0) || (y < 0) || (x >= map.width) || (y >= map.height)) return;
+
+    if (map.tiles[y*map.width + x] != tile)
+    {
+        map.tiles[y*map.width + x] = tile;
+        state->chunks[(y/TILEMAP_CHUNK_SIZE)*state->chunkCountX + x/TILEMAP_CHUNK_SIZE].dirty = true;
+    }
+}
+
+// Get tile map tile (tileset tile index, -1 for empty or out of bounds tile)
+int GetTileMapTile(TileMap map, int x, int y)
+{
+    if ((map.tiles == NULL) || (x < 0) || (y < 0) || (x >= map.width) || (y >= map.height)) return -1;
+
+    return map.tiles[y*map.width + x];
+}
+
+// Draw tile map visible chunks, camera defines visible area (usually current BeginMode2D() camera)
+// NOTE: Dirty chunks are rebuilt only once visible, every visible chunk is drawn in a single draw call
+// from its vertex buffer using current shader (BeginShaderMode() shader or default shader)
+void DrawTileMap(TileMap map, Camera2D camera, Vector2 position, Color tint)
+{
+    TileMapState *state = (TileMapState *)map.state;
+    if ((state == NULL) || (map.tileset.id == 0)) return;
+
+    // Get visible area (world space) from current framebuffer corners, camera can be rotated
+    // NOTE: Framebuffer size is the render texture size in texture mode, screen size is used
+    // if framebuffer size is not available (OpenGL 1.1)
+    float width = (float)rlGetFramebufferWidth();
+    float height = (float)rlGetFramebufferHeight();
+
+    if ((width <= 0.0f) || (height <= 0.0f))
+    {
+        width = (float)GetScreenWidth();
+        height = (float)GetScreenHeight();
+    }
+
+    Vector2 corners[4] = {
+        GetScreenToWorld2D((Vector2){ 0.0f, 0.0f }, camera),
+        GetScreenToWorld2D((Vector2){ width, 0.0f }, camera),
+        GetScreenToWorld2D((Vector2){ 0.0f, height }, camera),
+        GetScreenToWorld2D((Vector2){ width, height }, camera)
+    };
+
+    Vector2 min = corners[0];
+    Vector2 max = corners[0];
+
+    for (int i = 1; i < 4; i++)
+    {
+        min.x = fminf(min.x, corners[i].x);
+        min.y = fminf(min.y, corners[i].y);
+        max.x = fmaxf(max.x, corners[i].x);
+        max.y = fmaxf(max.y, corners[i].y);
+    }
+
+    // Get visible chunks range
+    float chunkWidth = (float)(TILEMAP_CHUNK_SIZE*map.tileWidth);
+    float chunkHeight = (float)(TILEMAP_CHUNK_SIZE*map.tileHeight);
+
+    int startX = (int)floorf((min.x - position.x)/chunkWidth);
+    int startY = (int)floorf((min.y - position.y)/chunkHeight);
+    int endX = (int)floorf((max.x - position.x)/chunkWidth);
+    int endY = (int)floorf((max.y - position.y)/chunkHeight);
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX >= state->chunkCountX) endX = state->chunkCountX - 1;
+    if (endY >= state->chunkCountY) endY = state->chunkCountY - 1;
+
+    if ((startX > endX) || (startY > endY)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatchActive();      // Draw textures batched before tile map
+
+    // NOTE: Current shader is used like batched draws, custom shaders must provide default
+    // attributes locations (vertexPosition, vertexTexCoord), set by LoadShader()
+    int *locs = rlGetShaderLocsCurrent();
+    rlEnableShader(rlGetShaderIdCurrent());
+
+    Matrix matModelView = MatrixMultiply(MatrixMultiply(MatrixTranslate(position.x, position.y, 0.0f), rlGetMatrixTransform()), rlGetMatrixModelview());
+    rlSetUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], MatrixMultiply(matModelView, rlGetMatrixProjection()));
+
+    float values[4] = { (float)tint.r/255.0f, (float)tint.g/255.0f, (float)tint.b/255.0f, (float)tint.a/255.0f };
+    rlSetUniform(locs[RL_SHADER_LOC_COLOR_DIFFUSE], values, RL_SHADER_UNIFORM_VEC4, 1);
+
+    // Chunks vertex buffers provide no vertex colors, tint is applied as diffuse color
+    float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    if (locs[RL_SHADER_LOC_VERTEX_COLOR] != -1) rlSetVertexAttributeDefault(locs[RL_SHADER_LOC_VERTEX_COLOR], white, RL_SHADER_ATTRIB_VEC4, 4);
+
+    rlActiveTextureSlot(0);
+    rlEnableTexture(map.tileset.id);
+
+    bool vaoEnabled = true;
+
+    for (int y = startY; y <= endY; y++)
+    {
+        for (int x = startX; x <= endX; x++)
+        {
+            TileMapChunk *chunk = &state->chunks[y*state->chunkCountX + x];
+
+            if (chunk->dirty) UpdateTileMapChunk(map, x, y);
+            if (chunk->tileCount == 0) continue;
+
+            if (!rlEnableVertexArray(chunk->vaoId))
+            {
+                vaoEnabled = false;
+                rlEnableVertexBuffer(chunk->vboId);
+                SetTileMapVertexAttributes();
+                if (locs[RL_SHADER_LOC_VERTEX_COLOR] != -1) rlDisableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR]);     // Render batch color attribute, default color is used
+                rlEnableVertexBufferElement(state->indexBufferId);
+            }
+
+            rlDrawVertexArrayElements(0, chunk->tileCount*6, 0);
+        }
+    }
+
+    // Vertex attributes enabled without VAO (OpenGL ES 2.0) are global state, disabled so they do not
+    // point to chunks vertex buffers on next draw calls
+    if (!vaoEnabled)
+    {
+        rlDisableVertexAttribute(0);
+        rlDisableVertexAttribute(1);
+    }
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    rlDisableTexture();
+    rlDisableShader();
+#else
+    // Tiles drawn with render batch if vertex buffers are not available
+    int columns = map.tileset.width/map.tileWidth;
+    int tileCount = columns*(map.tileset.height/map.tileHeight);
+
+    rlSetTexture(map.tileset.id);
+    rlBegin(RL_QUADS);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);   // Normal vector pointing towards viewer
+
+        for (int y = startY*TILEMAP_CHUNK_SIZE; (y < (endY + 1)*TILEMAP_CHUNK_SIZE) && (y < map.height); y++)
+        {
+            for (int x = startX*TILEMAP_CHUNK_SIZE; (x < (endX + 1)*TILEMAP_CHUNK_SIZE) && (x < map.width); x++)
+            {
+                int tile = map.tiles[y*map.width + x];
+                if ((tile < 0) || (tile >= tileCount)) continue;
+
+                float u0 = (float)((tile%columns)*map.tileWidth)/map.tileset.width;
+                float v0 = (float)((tile/columns)*map.tileHeight)/map.tileset.height;
+                float u1 = u0 + (float)map.tileWidth/map.tileset.width;
+                float v1 = v0 + (float)map.tileHeight/map.tileset.height;
+                float x0 = position.x + (float)(x*map.tileWidth);
+                float y0 = position.y + (float)(y*map.tileHeight);
+
+                rlTexCoord2f(u0, v0); rlVertex2f(x0, y0);
+                rlTexCoord2f(u0, v1); rlVertex2f(x0, y0 + map.tileHeight);
+                rlTexCoord2f(u1, v1); rlVertex2f(x0 + map.tileWidth, y0 + map.tileHeight);
+                rlTexCoord2f(u1, v0); rlVertex2f(x0 + map.tileWidth, y0);
+            }
+        }
+    rlEnd();
+    rlSetTexture(0);
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Queue image/texture async loading job
+// NOTE: File name is copied, destination image/texture must be valid until job is done
+static unsigned int QueueImageLoadJob(const char *fileName, Image *image, Texture2D *texture)
+{
+    int fileNameSize = (int)strlen(fileName) + 1;
+
+    ImageLoadJob *job = (ImageLoadJob *)RL_CALLOC(1, sizeof(ImageLoadJob) + fileNameSize);
+    job->fileName = (char *)job + sizeof(ImageLoadJob);
+    memcpy(job->fileName, fileName, fileNameSize);
+    job->outImage = image;
+    job->outTexture = texture;
+
+    return QueueJob(ImageLoadJobWork, ImageLoadJobFinish, job);
+}
+
+// Image loading job work, decode image (worker thread)
+static void ImageLoadJobWork(void *data)
+{
+    ImageLoadJob *job = (ImageLoadJob *)data;
+
+    job->image = LoadImage(job->fileName);
+}
+
+// Image loading job finish, set image or upload texture (main thread)
+static void ImageLoadJobFinish(void *data)
+{
+    ImageLoadJob *job = (ImageLoadJob *)data;
+
+    if (job->outTexture != NULL)
+    {
+        if (job->image.data != NULL) *job->outTexture = LoadTextureFromImage(job->image);
+        UnloadImage(job->image);
+    }
+    else if (job->outImage != NULL) *job->outImage = job->image;
+    else UnloadImage(job->image);
+
+    RL_FREE(job);
+}
+
+// Load color data from image as a Color array (RGBA - 32bit), allocated from frame memory
+// NOTE: Used for temporary pixel data, memory must be freed using MemFreeFrame()
+static Color *LoadImageColorsFrame(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
+
+    Color *pixels = (Color *)MemAllocFrame(image.width*image.height*sizeof(Color));
+
+    if (pixels != NULL) CopyImageColors(image, pixels);
+
+    return pixels;
+}
+
+// Copy image pixel data into Color array (RGBA - 32bit)
+static void CopyImageColors(Image image, Color *pixels)
+{
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[i];
+                    pixels[i].g = ((unsigned char *)image.data)[i];
+                    pixels[i].b = ((unsigned char *)image.data)[i];
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k];
+                    pixels[i].b = ((unsigned char *)image.data)[k];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].r = ((unsigned char *)image.data)[k];
+                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                    pixels[i].a = 255;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                    pixels[i].a = 255;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
+                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
 // Get pixel data from image as Vector4 array (float normalized)
+// NOTE: Used for temporary pixel data, allocated from frame memory, it must be freed using MemFreeFrame()
 static Vector4 *LoadImageDataNormalized(Image image)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    Vector4 *pixels = (Vector4 *)MemAllocFrame(image.width*image.height*sizeof(Vector4));
 
     if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
     else
@@ -4607,4 +4995,101 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Rebuild tile map chunk vertex buffer from chunk tiles
+// NOTE: Vertex buffer is only reloaded if chunk tiles do not fit, otherwise it is updated
+static void UpdateTileMapChunk(TileMap map, int chunkX, int chunkY)
+{
+    TileMapState *state = (TileMapState *)map.state;
+    TileMapChunk *chunk = &state->chunks[chunkY*state->chunkCountX + chunkX];
+
+    if (state->vertices == NULL) state->vertices = (float *)RL_MALLOC(TILEMAP_CHUNK_SIZE*TILEMAP_CHUNK_SIZE*4*TILEMAP_VERTEX_FLOATS*sizeof(float));
+    if (state->vertices == NULL) return;
+
+    int columns = map.tileset.width/map.tileWidth;
+    int tileCount = columns*(map.tileset.height/map.tileHeight);
+    int count = 0;
+
+    for (int y = chunkY*TILEMAP_CHUNK_SIZE; (y < (chunkY + 1)*TILEMAP_CHUNK_SIZE) && (y < map.height); y++)
+    {
+        for (int x = chunkX*TILEMAP_CHUNK_SIZE; (x < (chunkX + 1)*TILEMAP_CHUNK_SIZE) && (x < map.width); x++)
+        {
+            int tile = map.tiles[y*map.width + x];
+            if ((tile < 0) || (tile >= tileCount)) continue;
+
+            float u0 = (float)((tile%columns)*map.tileWidth)/map.tileset.width;
+            float v0 = (float)((tile/columns)*map.tileHeight)/map.tileset.height;
+            float u1 = u0 + (float)map.tileWidth/map.tileset.width;
+            float v1 = v0 + (float)map.tileHeight/map.tileset.height;
+            float x0 = (float)(x*map.tileWidth);
+            float y0 = (float)(y*map.tileHeight);
+            float x1 = x0 + map.tileWidth;
+            float y1 = y0 + map.tileHeight;
+
+            // Quad vertices: top-left, bottom-left, bottom-right, top-right (position, texcoord)
+            float *vertex = &state->vertices[count*4*TILEMAP_VERTEX_FLOATS];
+            vertex[0] = x0; vertex[1] = y0; vertex[2] = u0; vertex[3] = v0;
+            vertex[4] = x0; vertex[5] = y1; vertex[6] = u0; vertex[7] = v1;
+            vertex[8] = x1; vertex[9] = y1; vertex[10] = u1; vertex[11] = v1;
+            vertex[12] = x1; vertex[13] = y0; vertex[14] = u1; vertex[15] = v0;
+
+            count++;
+        }
+    }
+
+    if (count > chunk->tileCapacity)
+    {
+        if (chunk->vaoId > 0) rlUnloadVertexArray(chunk->vaoId);
+        if (chunk->vboId > 0) rlUnloadVertexBuffer(chunk->vboId);
+
+        chunk->vaoId = rlLoadVertexArray();
+        rlEnableVertexArray(chunk->vaoId);
+
+        chunk->vboId = rlLoadVertexBuffer(state->vertices, count*4*TILEMAP_VERTEX_FLOATS*sizeof(float), false);
+        chunk->tileCapacity = count;
+        SetTileMapVertexAttributes();
+
+        // Quads index buffer is shared by all chunks
+        if (state->indexBufferId == 0)
+        {
+            unsigned short *indices = (unsigned short *)RL_MALLOC(TILEMAP_CHUNK_SIZE*TILEMAP_CHUNK_SIZE*6*sizeof(unsigned short));
+
+            if (indices != NULL)
+            {
+                for (int i = 0, k = 0; i < TILEMAP_CHUNK_SIZE*TILEMAP_CHUNK_SIZE*6; i += 6, k++)
+                {
+                    indices[i] = (unsigned short)(4*k);
+                    indices[i + 1] = (unsigned short)(4*k + 1);
+                    indices[i + 2] = (unsigned short)(4*k + 2);
+                    indices[i + 3] = (unsigned short)(4*k);
+                    indices[i + 4] = (unsigned short)(4*k + 2);
+                    indices[i + 5] = (unsigned short)(4*k + 3);
+                }
+
+                state->indexBufferId = rlLoadVertexBufferElement(indices, TILEMAP_CHUNK_SIZE*TILEMAP_CHUNK_SIZE*6*sizeof(unsigned short), false);
+                RL_FREE(indices);
+            }
+        }
+        else rlEnableVertexBufferElement(state->indexBufferId);
+
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+    }
+    else if (count > 0) rlUpdateVertexBuffer(chunk->vboId, state->vertices, count*4*TILEMAP_VERTEX_FLOATS*sizeof(float), 0);
+
+    chunk->tileCount = count;
+    chunk->dirty = false;
+}
+
+// Set tile map vertex attributes for currently bound vertex buffer
+// NOTE: Attributes use default shader locations: vertexPosition (0) and vertexTexCoord (1)
+static void SetTileMapVertexAttributes(void)
+{
+    rlSetVertexAttribute(0, 2, RL_FLOAT, false, TILEMAP_VERTEX_FLOATS*sizeof(float), (void *)0);
+    rlEnableVertexAttribute(0);
+    rlSetVertexAttribute(1, 2, RL_FLOAT, false, TILEMAP_VERTEX_FLOATS*sizeof(float), (void *)(2*sizeof(float)));
+    rlEnableVertexAttribute(1);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -7,6 +7,16 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_FILE_MAPPING
+*           MapFileData() maps files read-only into memory (mmap/MapViewOfFile) instead of
+*           copying them into heap memory, pages are loaded lazily by the system on access
+*           NOTE: Only available on desktop platforms, falls back to LoadFileData() otherwise
+*
+*   CONFIGURATION VALUES:
+*       #define MEM_FRAME_ARENA_SIZE
+*           Frame memory arena size per thread (main thread and job workers), MemAllocFrame() allocations
+*           not fitting use heap memory, other threads always use heap memory
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -48,6 +58,45 @@
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
+#include <limits.h>                     // Required for: UINT_MAX
+
+#if defined(SUPPORT_FILE_MAPPING) && defined(SUPPORT_STANDARD_FILEIO) && defined(PLATFORM_DESKTOP)
+    #define FILE_MAPPING_AVAILABLE
+#endif
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    #if defined(_WIN32)
+        // NOTE: We declare required Win32 functions symbols to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) void *__stdcall CreateFileA(const char *lpFileName, unsigned long dwDesiredAccess, unsigned long dwShareMode, void *lpSecurityAttributes, unsigned long dwCreationDisposition, unsigned long dwFlagsAndAttributes, void *hTemplateFile);
+        __declspec(dllimport) int __stdcall GetFileSizeEx(void *hFile, long long *lpFileSize);
+        __declspec(dllimport) void *__stdcall CreateFileMappingA(void *hFile, void *lpFileMappingAttributes, unsigned long flProtect, unsigned long dwMaximumSizeHigh, unsigned long dwMaximumSizeLow, const char *lpName);
+        __declspec(dllimport) void *__stdcall MapViewOfFile(void *hFileMappingObject, unsigned long dwDesiredAccess, unsigned long dwFileOffsetHigh, unsigned long dwFileOffsetLow, size_t dwNumberOfBytesToMap);
+        __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *lpBaseAddress);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **SRWLock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **SRWLock);
+
+        typedef void *FileMapMutex;                         // Win32: SRWLOCK
+        #define FILE_MAP_MUTEX_STATIC_INIT      NULL        // SRWLOCK_INIT
+        #define FILE_MAP_MUTEX_LOCK(mutex)      AcquireSRWLockExclusive(mutex)
+        #define FILE_MAP_MUTEX_UNLOCK(mutex)    ReleaseSRWLockExclusive(mutex)
+    #else
+        #include <pthread.h>            // Required for: pthread_mutex_lock(), pthread_mutex_unlock()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <sys/stat.h>           // Required for: fstat()
+
+        typedef pthread_mutex_t FileMapMutex;
+        #define FILE_MAP_MUTEX_STATIC_INIT      PTHREAD_MUTEX_INITIALIZER
+        #define FILE_MAP_MUTEX_LOCK(mutex)      pthread_mutex_lock(mutex)
+        #define FILE_MAP_MUTEX_UNLOCK(mutex)    pthread_mutex_unlock(mutex)
+    #endif
+#endif
+
+#if defined(SUPPORT_PACK_FILES) && defined(SUPPORT_COMPRESSION_API)
+    #include "external/sinfl.h"         // Required for: sinflate() [Implementation in rcore module]
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -56,6 +105,113 @@
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
 
+#ifndef MEM_FRAME_ARENA_SIZE
+    #define MEM_FRAME_ARENA_SIZE    8388608         // Frame memory arena size per thread (8 MB)
+#endif
+
+#define MEM_FRAME_ALIGNMENT             16          // Frame memory allocations alignment (bytes)
+#define MEM_FRAME_HEADER_SIZE   ((sizeof(MemFrameBlock) + MEM_FRAME_ALIGNMENT - 1) & ~(MEM_FRAME_ALIGNMENT - 1))
+
+// NOTE: Frame memory arena is per-thread, no locking required
+#if defined(_MSC_VER)
+    #define MEM_FRAME_THREAD_LOCAL      __declspec(thread)
+#else
+    #define MEM_FRAME_THREAD_LOCAL      __thread
+#endif
+
+#if defined(SUPPORT_PACK_FILES)
+    #define PACK_FILE_ID                "rPAK"      // Pack file identifier
+    #define PACK_FILE_VERSION           100         // Pack file version
+    #define PACK_DATA_ALIGNMENT         16          // Pack entries data alignment (bytes)
+    #define PACK_COMPRESSION_MIN_SIZE   256         // Pack entries smaller than this size are always stored (bytes)
+
+    #ifndef MAX_PACK_NAME_LENGTH
+        #define MAX_PACK_NAME_LENGTH    512         // Max length of pack entries names and mount path
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Frame memory block header, placed before every frame memory allocation
+typedef struct MemFrameBlock {
+    struct MemFrameBlock *prev;     // Previous block (arena: previous allocation, heap: previous heap block)
+    struct MemFrameBlock *next;     // Next block (heap blocks only)
+    struct MemFrameArena *arena;    // Allocating thread arena, frame memory is owned by allocating thread
+    unsigned int size;              // Block size, including header (bytes)
+    int freed;                      // Block freed (arena blocks), space reclaimed once blocks after it are freed
+} MemFrameBlock;
+
+// Frame memory arena, allocations are stacked in a fixed-capacity buffer
+typedef struct MemFrameArena {
+    unsigned char *buffer;          // Arena buffer, only loaded for main thread and job workers (LoadMemFrame())
+    unsigned char *base;            // Arena buffer start (aligned)
+    unsigned int used;              // Arena used memory (bytes)
+    unsigned int heapUsed;          // Heap allocations used memory (bytes), allocations not fitting in arena
+    unsigned int peak;              // Peak used memory, arena and heap (bytes)
+    unsigned int heapCount;         // Heap allocations count since arena loaded
+    MemFrameBlock *top;             // Last arena allocation
+    MemFrameBlock *heapBlocks;      // Heap allocations list, freed on reset
+} MemFrameArena;
+
+#if defined(FILE_MAPPING_AVAILABLE)
+// File data returned by MapFileData() from heap memory (file not mapped), unloaded with UnloadFileData()
+typedef struct MapFileHeapData {
+    unsigned char *data;            // File data loaded with LoadFileData()
+    struct MapFileHeapData *next;   // Next heap file data
+} MapFileHeapData;
+#endif
+
+#if defined(SUPPORT_PACK_FILES)
+// Pack entry compression
+typedef enum {
+    PACK_COMPRESSION_NONE = 0,                      // Entry data stored
+    PACK_COMPRESSION_DEFLATE                        // Entry data compressed (DEFLATE)
+} PackCompression;
+
+// Pack file header (16 bytes)
+// NOTE: Pack file layout: header, entries index, entries names block ('\0' terminated strings), entries data,
+// all values are little-endian and all offsets are 32bit, so pack files are limited to 4GB
+typedef struct PackFileHeader {
+    char id[4];                     // Pack file identifier: "rPAK"
+    unsigned short version;         // Pack file version: 100
+    unsigned short reserved;        // <reserved>
+    unsigned int entryCount;        // Number of entries in index
+    unsigned int namesSize;         // Size of entries names block
+} PackFileHeader;
+
+// Pack file index entry (24 bytes)
+// NOTE: Index entries are sorted by name hash and name, so lookup is a binary search
+typedef struct PackFileEntry {
+    unsigned int hash;              // Entry name hash (FNV-1a)
+    unsigned int nameOffset;        // Entry name offset in names block
+    unsigned int dataOffset;        // Entry data offset from pack file start
+    unsigned int dataSize;          // Entry data size (uncompressed)
+    unsigned int compSize;          // Entry data size in pack (equal to dataSize if stored)
+    unsigned int compression;       // Entry compression (PackCompression)
+} PackFileEntry;
+
+// Mounted pack file data
+typedef struct PackFile {
+    unsigned char *data;            // Pack file data (mapped)
+    unsigned int dataSize;          // Pack file data size
+    const PackFileEntry *entries;   // Pack entries index (pointer into data)
+    unsigned int entryCount;        // Pack entries count
+    const char *names;              // Pack entries names block (pointer into data)
+    char mountPath[MAX_PACK_NAME_LENGTH];   // Mount path, files are resolved relative to it
+    int mountPathLength;            // Mount path length
+    LoadFileDataCallback loadFileData;  // Custom file data load callback set before mounting, files not found in pack use it
+    LoadFileTextCallback loadFileText;  // Custom file text load callback set before mounting, files not found in pack use it
+} PackFile;
+
+// Pack file entry on export
+typedef struct PackExportEntry {
+    const char *name;               // Entry name (relative to exported directory)
+    const char *path;               // Entry file path
+    unsigned int hash;              // Entry name hash (FNV-1a)
+} PackExportEntry;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -67,6 +223,17 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(SUPPORT_PACK_FILES)
+static PackFile pack = { 0 };                       // Mounted pack file
+#endif
+
+#if defined(FILE_MAPPING_AVAILABLE)
+static MapFileHeapData *mapFileHeapData = NULL;     // File data returned by MapFileData() from heap memory
+static FileMapMutex mapFileHeapMutex = FILE_MAP_MUTEX_STATIC_INIT;  // Heap file data list mutex (MapFileData() runs on job workers)
+#endif
+
+static MEM_FRAME_THREAD_LOCAL MemFrameArena memFrame = { 0 };   // Current thread frame memory arena
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -85,6 +252,18 @@ static const char *internalDataPath = NULL;         // Android internal data pat
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static unsigned char *LoadFileDataFromDisk(const char *fileName, unsigned int *bytesRead);   // Load file data using standard file io
+static char *LoadFileTextFromDisk(const char *fileName);                                    // Load file text using standard file io
+
+#if defined(SUPPORT_PACK_FILES)
+static unsigned int GetPackNameHash(const char *name);                                      // Compute pack entry name hash (FNV-1a)
+static int ComparePackExportEntries(const void *a, const void *b);                          // Compare pack entries by name hash and name
+static const PackFileEntry *FindPackFileEntry(const char *fileName);                        // Find entry in mounted pack file
+static unsigned char *LoadPackEntryData(const PackFileEntry *entry);                        // Load mounted pack entry data
+static unsigned char *LoadPackFileData(const char *fileName, unsigned int *bytesRead);      // Load file data callback for mounted pack file
+static char *LoadPackFileText(const char *fileName);                                        // Load file text callback for mounted pack file
+#endif
+
 #if defined(PLATFORM_ANDROID)
 FILE *funopen(const void *cookie, int (*readfn)(void *, char *, int), int (*writefn)(void *, const char *, int),
               fpos_t (*seekfn)(void *, fpos_t, int), int (*closefn)(void *));
@@ -179,6 +358,140 @@ void MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
+// Frame memory allocator, allocates from current thread arena (16 bytes aligned, not initialized)
+// NOTE: Memory is valid until freed with MemFreeFrame() or current thread frame memory is reset
+// (EndDrawing() on main thread, after every job work on job worker threads), it must be freed on
+// allocating thread; allocations not fitting in arena use heap memory, they are also freed on reset.
+// Threads created by user have no arena, allocations use heap memory and are kept until freed,
+// reset or unloaded (ResetMemFrame(), UnloadMemFrame()) on that thread
+void *MemAllocFrame(unsigned int size)
+{
+    if (size > (0xffffffff - MEM_FRAME_HEADER_SIZE - MEM_FRAME_ALIGNMENT)) return NULL;
+
+    unsigned int blockSize = (unsigned int)(MEM_FRAME_HEADER_SIZE + ((size + MEM_FRAME_ALIGNMENT - 1) & ~(MEM_FRAME_ALIGNMENT - 1)));
+    MemFrameBlock *block = NULL;
+
+    if ((memFrame.buffer != NULL) && (blockSize <= (MEM_FRAME_ARENA_SIZE - memFrame.used)))
+    {
+        block = (MemFrameBlock *)(memFrame.base + memFrame.used);
+        block->prev = memFrame.top;
+        block->next = NULL;
+
+        memFrame.top = block;
+        memFrame.used += blockSize;
+    }
+    else
+    {
+        block = (MemFrameBlock *)RL_MALLOC(blockSize);
+        if (block == NULL) return NULL;
+
+        block->prev = NULL;
+        block->next = memFrame.heapBlocks;
+        if (memFrame.heapBlocks != NULL) memFrame.heapBlocks->prev = block;
+
+        memFrame.heapBlocks = block;
+        memFrame.heapUsed += blockSize;
+        memFrame.heapCount++;
+    }
+
+    block->arena = &memFrame;
+    block->size = blockSize;
+    block->freed = 0;
+
+    if ((memFrame.used + memFrame.heapUsed) > memFrame.peak) memFrame.peak = memFrame.used + memFrame.heapUsed;
+
+    return (unsigned char *)block + MEM_FRAME_HEADER_SIZE;
+}
+
+// Frame memory free
+// NOTE: Arena space is reused once all allocations after it are freed (stack order)
+// WARNING: Frame memory is owned by allocating thread, memory allocated by other threads is not freed
+// (it would corrupt other thread arena), it is reclaimed when allocating thread frame memory is reset
+void MemFreeFrame(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    MemFrameBlock *block = (MemFrameBlock *)((unsigned char *)ptr - MEM_FRAME_HEADER_SIZE);
+
+    if (block->arena != &memFrame)
+    {
+        TRACELOG(LOG_WARNING, "MEM: Frame memory can only be freed on allocating thread, memory not freed");
+        return;
+    }
+
+    if ((memFrame.buffer != NULL) && ((unsigned char *)block >= memFrame.base) && ((unsigned char *)block < (memFrame.base + MEM_FRAME_ARENA_SIZE)))
+    {
+        block->freed = 1;
+
+        while ((memFrame.top != NULL) && memFrame.top->freed)
+        {
+            memFrame.used = (unsigned int)((unsigned char *)memFrame.top - memFrame.base);
+            memFrame.top = memFrame.top->prev;
+        }
+    }
+    else
+    {
+        if (block->prev != NULL) block->prev->next = block->next;
+        else memFrame.heapBlocks = block->next;
+        if (block->next != NULL) block->next->prev = block->prev;
+
+        memFrame.heapUsed -= block->size;
+        RL_FREE(block);
+    }
+}
+
+// Reset current thread frame memory, all frame memory allocations are freed
+void ResetMemFrame(void)
+{
+    while (memFrame.heapBlocks != NULL)
+    {
+        MemFrameBlock *next = memFrame.heapBlocks->next;
+        RL_FREE(memFrame.heapBlocks);
+        memFrame.heapBlocks = next;
+    }
+
+    memFrame.used = 0;
+    memFrame.heapUsed = 0;
+    memFrame.top = NULL;
+}
+
+// Get current thread frame memory stats
+MemFrameStats GetMemFrameStats(void)
+{
+    MemFrameStats stats = { 0 };
+
+    stats.capacity = (memFrame.buffer != NULL)? MEM_FRAME_ARENA_SIZE : 0;
+    stats.used = memFrame.used + memFrame.heapUsed;
+    stats.peak = memFrame.peak;
+    stats.heapCount = memFrame.heapCount;
+
+    return stats;
+}
+
+// Load current thread frame memory arena
+// NOTE: Only loaded for main thread (InitWindow()) and job workers, so threads created by user do not
+// get an arena they would never reset
+void LoadMemFrame(void)
+{
+    if (memFrame.buffer != NULL) return;
+
+    memFrame.buffer = (unsigned char *)RL_MALLOC(MEM_FRAME_ARENA_SIZE + MEM_FRAME_ALIGNMENT);
+
+    if (memFrame.buffer != NULL) memFrame.base = (unsigned char *)(((size_t)memFrame.buffer + MEM_FRAME_ALIGNMENT - 1) & ~(size_t)(MEM_FRAME_ALIGNMENT - 1));
+    else TRACELOG(LOG_WARNING, "MEM: Failed to load frame memory arena, heap memory used instead");
+}
+
+// Unload current thread frame memory, all frame memory allocations are freed
+// NOTE: Required before exiting user threads that allocated frame memory, following allocations
+// on current thread use heap memory
+void UnloadMemFrame(void)
+{
+    ResetMemFrame();
+    RL_FREE(memFrame.buffer);
+
+    memFrame = (MemFrameArena){ 0 };
+}
+
 // Load data from file into a buffer
 unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead)
 {
@@ -192,50 +505,180 @@ unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead)
             data = loadFileData(fileName, bytesRead);
             return data;
         }
-#if defined(SUPPORT_STANDARD_FILEIO)
-        FILE *file = fopen(fileName, "rb");
+        data = LoadFileDataFromDisk(fileName, bytesRead);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
-        if (file != NULL)
+    return data;
+}
+
+// Unload file data allocated by LoadFileData()
+void UnloadFileData(unsigned char *data)
+{
+    RL_FREE(data);
+}
+
+// Map file data read-only into memory, avoiding a copy into heap memory
+// NOTE: If a custom LoadFileData callback is set or file can not be mapped, data is loaded
+// with LoadFileData() and returned from heap memory, UnmapFileData() unloads it accordingly
+// NOTE: Stored entries of a mounted pack file are returned directly from pack data (no copy)
+// WARNING: Returned data is read-only, it must be unmapped with UnmapFileData()
+unsigned char *MapFileData(const char *fileName, unsigned int *dataSize)
+{
+#if defined(FILE_MAPPING_AVAILABLE)
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return NULL;
+    }
+
+    bool mapFromDisk = (loadFileData == NULL);
+
+#if defined(SUPPORT_PACK_FILES)
+    if (loadFileData == LoadPackFileData)
+    {
+        const PackFileEntry *entry = FindPackFileEntry(fileName);
+
+        // Stored pack entries are returned directly from mounted pack data, files not found in pack are mapped from disk
+        if ((entry != NULL) && (entry->compression == PACK_COMPRESSION_NONE) && (entry->dataSize > 0))
+        {
+            *dataSize = entry->dataSize;
+            return pack.data + entry->dataOffset;
+        }
+
+        mapFromDisk = (entry == NULL) && (pack.loadFileData == NULL);
+    }
+#endif
+
+    if (mapFromDisk)
+    {
+    #if defined(_WIN32)
+        void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);   // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+        if (file != (void *)-1)
         {
-            // WARNING: On binary streams SEEK_END could not be found,
-            // using fseek() and ftell() could not work in some (rare) cases
-            fseek(file, 0, SEEK_END);
-            int size = ftell(file);
-            fseek(file, 0, SEEK_SET);
+            long long size = 0;
+            GetFileSizeEx(file, &size);
 
-            if (size > 0)
+            if ((size > 0) && (size <= 0xffffffff))
             {
-                data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+                void *mapping = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);           // PAGE_READONLY
 
-                if (data != NULL)
+                if (mapping != NULL)
                 {
-                    // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
-                    unsigned int count = (unsigned int)fread(data, sizeof(unsigned char), size, file);
-                    *bytesRead = count;
-
-                    if (count != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded", fileName);
-                    else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
+                    data = (unsigned char *)MapViewOfFile(mapping, 0x0004, 0, 0, 0);        // FILE_MAP_READ
+                    CloseHandle(mapping);   // NOTE: View keeps mapping object alive
                 }
-                else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+
+                if (data != NULL) *dataSize = (unsigned int)size;
             }
-            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
 
-            fclose(file);
+            CloseHandle(file);
+        }
+    #else
+        int file = open(fileName, O_RDONLY);
+
+        if (file != -1)
+        {
+            struct stat fileStat = { 0 };
+
+            if ((fstat(file, &fileStat) == 0) && (fileStat.st_size > 0) && (fileStat.st_size <= 0xffffffff))
+            {
+                data = (unsigned char *)mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+                if (data != MAP_FAILED) *dataSize = (unsigned int)fileStat.st_size;
+                else data = NULL;
+            }
+
+            close(file);
+        }
+    #endif
+
+        if (data != NULL)
+        {
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+            return data;
+        }
+    }
+
+    // Fallback: Load file data (custom callback or standard io), heap data is returned without copies
+    // and registered so UnmapFileData() unloads it with UnloadFileData()
+    unsigned int bytesRead = 0;
+    data = LoadFileData(fileName, &bytesRead);
+
+    if (data != NULL)
+    {
+        MapFileHeapData *heapData = (MapFileHeapData *)RL_MALLOC(sizeof(MapFileHeapData));
+
+        if (heapData != NULL)
+        {
+            heapData->data = data;
+
+            FILE_MAP_MUTEX_LOCK(&mapFileHeapMutex);
+            heapData->next = mapFileHeapData;
+            mapFileHeapData = heapData;
+            FILE_MAP_MUTEX_UNLOCK(&mapFileHeapMutex);
+
+            *dataSize = bytesRead;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocate memory for file data", fileName);
+            UnloadFileData(data);
+            data = NULL;
         }
-        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
-#endif
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
     return data;
+#else
+    return LoadFileData(fileName, dataSize);
+#endif
 }
 
-// Unload file data allocated by LoadFileData()
-void UnloadFileData(unsigned char *data)
+// Unmap file data mapped by MapFileData()
+void UnmapFileData(unsigned char *data, unsigned int dataSize)
 {
-    RL_FREE(data);
+    if (data == NULL) return;
+
+#if defined(SUPPORT_PACK_FILES)
+    // Data returned directly from mounted pack data is not unmapped
+    if ((data >= pack.data) && (data < (pack.data + pack.dataSize))) return;
+#endif
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    // Data loaded into heap memory by MapFileData() fallback is unloaded, not unmapped
+    MapFileHeapData *heapData = NULL;
+
+    FILE_MAP_MUTEX_LOCK(&mapFileHeapMutex);
+    for (MapFileHeapData **link = &mapFileHeapData; *link != NULL; link = &(*link)->next)
+    {
+        if ((*link)->data == data)
+        {
+            heapData = *link;
+            *link = heapData->next;
+            break;
+        }
+    }
+    FILE_MAP_MUTEX_UNLOCK(&mapFileHeapMutex);
+
+    if (heapData != NULL)
+    {
+        RL_FREE(heapData);
+        UnloadFileData(data);
+        return;
+    }
+
+    #if defined(_WIN32)
+    UnmapViewOfFile(data);
+    #else
+    munmap(data, dataSize);
+    #endif
+#else
+    UnloadFileData(data);
+#endif
 }
 
 // Save data to file from buffer
@@ -333,45 +776,7 @@ char *LoadFileText(const char *fileName)
             text = loadFileText(fileName);
             return text;
         }
-#if defined(SUPPORT_STANDARD_FILEIO)
-        FILE *file = fopen(fileName, "rt");
-
-        if (file != NULL)
-        {
-            // WARNING: When reading a file as 'text' file,
-            // text mode causes carriage return-linefeed translation...
-            // ...but using fseek() should return correct byte-offset
-            fseek(file, 0, SEEK_END);
-            unsigned int size = (unsigned int)ftell(file);
-            fseek(file, 0, SEEK_SET);
-
-            if (size > 0)
-            {
-                text = (char *)RL_MALLOC((size + 1)*sizeof(char));
-
-                if (text != NULL)
-                {
-                    unsigned int count = (unsigned int)fread(text, sizeof(char), size, file);
-
-                    // WARNING: \r\n is converted to \n on reading, so,
-                    // read bytes count gets reduced by the number of lines
-                    if (count < size) text = RL_REALLOC(text, count + 1);
-
-                    // Zero-terminate the string
-                    text[count] = '\0';
-
-                    TRACELOG(LOG_INFO, "FILEIO: [%s] Text file loaded successfully", fileName);
-                }
-                else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
-            }
-            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read text file", fileName);
-
-            fclose(file);
-        }
-        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open text file", fileName);
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
-#endif
+        text = LoadFileTextFromDisk(fileName);
     }
     else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
@@ -418,6 +823,225 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+#if defined(SUPPORT_PACK_FILES)
+// Mount pack file, mapped into memory, file loading functions read pack entries first
+// NOTE: Pack is mounted through file data/text load callbacks, files not found in pack are loaded from disk,
+// file names are resolved relative to mountPath (i.e. "resources"), use NULL or "" to resolve from pack root
+// NOTE: Custom file data/text load callbacks set before mounting are chained, files not found in pack are
+// loaded with them, they are restored on unmount; only one pack file can be mounted
+bool MountPackFile(const char *fileName, const char *mountPath)
+{
+    UnmountPackFile();
+
+    unsigned int dataSize = 0;
+    unsigned char *data = MapFileData(fileName, &dataSize);
+
+    if (data == NULL) return false;
+
+    // Validate pack header, index and names block
+    const PackFileHeader *header = (const PackFileHeader *)data;
+    bool valid = (dataSize >= sizeof(PackFileHeader)) &&
+                 (memcmp(header->id, PACK_FILE_ID, 4) == 0) && (header->version == PACK_FILE_VERSION) &&
+                 (header->entryCount <= (dataSize - sizeof(PackFileHeader))/sizeof(PackFileEntry)) &&
+                 (header->namesSize > 0) &&
+                 (header->namesSize <= (dataSize - sizeof(PackFileHeader) - header->entryCount*sizeof(PackFileEntry)));
+
+    const PackFileEntry *entries = (const PackFileEntry *)(data + sizeof(PackFileHeader));
+    const char *names = (const char *)(entries + (valid? header->entryCount : 0));
+
+    if (valid && (names[header->namesSize - 1] != '\0')) valid = false;
+
+    // Validate entries, so lookups can not read out of pack data
+    for (unsigned int i = 0; valid && (i < header->entryCount); i++)
+    {
+        if ((entries[i].nameOffset >= header->namesSize) ||
+            (entries[i].dataOffset > dataSize) || (entries[i].compSize > (dataSize - entries[i].dataOffset)) ||
+            ((entries[i].compression == PACK_COMPRESSION_NONE) && (entries[i].compSize != entries[i].dataSize)) ||
+            (entries[i].dataSize == 0xffffffff)) valid = false;
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file not valid", fileName);
+        UnmapFileData(data, dataSize);
+        return false;
+    }
+
+    pack.data = data;
+    pack.dataSize = dataSize;
+    pack.entries = entries;
+    pack.entryCount = header->entryCount;
+    pack.names = names;
+    pack.mountPathLength = 0;
+
+    // Normalize mount path: '\' separators to '/', leading "./" and trailing '/' removed
+    if (mountPath != NULL)
+    {
+        while ((mountPath[0] == '.') && ((mountPath[1] == '/') || (mountPath[1] == '\\'))) mountPath += 2;
+
+        for (int i = 0; (mountPath[i] != '\0') && (i < (MAX_PACK_NAME_LENGTH - 1)); i++) pack.mountPath[pack.mountPathLength++] = (mountPath[i] == '\\')? '/' : mountPath[i];
+        while ((pack.mountPathLength > 0) && (pack.mountPath[pack.mountPathLength - 1] == '/')) pack.mountPathLength--;
+        if ((pack.mountPathLength == 1) && (pack.mountPath[0] == '.')) pack.mountPathLength = 0;
+        pack.mountPath[pack.mountPathLength] = '\0';
+    }
+
+    pack.loadFileData = loadFileData;
+    pack.loadFileText = loadFileText;
+
+    SetLoadFileDataCallback(LoadPackFileData);
+    SetLoadFileTextCallback(LoadPackFileText);
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Pack file mounted successfully (%i entries)", fileName, pack.entryCount);
+
+    return true;
+}
+
+// Unmount pack file, custom file data/text load callbacks set before mounting are restored
+// WARNING: Data returned by MapFileData() from pack entries must be unmapped before unmounting the pack
+void UnmountPackFile(void)
+{
+    if (pack.data == NULL) return;
+
+    if (loadFileData == LoadPackFileData) SetLoadFileDataCallback(pack.loadFileData);
+    if (loadFileText == LoadPackFileText) SetLoadFileTextCallback(pack.loadFileText);
+
+    unsigned char *data = pack.data;
+    unsigned int dataSize = pack.dataSize;
+    memset(&pack, 0, sizeof(PackFile));
+
+    UnmapFileData(data, dataSize);
+
+    TRACELOG(LOG_INFO, "FILEIO: Pack file unmounted successfully");
+}
+
+// Export directory files (recursive) into a pack file, entries names are relative to dirPath
+// NOTE: Entries are DEFLATE compressed if it saves enough space, otherwise they are stored,
+// stored entries can be mapped directly from mounted pack by MapFileData() without copies
+bool ExportPackFile(const char *fileName, const char *dirPath)
+{
+    bool success = false;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FilePathList files = LoadDirectoryFilesEx(dirPath, NULL, true);
+
+    if (files.count == 0)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] No files found to export into pack", dirPath);
+        UnloadDirectoryFiles(files);
+        return false;
+    }
+
+    // Get entries names relative to dirPath, normalized with '/' separators
+    PackExportEntry *entries = (PackExportEntry *)RL_CALLOC(files.count, sizeof(PackExportEntry));
+    int dirPathLength = (int)strlen(dirPath);
+    unsigned int namesSize = 0;
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        char *name = files.paths[i] + dirPathLength;
+        while ((name[0] == '/') || (name[0] == '\\')) name++;
+        for (int c = 0; name[c] != '\0'; c++) if (name[c] == '\\') name[c] = '/';
+
+        entries[i].name = name;
+        entries[i].path = files.paths[i];
+        entries[i].hash = GetPackNameHash(name);
+        namesSize += (unsigned int)strlen(name) + 1;
+    }
+
+    qsort(entries, files.count, sizeof(PackExportEntry), ComparePackExportEntries);
+
+    PackFileHeader header = { 0 };
+    memcpy(header.id, PACK_FILE_ID, 4);
+    header.version = PACK_FILE_VERSION;
+    header.entryCount = files.count;
+    header.namesSize = namesSize;
+
+    PackFileEntry *index = (PackFileEntry *)RL_CALLOC(files.count, sizeof(PackFileEntry));
+    unsigned long long dataOffset = sizeof(PackFileHeader) + files.count*sizeof(PackFileEntry) + namesSize;   // 64bit, to detect offsets overflow
+    unsigned int nameOffset = 0;
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
+    {
+        success = true;
+
+        // Write entries data first, index and names are written at the end, once offsets are known
+        fseek(file, (long)dataOffset, SEEK_SET);
+
+        for (unsigned int i = 0; success && (i < files.count); i++)
+        {
+            unsigned int dataSize = 0;
+            unsigned char *data = LoadFileDataFromDisk(entries[i].path, &dataSize);
+
+            // Align entry data to PACK_DATA_ALIGNMENT bytes, useful for mapped access
+            static const unsigned char padding[PACK_DATA_ALIGNMENT] = { 0 };
+            unsigned int paddingSize = (unsigned int)((PACK_DATA_ALIGNMENT - dataOffset%PACK_DATA_ALIGNMENT)%PACK_DATA_ALIGNMENT);
+            fwrite(padding, 1, paddingSize, file);
+            dataOffset += paddingSize;
+
+            index[i].hash = entries[i].hash;
+            index[i].nameOffset = nameOffset;
+            index[i].dataOffset = (unsigned int)dataOffset;
+            index[i].dataSize = dataSize;
+            index[i].compSize = dataSize;
+            index[i].compression = PACK_COMPRESSION_NONE;
+            nameOffset += (unsigned int)strlen(entries[i].name) + 1;
+
+            const unsigned char *entryData = data;
+            unsigned char *compData = NULL;
+#if defined(SUPPORT_COMPRESSION_API)
+            if (dataSize >= PACK_COMPRESSION_MIN_SIZE)
+            {
+                int compSize = 0;
+                compData = CompressData(data, dataSize, &compSize);
+
+                // Store compressed data only if it saves at least 1/8 of entry size
+                if ((compData != NULL) && (compSize > 0) && ((unsigned int)compSize <= (dataSize - dataSize/8)))
+                {
+                    entryData = compData;
+                    index[i].compSize = (unsigned int)compSize;
+                    index[i].compression = PACK_COMPRESSION_DEFLATE;
+                }
+            }
+#endif
+            // Pack file entries offsets are 32bit, so pack data size is limited to 4GB
+            if ((dataOffset + index[i].compSize) > UINT_MAX)
+            {
+                TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file data exceeds 4GB limit", fileName);
+                success = false;
+            }
+
+            if (success && (index[i].compSize > 0) && (fwrite(entryData, 1, index[i].compSize, file) != index[i].compSize)) success = false;
+            dataOffset += index[i].compSize;
+
+            RL_FREE(compData);
+            RL_FREE(data);
+        }
+
+        // Write header, index and names
+        fseek(file, 0, SEEK_SET);
+        if (fwrite(&header, sizeof(PackFileHeader), 1, file) != 1) success = false;
+        if (fwrite(index, sizeof(PackFileEntry), files.count, file) != files.count) success = false;
+        for (unsigned int i = 0; i < files.count; i++) fwrite(entries[i].name, 1, strlen(entries[i].name) + 1, file);
+
+        if (fclose(file) != 0) success = false;
+    }
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Pack file exported successfully (%i entries)", fileName, files.count);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export pack file", fileName);
+
+    RL_FREE(index);
+    RL_FREE(entries);
+    UnloadDirectoryFiles(files);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, pack file can not be exported");
+#endif
+
+    return success;
+}
+#endif  // SUPPORT_PACK_FILES
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -436,8 +1060,12 @@ FILE *android_fopen(const char *fileName, const char *mode)
         // assets directory through AAssetManager but we want to also be able to
         // write data when required using the standard stdio FILE access functions
         // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
+        // NOTE: Path is composed on a local buffer, TextFormat() static buffers are not thread-safe
+        char filePath[512] = { 0 };
+        snprintf(filePath, 512, "%s/%s", internalDataPath, fileName);
+
         #undef fopen
-        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+        return fopen(filePath, mode);
         #define fopen(name, mode) android_fopen(name, mode)
     }
     else
@@ -452,9 +1080,12 @@ FILE *android_fopen(const char *fileName, const char *mode)
         }
         else
         {
+            char filePath[512] = { 0 };
+            snprintf(filePath, 512, "%s/%s", internalDataPath, fileName);
+
             #undef fopen
             // Just do a regular open if file is not found in the assets
-            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+            return fopen(filePath, mode);
             #define fopen(name, mode) android_fopen(name, mode)
         }
     }
@@ -464,6 +1095,235 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Load data from file into a buffer, using standard file io
+static unsigned char *LoadFileDataFromDisk(const char *fileName, unsigned int *bytesRead)
+{
+    unsigned char *data = NULL;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        // WARNING: On binary streams SEEK_END could not be found,
+        // using fseek() and ftell() could not work in some (rare) cases
+        fseek(file, 0, SEEK_END);
+        int size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+
+            if (data != NULL)
+            {
+                // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
+                unsigned int count = (unsigned int)fread(data, sizeof(unsigned char), size, file);
+                *bytesRead = count;
+
+                if (count != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded", fileName);
+                else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+
+    return data;
+}
+
+// Load text data from file, using standard file io
+static char *LoadFileTextFromDisk(const char *fileName)
+{
+    char *text = NULL;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "rt");
+
+    if (file != NULL)
+    {
+        // WARNING: When reading a file as 'text' file,
+        // text mode causes carriage return-linefeed translation...
+        // ...but using fseek() should return correct byte-offset
+        fseek(file, 0, SEEK_END);
+        unsigned int size = (unsigned int)ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            text = (char *)RL_MALLOC((size + 1)*sizeof(char));
+
+            if (text != NULL)
+            {
+                unsigned int count = (unsigned int)fread(text, sizeof(char), size, file);
+
+                // WARNING: \r\n is converted to \n on reading, so,
+                // read bytes count gets reduced by the number of lines
+                if (count < size) text = RL_REALLOC(text, count + 1);
+
+                // Zero-terminate the string
+                text[count] = '\0';
+
+                TRACELOG(LOG_INFO, "FILEIO: [%s] Text file loaded successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read text file", fileName);
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open text file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+
+    return text;
+}
+
+#if defined(SUPPORT_PACK_FILES)
+// Compute pack entry name hash (FNV-1a, 32bit)
+static unsigned int GetPackNameHash(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; name[i] != '\0'; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Compare pack entries by name hash and name, used for sorting on export
+static int ComparePackExportEntries(const void *a, const void *b)
+{
+    const PackExportEntry *entryA = (const PackExportEntry *)a;
+    const PackExportEntry *entryB = (const PackExportEntry *)b;
+
+    if (entryA->hash != entryB->hash) return (entryA->hash < entryB->hash)? -1 : 1;
+
+    return strcmp(entryA->name, entryB->name);
+}
+
+// Find entry in mounted pack file, file name is resolved relative to mount path
+// NOTE: Entries are sorted by name hash and name, so a binary search is used
+static const PackFileEntry *FindPackFileEntry(const char *fileName)
+{
+    if (pack.data == NULL) return NULL;
+
+    // Normalize file name: '\' separators to '/', leading "./" removed
+    char name[MAX_PACK_NAME_LENGTH] = { 0 };
+    int length = 0;
+
+    for (int i = 0; (fileName[i] != '\0') && (length < (MAX_PACK_NAME_LENGTH - 1)); i++) name[length++] = (fileName[i] == '\\')? '/' : fileName[i];
+    if (fileName[length] != '\0') return NULL;      // File name too long, can not be a pack entry
+
+    const char *entryName = name;
+    while ((entryName[0] == '.') && (entryName[1] == '/')) entryName += 2;
+
+    // Remove mount path from file name, files out of mount path are not in pack
+    if (pack.mountPathLength > 0)
+    {
+        if ((strncmp(entryName, pack.mountPath, pack.mountPathLength) != 0) || (entryName[pack.mountPathLength] != '/')) return NULL;
+        entryName += (pack.mountPathLength + 1);
+    }
+
+    unsigned int hash = GetPackNameHash(entryName);
+    int low = 0;
+    int high = (int)pack.entryCount - 1;
+
+    while (low <= high)
+    {
+        int mid = low + (high - low)/2;
+        const PackFileEntry *entry = &pack.entries[mid];
+
+        int result = (entry->hash < hash)? -1 : ((entry->hash > hash)? 1 : strcmp(pack.names + entry->nameOffset, entryName));
+
+        if (result == 0) return entry;
+        else if (result < 0) low = mid + 1;
+        else high = mid - 1;
+    }
+
+    return NULL;
+}
+
+// Load mounted pack entry data into a new buffer, decompressing it if required
+// NOTE: One extra '\0' byte is allocated, so data can be used as text
+static unsigned char *LoadPackEntryData(const PackFileEntry *entry)
+{
+    unsigned char *data = (unsigned char *)RL_MALLOC(entry->dataSize + 1);
+    if (data == NULL) return NULL;
+
+    bool loaded = false;
+
+    if (entry->compression == PACK_COMPRESSION_NONE)
+    {
+        memcpy(data, pack.data + entry->dataOffset, entry->dataSize);
+        loaded = true;
+    }
+#if defined(SUPPORT_COMPRESSION_API)
+    else if (entry->compression == PACK_COMPRESSION_DEFLATE)
+    {
+        loaded = (sinflate(data, entry->dataSize, pack.data + entry->dataOffset, entry->compSize) == (int)entry->dataSize);
+    }
+#endif
+
+    if (!loaded)
+    {
+        RL_FREE(data);
+        return NULL;
+    }
+
+    data[entry->dataSize] = '\0';
+
+    return data;
+}
+
+// Load file data callback for mounted pack file, files not found in pack are loaded
+// with previous custom callback (if set) or from disk
+static unsigned char *LoadPackFileData(const char *fileName, unsigned int *bytesRead)
+{
+    const PackFileEntry *entry = FindPackFileEntry(fileName);
+
+    if (entry == NULL) return (pack.loadFileData != NULL)? pack.loadFileData(fileName, bytesRead) : LoadFileDataFromDisk(fileName, bytesRead);
+
+    unsigned char *data = LoadPackEntryData(entry);
+
+    if (data != NULL)
+    {
+        *bytesRead = entry->dataSize;
+        TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully from pack", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to load file from pack", fileName);
+
+    return data;
+}
+
+// Load file text callback for mounted pack file, files not found in pack are loaded
+// with previous custom callback (if set) or from disk
+// NOTE: Text entries are stored as binary data, no carriage return-linefeed translation is done
+static char *LoadPackFileText(const char *fileName)
+{
+    const PackFileEntry *entry = FindPackFileEntry(fileName);
+
+    if (entry == NULL) return (pack.loadFileText != NULL)? pack.loadFileText(fileName) : LoadFileTextFromDisk(fileName);
+
+    char *text = (char *)LoadPackEntryData(entry);
+
+    if (text != NULL) TRACELOG(LOG_INFO, "FILEIO: [%s] Text file loaded successfully from pack", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to load text file from pack", fileName);
+
+    return text;
+}
+#endif  // SUPPORT_PACK_FILES
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *buf, int size)
 {
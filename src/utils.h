@@ -45,6 +45,14 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+#if defined(SUPPORT_PROFILER)
+    #define PROFILE_ZONE_BEGIN(name) BeginProfileZone(name)
+    #define PROFILE_ZONE_END() EndProfileZone()
+#else
+    #define PROFILE_ZONE_BEGIN(name) (void)0
+    #define PROFILE_ZONE_END() (void)0
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -55,7 +63,8 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Job range work callback, runs items range [start..end)
+typedef void (*JobRangeCallback)(void *data, int start, int end);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +78,9 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+void LoadMemFrame(void);                                               // Load current thread frame memory arena (main thread and job workers)
+void RunJobRanges(JobRangeCallback work, void *data, int count, int rangeSize, int maxRanges);   // Run work over items ranges on job workers and calling thread [rcore]
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!